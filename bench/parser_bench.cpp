@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "parser/parser.h"
+#include "scanner/scanner.h"
+#include "util/arena.h"
+#include "util/interner.h"
+#include "util/source.h"
+#include "util/type_table.h"
+
+// XerlangParserBench <source>...
+// Parse time of one LALR driver, BENCH_DRIVER: this file is built once against each (bench/CMakeLists.txt), so the
+// two executables' figures compare the table-driven loop with the directly-coded one. Each source is scanned once up
+// front and its tokens replayed, so the figure is the parser's alone; it is the best of BENCH_REPEATS parses into a
+// fresh arena, with one ParserContext reused as the compiler would.
+#define BENCH_REPEATS 7
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <source>..." << std::endl;
+        return 2;
+    }
+    ParserContext parser;
+    for (int i = 1; i < argc; i++) {
+        try {
+            const SourceBuffer source{argv[i]};
+            Interner symbols;
+            std::vector<Token> stream = {{Parser::ParserSymbol::BoF}};
+            if (!scan_tokens(source, symbols, stream, std::cerr)) return 1;
+            stream.push_back({Parser::ParserSymbol::EoF, static_cast<uint32_t>(source.text().size())});
+
+            double best = 0;
+            for (int repeat = 0; repeat < BENCH_REPEATS; repeat++) {
+                TypeTable types{symbols};
+                Arena ast;
+                VectorTokenSource tokens{stream};
+                const auto start = std::chrono::steady_clock::now();
+                if (!parser.parse(tokens, source, types, ast, std::cerr)) return 1;
+                const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+                best = repeat == 0 ? took.count() : std::min(best, took.count());
+            }
+            std::cout << argv[i] << " (" << stream.size() << " tokens)\n  " << std::left << std::setw(8)
+                      << BENCH_DRIVER << std::right << std::fixed << std::setprecision(2) << std::setw(9) << best * 1e3
+                      << " ms  " << std::setprecision(1) << std::setw(7) << stream.size() / best / 1e6
+                      << " M tokens/s\n";
+        } catch (std::exception& e) {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,53 @@
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "scanner/scanner.h"
+#include "scanner/simd.h"
+#include "util/interner.h"
+#include "util/source.h"
+
+// XerlangScannerBench <source>...
+// Scanner throughput on each source: baseline is the byte-at-a-time scanner from before the bulk-skipping kernels,
+// followed by every kernel set this CPU supports; the scanner runs the scalar ones unless told otherwise. Each figure is the best of
+// BENCH_REPEATS single-threaded scans, so it measures the lexer rather than the thread pool.
+#define BENCH_REPEATS 7
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <source>..." << std::endl;
+        return 2;
+    }
+    for (int i = 1; i < argc; i++) {
+        try {
+            const SourceBuffer source{argv[i]};
+            const size_t bytes = source.text().size();
+            std::cout << argv[i] << " (" << bytes << " bytes)\n";
+            std::vector<const ScanKernels*> candidates = supported_scan_kernels();
+            candidates.insert(candidates.begin(), &BYTE_AT_A_TIME_KERNELS);
+            for (const ScanKernels* kernels : candidates) {
+                use_scan_kernels(*kernels);
+                double best = 0;
+                size_t num_tokens = 0;
+                for (int repeat = 0; repeat < BENCH_REPEATS; repeat++) {
+                    Interner symbols;
+                    std::vector<Token> stream;
+                    const auto start = std::chrono::steady_clock::now();
+                    if (!scan_tokens(source, symbols, stream, std::cerr, 1)) return 1;
+                    const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+                    best = repeat == 0 ? took.count() : std::min(best, took.count());
+                    num_tokens = stream.size();
+                }
+                std::cout << "  " << std::left << std::setw(8) << kernels->name << std::right << std::fixed
+                          << std::setprecision(1) << std::setw(9) << bytes / best / 1e6 << " MB/s  "
+                          << std::setprecision(2) << std::setw(8) << best * 1e3 << " ms  " << num_tokens
+                          << " tokens\n";
+            }
+        } catch (std::exception& e) {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+}
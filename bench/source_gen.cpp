@@ -0,0 +1,141 @@
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <string_view>
+
+// XerlangSourceGen <shape> <count> <output>
+// Writes a well-typed Xerlang program of a given shape and size, for the benchmarks and the scaling tests:
+//   mixed N  N procedures of everyday code (comments, blank lines, declarations, loops, branches, calls and
+//            expression-heavy assignments), then a main calling them; about 1 KiB per procedure
+//   decls N  N globals, N initialised globals and N one-line procedures at top level, then an empty main
+//   lists N  a struct of N fields, then a main with an N-way elif chain and a print of N arguments
+// The output depends only on the arguments.
+
+// xorshift64: the same sequence on every platform, unlike the distributions of <random>
+struct Random {
+    uint64_t state = 0x9E3779B97F4A7C15;
+
+    uint32_t below(uint32_t n) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return static_cast<uint32_t>(state >> 32) % n;
+    }
+};
+
+struct MixedWriter {
+    std::ostream& os;
+    Random rng{};
+
+    static constexpr std::string_view INT_OPS[] = {"+", "-", "*", "/", "%", "&", "|", "^", "<<", ">>"};
+    static constexpr std::string_view COMPARISONS[] = {"==", "!=", "<", "<=", ">", ">="};
+    static constexpr std::string_view COMMENTS[] = {
+        "# running total of the loop below",
+        "# keep the result small enough to print",
+        "# TODO: check this against the reference implementation",
+        "# the next branch is taken for capital letters only",
+    };
+
+    // An int expression over the procedure's variables, nested up to depth
+    void int_expr(int depth, bool in_loop) {
+        if (depth == 0 || rng.below(4) == 0) {
+            switch (rng.below(in_loop ? 6 : 5)) {
+                case 0: os << "alpha"; break;
+                case 1: os << "beta"; break;
+                case 2: os << "delta"; break;
+                case 3: os << "total_sum"; break;
+                case 4: os << rng.below(100000); break;
+                default: os << "index"; break;
+            }
+            return;
+        }
+        os << '(';
+        int_expr(depth - 1, in_loop);
+        os << ' ' << INT_OPS[rng.below(std::size(INT_OPS))] << ' ';
+        int_expr(depth - 1, in_loop);
+        os << ')';
+    }
+
+    void condition(bool in_loop) {
+        int_expr(2, in_loop);
+        os << ' ' << COMPARISONS[rng.below(std::size(COMPARISONS))] << ' ';
+        int_expr(1, in_loop);
+        if (rng.below(2)) {
+            os << (rng.below(2) ? " && " : " || ") << "gamma_value " << (rng.below(2) ? "==" : "!=") << " '"
+               << static_cast<char>('a' + rng.below(26)) << '\'';
+        }
+    }
+
+    void procedure(uint32_t n) {
+        os << "\n" << COMMENTS[rng.below(std::size(COMMENTS))] << "\n";
+        os << "helper_" << n << " : (int alpha, int beta, char gamma_value) -> int {\n";
+        os << "    int delta = alpha + beta; # sum first\n";
+        os << "    int total_sum = 0;\n";
+        os << "    for (int index = 0; index < " << 2 + rng.below(30) << "; index++) {\n";
+        os << "        total_sum = total_sum + ";
+        int_expr(3, true);
+        os << ";\n";
+        os << "        if (";
+        condition(true);
+        os << ") {\n            total_sum = total_sum / 2;\n        }\n";
+        os << "        elif (";
+        condition(true);
+        os << ") {\n            " << COMMENTS[rng.below(std::size(COMMENTS))] << "\n            delta = ";
+        int_expr(2, true);
+        os << ";\n        }\n        else {\n            total_sum++;\n        }\n    }\n\n";
+        os << "    while (delta > 0) {\n        delta = delta - " << 1 + rng.below(9) << ";\n    }\n";
+        os << "    print(total_sum, delta);\n";
+        os << "    return total_sum";
+        if (n > 0) os << " + helper_" << rng.below(n) << "(delta, beta, gamma_value)";
+        os << ";\n}\n";
+    }
+
+    void program(uint32_t count) {
+        os << "# Generated by XerlangSourceGen: " << count << " procedures of mixed code\n";
+        os << "int global_counter = 0;\n";
+        for (uint32_t n = 0; n < count; n++) procedure(n);
+        os << "\nmain : () -> int {\n    char c = read();\n    int result = 0;\n";
+        for (uint32_t n = 0; n < count; n += 1 + count / 16) {
+            os << "    result = result + helper_" << n << "(" << rng.below(1000) << ", result, c);\n";
+        }
+        os << "    print(result);\n    return 0;\n}\n";
+    }
+};
+
+void write_decls(std::ostream& os, uint32_t count) {
+    for (uint32_t n = 0; n < count; n++) {
+        os << "int g" << n << ";\n";
+        os << "int h" << n << " = " << n << ";\n";
+        os << "p" << n << " : (int a, char b) -> int {\n    return a;\n}\n";
+    }
+    os << "main : () -> int {\n    return 0;\n}\n";
+}
+
+void write_lists(std::ostream& os, uint32_t count) {
+    os << "struct Wide {\n";
+    for (uint32_t n = 0; n < count; n++) os << "    int f" << n << ";\n";
+    os << "};\n\nmain : () -> int {\n    int x = 0;\n    if (x == 0) {\n        x++;\n    }\n";
+    for (uint32_t n = 1; n < count; n++) os << "    elif (x == " << n << ") {\n        x++;\n    }\n";
+    os << "    print(";
+    for (uint32_t n = 0; n < count; n++) os << (n > 0 ? ", " : "") << n;
+    os << ");\n    return 0;\n}\n";
+}
+
+int main(int argc, char* argv[]) {
+    const std::string_view shape = argc == 4 ? argv[1] : "";
+    if (shape != "mixed" && shape != "decls" && shape != "lists") {
+        std::cerr << "usage: " << argv[0] << " mixed|decls|lists <count> <output>" << std::endl;
+        return 2;
+    }
+    const auto count = static_cast<uint32_t>(std::stoul(argv[2]));
+
+    std::ofstream file{argv[3], std::ios::binary};
+    if (shape == "mixed") MixedWriter{file}.program(count);
+    else if (shape == "decls") write_decls(file, count);
+    else write_lists(file, count);
+    if (!file.flush()) {
+        std::cerr << "ERROR: cannot write " << argv[3] << std::endl;
+        return 1;
+    }
+}
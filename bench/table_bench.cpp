@@ -0,0 +1,106 @@
+#include <chrono>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <span>
+#include <vector>
+#include "parser/parse_table.h"
+#include "parser_dense.h"
+#include "scanner/scanner.h"
+#include "util/interner.h"
+#include "util/source.h"
+
+// XerlangTableBench <source>...
+// Lookup cost of the dense PARSING_TABLE against the compressed PARSE_TABLE the parser uses. A recognizer-only
+// LALR loop (the state stack, no semantic values) runs over each source's tokens with each table, so the table
+// lookups are most of the work; each figure is the best of BENCH_REPEATS runs.
+#define BENCH_REPEATS 7
+
+struct DenseLookup {
+    static constexpr const char* name = "dense";
+
+    static ParsingTableEntry action(uint16_t state, ParserSymbol terminal) { return PARSING_TABLE[state][terminal]; }
+    static uint16_t goto_state(uint16_t state, ParserSymbol nonterminal) {
+        return PARSING_TABLE[state][nonterminal].target_state;
+    }
+};
+
+struct CompressedLookup {
+    static constexpr const char* name = "compressed";
+
+    static ParsingTableEntry action(uint16_t state, ParserSymbol terminal) { return ::action(state, terminal); }
+    static uint16_t goto_state(uint16_t state, ParserSymbol nonterminal) { return ::goto_state(state, nonterminal); }
+};
+
+// Runs the LALR automaton over tokens; the number of ACTION lookups taken to accept, 0 on a syntax error
+template <class Table>
+size_t recognize(std::span<const Token> tokens, std::vector<uint16_t>& states) {
+    states.clear();
+    states.push_back(0);
+    size_t steps = 0;
+    for (size_t next = 0;; steps++) {
+        const ParsingTableEntry pte = Table::action(states.back(), tokens[next].type);
+        switch (pte.act) {
+            case ParsingTableEntry::Action::SHIFT:
+                states.push_back(pte.target_state);
+                next++;
+                break;
+            case ParsingTableEntry::Action::REDUCE: {
+                const Production& prod = PRODUCTIONS[pte.production_id];
+                states.resize(states.size() - prod.len);
+                states.push_back(Table::goto_state(states.back(), prod.LHS));
+                break;
+            }
+            case ParsingTableEntry::Action::ACCEPT:
+                return steps + 1;
+            default:
+                return 0;
+        }
+    }
+}
+
+template <class Table>
+bool run(std::span<const Token> tokens, size_t table_bytes) {
+    std::vector<uint16_t> states;
+    double best = 0;
+    size_t steps = 0;
+    for (int repeat = 0; repeat < BENCH_REPEATS; repeat++) {
+        const auto start = std::chrono::steady_clock::now();
+        steps = recognize<Table>(tokens, states);
+        const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+        if (steps == 0) {
+            std::cerr << "ERROR: syntax error in the benchmark input" << std::endl;
+            return false;
+        }
+        best = repeat == 0 ? took.count() : std::min(best, took.count());
+    }
+    std::cout << "  " << std::left << std::setw(11) << Table::name << std::right << std::fixed << std::setprecision(2)
+              << std::setw(9) << best * 1e3 << " ms  " << std::setprecision(1) << std::setw(7) << steps / best / 1e6
+              << " M steps/s  " << std::setw(6) << table_bytes << " table bytes\n";
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <source>..." << std::endl;
+        return 2;
+    }
+    for (int i = 1; i < argc; i++) {
+        try {
+            const SourceBuffer source{argv[i]};
+            Interner symbols;
+            std::vector<Token> tokens = {{Parser::ParserSymbol::BoF}};
+            if (!scan_tokens(source, symbols, tokens, std::cerr)) return 1;
+            const auto eof = static_cast<uint32_t>(source.text().size());
+            tokens.push_back({Parser::ParserSymbol::EoF, eof});
+            tokens.push_back({Parser::ParserSymbol::DOLLAR, eof});
+
+            std::cout << argv[i] << " (" << tokens.size() << " tokens)\n";
+            if (!run<DenseLookup>(tokens, sizeof PARSING_TABLE)) return 1;
+            if (!run<CompressedLookup>(tokens, sizeof PARSE_TABLE)) return 1;
+        } catch (std::exception& e) {
+            std::cerr << "ERROR: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+}
@@ -0,0 +1,197 @@
+#include "emit.h"
+#include <map>
+#include <ostream>
+#include <vector>
+#include "pack.h"
+
+using namespace Parser;
+
+void emit_entry(const ParsingTableEntry& pte, std::ostream& os) {
+    switch (pte.act) {
+        case ParsingTableEntry::Action::SHIFT: os << "s(" << pte.target_state << ')'; break;
+        case ParsingTableEntry::Action::REDUCE: os << "r(" << pte.production_id << ')'; break;
+        case ParsingTableEntry::Action::GOTO: os << "g(" << pte.target_state << ')'; break;
+        case ParsingTableEntry::Action::ACCEPT: os << "a()"; break;
+        default: os << "n()"; break;
+    }
+}
+
+// One member of PARSE_TABLE's initialiser, 16 values to a line
+template <class T>
+void emit_array(const char* member, const std::vector<T>& values, std::ostream& os) {
+    os << "    // " << member << "\n    {{";
+    for (size_t i = 0; i < values.size(); i++) {
+        if (i) os << (i % 16 ? ", " : ",\n      ");
+        os << +values[i];
+    }
+    os << "}},\n";
+}
+
+void emit_parser_constants(const Grammar& grammar, const LALRTable& table, const Profile& profile, std::ostream& os) {
+    const PackedTable packed = pack_table(grammar, table, profile);
+    os << "#ifndef PARSER_CONSTANTS_H\n"
+          "#define PARSER_CONSTANTS_H\n"
+          "\n"
+          "// Generated from xer/grammar by XerlangParserGen (generator/) -- edit the grammar, not this file.\n"
+          "\n"
+          "#include <array>\n"
+          "#include \"parser/table_entry.h\"\n"
+          "#include \"util/types.h\"\n"
+          "\n"
+          "#define NUM_STATES " << table.rows.size() << "\n"
+          "#define NUM_PRODUCTIONS " << grammar.num_productions() << "\n"
+          "#define ACTION_SLOTS " << packed.action.size() << "\n"
+          "#define GOTO_SLOTS " << packed.goto_target.size() << "\n"
+          "\n"
+          "using namespace Parser;\n"
+          "\n";
+
+    os << "inline constexpr CompressedParseTable<NUM_STATES, ACTION_SLOTS, GOTO_SLOTS> PARSE_TABLE = {\n";
+    emit_array("action_column", packed.action_column, os);
+    emit_array("default_action", packed.default_action, os);
+    emit_array("action_base", packed.action_base, os);
+    emit_array("action", packed.action, os);
+    emit_array("action_check", packed.action_check, os);
+    emit_array("goto_default", packed.goto_default, os);
+    emit_array("goto_base", packed.goto_base, os);
+    emit_array("goto_target", packed.goto_target, os);
+    emit_array("goto_check", packed.goto_check, os);
+    os << "};\n\n";
+
+    for (size_t p = 0; p < grammar.num_productions(); p++) {
+        const Rule& rule = grammar.rules[p];
+        os << "#define " << PARSER_SYMBOL_NAMES[rule.lhs] << '_';
+        for (const uint16_t sym : rule.rhs) os << PARSER_SYMBOL_NAMES[sym];
+        os << ' ' << p << '\n';
+    }
+
+    os << "\ninline constexpr std::array<const Production, NUM_PRODUCTIONS> PRODUCTIONS{{\n";
+    for (size_t p = 0; p < grammar.num_productions(); p++) {
+        const Rule& rule = grammar.rules[p];
+        os << "    {ParserSymbol::" << PARSER_SYMBOL_NAMES[rule.lhs] << ", " << rule.rhs.size() << ", {";
+        for (const uint16_t sym : rule.rhs) os << "ParserSymbol::" << PARSER_SYMBOL_NAMES[sym] << ',';
+        os << "}},\n";
+    }
+    os << "}};\n\n#endif // PARSER_CONSTANTS_H\n";
+}
+
+// Cases grouped by the statement they jump to, in order of first appearance
+using CaseGroups = std::vector<std::pair<std::string, std::vector<std::string>>>;
+
+void add_case(CaseGroups& groups, const std::string& stmt, const std::string& label) {
+    for (auto& [s, labels] : groups) {
+        if (s == stmt) {
+            labels.push_back(label);
+            return;
+        }
+    }
+    groups.push_back({stmt, {label}});
+}
+
+void emit_switch(const char* subject, const CaseGroups& groups, const std::string& default_stmt, std::ostream& os) {
+    os << "    switch (" << subject << ") {\n";
+    for (const auto& [stmt, labels] : groups) {
+        os << "        ";
+        for (const std::string& label : labels) os << "case " << label << ": ";
+        os << stmt << ";\n";
+    }
+    os << "        default: " << default_stmt << ";\n";
+    os << "    }\n";
+}
+
+std::string reduce_stmt(const Grammar& grammar, uint16_t production) {
+    return "XERLANG_REDUCE(" + std::to_string(production) + ", " + std::string{PARSER_SYMBOL_NAMES[grammar.rules[production].lhs]} + ")";
+}
+
+void emit_direct_parser(const Grammar& grammar, const LALRTable& table, std::ostream& os) {
+    os << "// Generated from xer/grammar by XerlangParserGen (generator/) -- edit the grammar, not this file.\n"
+          "// Directly-coded LALR(1) driver; see emit_direct_parser() for the macros it expects.\n";
+
+    for (size_t s = 0; s < table.rows.size(); s++) {
+        const TableRow& row = table.rows[s];
+
+        // As in the compressed table, the state's most frequent reduction also covers its error entries
+        std::map<uint16_t, size_t> uses;
+        for (const ParsingTableEntry& pte : row) {
+            if (pte.act == ParsingTableEntry::Action::REDUCE) uses[pte.production_id]++;
+        }
+        int default_reduction = -1;
+        size_t most = 0;
+        for (const auto& [production, count] : uses) {
+            if (count > most) {
+                most = count;
+                default_reduction = production;
+            }
+        }
+
+        CaseGroups groups;
+        for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+            const ParsingTableEntry& pte = row[sym];
+            const std::string label = "ParserSymbol::" + std::string{PARSER_SYMBOL_NAMES[sym]};
+            switch (pte.act) {
+                case ParsingTableEntry::Action::SHIFT:
+                    add_case(groups, "XERLANG_SHIFT(" + std::to_string(pte.target_state) + ")", label);
+                    break;
+                case ParsingTableEntry::Action::REDUCE:
+                    if (pte.production_id != default_reduction) add_case(groups, reduce_stmt(grammar, pte.production_id), label);
+                    break;
+                case ParsingTableEntry::Action::ACCEPT:
+                    add_case(groups, "XERLANG_ACCEPT()", label);
+                    break;
+                default:
+                    break;
+            }
+        }
+        if (s > 0) os << "state_" << s << ":\n"; // the start state is only ever fallen into, so it needs no label
+        emit_switch("lookahead.type", groups, default_reduction < 0 ? "XERLANG_ERROR()" : reduce_stmt(grammar, default_reduction), os);
+    }
+
+    // GOTO dispatch: the most common target of each nonterminal is its default
+    for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+        if (!grammar.nonterminal[sym]) continue;
+        std::map<uint16_t, size_t> uses;
+        for (const TableRow& row : table.rows) {
+            if (row[sym].act == ParsingTableEntry::Action::GOTO) uses[row[sym].target_state]++;
+        }
+        if (uses.empty()) continue;
+        uint16_t default_target = 0;
+        size_t most = 0;
+        for (const auto& [target, count] : uses) {
+            if (count > most) {
+                most = count;
+                default_target = target;
+            }
+        }
+
+        CaseGroups groups;
+        for (size_t s = 0; s < table.rows.size(); s++) {
+            const ParsingTableEntry& pte = table.rows[s][sym];
+            if (pte.act != ParsingTableEntry::Action::GOTO || pte.target_state == default_target) continue;
+            add_case(groups, "XERLANG_GOTO(" + std::to_string(pte.target_state) + ")", std::to_string(s));
+        }
+        os << "goto_" << PARSER_SYMBOL_NAMES[sym] << ":\n";
+        emit_switch("states.back()", groups, "XERLANG_GOTO(" + std::to_string(default_target) + ")", os);
+    }
+}
+
+void emit_dense_table(const LALRTable& table, std::ostream& os) {
+    os << "#ifndef PARSER_DENSE_H\n"
+          "#define PARSER_DENSE_H\n"
+          "\n"
+          "// Generated from xer/grammar by XerlangParserGen (generator/) -- edit the grammar, not this file.\n"
+          "// The uncompressed table PARSE_TABLE was packed from; the parser itself never includes it.\n"
+          "\n"
+          "#include <array>\n"
+          "#include \"parser_constants.h\"\n"
+          "\n"
+          "inline constexpr std::array<std::array<ParsingTableEntry, ParserSymbol::NUM_SYMBOLS>, NUM_STATES> PARSING_TABLE = {{\n";
+    for (const TableRow& row : table.rows) {
+        os << "    {";
+        for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+            if (sym) os << ',';
+            emit_entry(row[sym], os);
+        }
+        os << "},\n";
+    }
+    os << "}};\n\n#endif // PARSER_DENSE_H\n";
+}
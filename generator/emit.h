@@ -0,0 +1,23 @@
+#ifndef XERLANG_EMIT_H
+#define XERLANG_EMIT_H
+
+#include <iosfwd>
+#include "lalr.h"
+#include "profile.h"
+
+// Writes parser_constants.h: NUM_STATES, NUM_PRODUCTIONS, the compressed PARSE_TABLE (with its ACTION_SLOTS and
+// GOTO_SLOTS, laid out by pack_table() from profile), one production-id macro per rule (lhs_RHSSYMBOLS) and
+// PRODUCTIONS
+void emit_parser_constants(const Grammar& grammar, const LALRTable& table, const Profile& profile, std::ostream& os);
+
+// Writes parser_dense.h: the dense PARSING_TABLE, one ParsingTableEntry per state and symbol. Only the table
+// benchmark includes it, to compare its lookups with PARSE_TABLE's.
+void emit_dense_table(const LALRTable& table, std::ostream& os);
+
+// Writes the directly-coded driver: one labelled block per state that switches on the lookahead, plus one GOTO
+// dispatch block per nonterminal that switches on the uncovered state. The including function supplies the
+// XERLANG_SHIFT(target), XERLANG_REDUCE(production, lhs), XERLANG_GOTO(target), XERLANG_ACCEPT() and XERLANG_ERROR()
+// macros; every block ends in one of them, and control enters at state_0.
+void emit_direct_parser(const Grammar& grammar, const LALRTable& table, std::ostream& os);
+
+#endif //XERLANG_EMIT_H
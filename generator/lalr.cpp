@@ -0,0 +1,302 @@
+#include "lalr.h"
+#include <algorithm>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace Parser;
+
+//// Grammar
+
+uint16_t symbol_id(const std::string& name, size_t line) {
+    const auto it = std::find(PARSER_SYMBOL_NAMES.begin(), PARSER_SYMBOL_NAMES.end(), name);
+    if (it == PARSER_SYMBOL_NAMES.end() || *it == "DOLLAR") {
+        throw std::runtime_error{"ERROR: grammar line " + std::to_string(line) + ": unknown symbol '" + name + "'"};
+    }
+    return it - PARSER_SYMBOL_NAMES.begin();
+}
+
+Grammar read_grammar(std::istream& is) {
+    Grammar grammar;
+    std::string text;
+    for (size_t line = 1; std::getline(is, text); line++) {
+        std::istringstream words{text};
+        std::vector<std::string> w;
+        for (std::string word; words >> word;) w.push_back(word);
+        if (w.empty()) continue;
+        if (w.size() < 3 || (w[1] != "->" && w[1] != "=>") || w.back() != ".") {
+            throw std::runtime_error{"ERROR: grammar line " + std::to_string(line) + ": expected 'lhs -> symbols .'"};
+        }
+        if (w[1] == "=>" && w.size() != 4) {
+            throw std::runtime_error{"ERROR: grammar line " + std::to_string(line) + ": a pass-through rule has one RHS symbol"};
+        }
+
+        Rule rule{symbol_id(w[0], line), {}, w[1] == "=>"};
+        for (size_t i = 2; i + 1 < w.size(); i++) rule.rhs.push_back(symbol_id(w[i], line));
+        if (rule.rhs.size() > MAX_RHS_LEN) {
+            throw std::runtime_error{"ERROR: grammar line " + std::to_string(line) + ": RHS longer than MAX_RHS_LEN"};
+        }
+        grammar.nonterminal.set(rule.lhs);
+        grammar.rules.push_back(std::move(rule));
+    }
+    if (grammar.rules.empty()) throw std::runtime_error{"ERROR: grammar has no productions"};
+    for (const Rule& rule : grammar.rules) {
+        if (rule.pass_through && !grammar.nonterminal[rule.rhs.front()]) {
+            throw std::runtime_error{"ERROR: pass-through rule for " + std::string{PARSER_SYMBOL_NAMES[rule.lhs]} +
+                                     " must derive a nonterminal"};
+        }
+    }
+
+    grammar.rules.push_back(Rule{AUGMENTED_START, {grammar.rules.front().lhs}});
+    return grammar;
+}
+
+//// FIRST sets
+
+struct FirstSets {
+    std::vector<SymbolSet> first; // indexed by symbol
+    std::vector<bool> nullable;
+};
+
+FirstSets compute_first_sets(const Grammar& grammar) {
+    FirstSets fs{std::vector<SymbolSet>(AUGMENTED_START + 1), std::vector<bool>(AUGMENTED_START + 1, false)};
+    for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+        if (!grammar.nonterminal[sym]) fs.first[sym].set(sym);
+    }
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const Rule& rule : grammar.rules) {
+            SymbolSet first = fs.first[rule.lhs];
+            bool nullable = true;
+            for (const uint16_t sym : rule.rhs) {
+                first |= fs.first[sym];
+                if (!fs.nullable[sym]) {
+                    nullable = false;
+                    break;
+                }
+            }
+            if (first != fs.first[rule.lhs] || (nullable && !fs.nullable[rule.lhs])) {
+                fs.first[rule.lhs] = first;
+                fs.nullable[rule.lhs] = fs.nullable[rule.lhs] || nullable;
+                changed = true;
+            }
+        }
+    }
+    return fs;
+}
+
+// FIRST(rhs[from..] lookahead)
+SymbolSet first_of(const std::vector<uint16_t>& rhs, size_t from, const SymbolSet& lookahead, const FirstSets& fs) {
+    SymbolSet first;
+    for (size_t i = from; i < rhs.size(); i++) {
+        first |= fs.first[rhs[i]];
+        if (!fs.nullable[rhs[i]]) return first;
+    }
+    return first | lookahead;
+}
+
+//// LALR(1) automaton
+
+struct Builder {
+    const Grammar& grammar;
+    const FirstSets fs;
+    std::vector<std::vector<uint16_t>> rules_of; // nonterminal -> its productions
+
+    explicit Builder(const Grammar& grammar) : grammar{grammar}, fs{compute_first_sets(grammar)}, rules_of(AUGMENTED_START + 1) {
+        for (size_t i = 0; i < grammar.rules.size(); i++) rules_of[grammar.rules[i].lhs].push_back(i);
+    }
+
+    [[nodiscard]] bool at_end(const Item& item) const { return item.dot == grammar.rules[item.rule].rhs.size(); }
+    [[nodiscard]] uint16_t next_symbol(const Item& item) const { return grammar.rules[item.rule].rhs[item.dot]; }
+
+    // LR(1) closure of a state's kernel under its current lookaheads
+    [[nodiscard]] std::map<Item, SymbolSet> closure(const LRState& state) const {
+        std::map<Item, SymbolSet> items;
+        std::vector<Item> work;
+        for (size_t i = 0; i < state.kernel.size(); i++) {
+            items[state.kernel[i]] = state.lookaheads[i];
+            work.push_back(state.kernel[i]);
+        }
+        while (!work.empty()) {
+            const Item item = work.back();
+            work.pop_back();
+            if (at_end(item) || !grammar.nonterminal[next_symbol(item)]) continue;
+
+            const SymbolSet lookahead = first_of(grammar.rules[item.rule].rhs, item.dot + 1, items[item], fs);
+            for (const uint16_t rule : rules_of[next_symbol(item)]) {
+                const auto [it, inserted] = items.try_emplace(Item{rule, 0});
+                const SymbolSet before = it->second;
+                it->second |= lookahead;
+                if (inserted || it->second != before) work.push_back(it->first);
+            }
+        }
+        return items;
+    }
+
+    // LR(0) states, discovered breadth-first with transitions taken in symbol order
+    [[nodiscard]] std::vector<LRState> build_states() const {
+        std::vector<LRState> states;
+        std::map<std::vector<Item>, uint16_t> index;
+        states.push_back(LRState{{Item{grammar.augmented_rule(), 0}}, {SymbolSet{}}, {}});
+        index[states.front().kernel] = 0;
+
+        for (size_t s = 0; s < states.size(); s++) {
+            std::map<uint16_t, std::vector<Item>> successors;
+            for (const auto& [item, _] : closure(states[s])) {
+                if (!at_end(item)) successors[next_symbol(item)].push_back(Item{item.rule, uint16_t(item.dot + 1)});
+            }
+            for (auto& [sym, kernel] : successors) {
+                std::sort(kernel.begin(), kernel.end());
+                const auto [it, inserted] = index.try_emplace(kernel, states.size());
+                if (inserted) states.push_back(LRState{kernel, std::vector<SymbolSet>(kernel.size()), {}});
+                states[s].transitions[sym] = it->second;
+            }
+        }
+        return states;
+    }
+
+    // Spreads lookaheads along the transitions until nothing changes
+    void propagate_lookaheads(std::vector<LRState>& states) const {
+        states.front().lookaheads.front().set(DOLLAR);
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (LRState& state : states) {
+                for (const auto& [item, lookahead] : closure(state)) {
+                    if (at_end(item)) continue;
+                    LRState& target = states[state.transitions.at(next_symbol(item))];
+                    const Item advanced{item.rule, uint16_t(item.dot + 1)};
+                    const size_t k = std::lower_bound(target.kernel.begin(), target.kernel.end(), advanced) - target.kernel.begin();
+                    const SymbolSet merged = target.lookaheads[k] | lookahead;
+                    if (merged != target.lookaheads[k]) {
+                        target.lookaheads[k] = merged;
+                        changed = true;
+                    }
+                }
+            }
+        }
+    }
+};
+
+ParsingTableEntry make_entry(ParsingTableEntry::Action act, uint16_t n) {
+    ParsingTableEntry pte;
+    pte.act = act;
+    if (act == ParsingTableEntry::Action::REDUCE) pte.production_id = n;
+    else pte.target_state = n;
+    return pte;
+}
+
+std::string describe(const ParsingTableEntry& pte) {
+    switch (pte.act) {
+        case ParsingTableEntry::Action::SHIFT: return "shift " + std::to_string(pte.target_state);
+        case ParsingTableEntry::Action::REDUCE: return "reduce " + std::to_string(pte.production_id);
+        case ParsingTableEntry::Action::ACCEPT: return "accept";
+        default: return "goto " + std::to_string(pte.target_state);
+    }
+}
+
+LALRTable build_lalr_table(const Grammar& grammar) {
+    const Builder builder{grammar};
+    LALRTable table{builder.build_states(), {}};
+    builder.propagate_lookaheads(table.states);
+
+    std::string conflicts;
+    table.rows.resize(table.states.size());
+    for (size_t s = 0; s < table.states.size(); s++) {
+        TableRow& row = table.rows[s];
+        for (const auto& [sym, target] : table.states[s].transitions) {
+            row[sym] = make_entry(grammar.nonterminal[sym] ? ParsingTableEntry::Action::GOTO : ParsingTableEntry::Action::SHIFT, target);
+        }
+        for (const auto& [item, lookahead] : builder.closure(table.states[s])) {
+            if (!builder.at_end(item)) continue;
+            for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+                if (!lookahead[sym]) continue;
+                const ParsingTableEntry entry = item.rule == grammar.augmented_rule()
+                    ? make_entry(ParsingTableEntry::Action::ACCEPT, 0)
+                    : make_entry(ParsingTableEntry::Action::REDUCE, item.rule);
+                if (row[sym].act != ParsingTableEntry::Action::NIL) {
+                    conflicts += "  state " + std::to_string(s) + " on " + std::string{PARSER_SYMBOL_NAMES[sym]} +
+                                 ": " + describe(row[sym]) + " vs " + describe(entry) + '\n';
+                    continue;
+                }
+                row[sym] = entry;
+            }
+        }
+    }
+    if (!conflicts.empty()) throw std::runtime_error{"ERROR: grammar is not LALR(1):\n" + conflicts};
+    return table;
+}
+
+//// Unit-rule elimination
+
+struct UnitEliminator {
+    const Grammar& grammar;
+    const std::vector<TableRow>& rows; // the LALR table; every entry below names its states
+    std::vector<TableRow> states;      // the new states, as rows still naming LALR states
+    std::map<std::vector<uint32_t>, uint16_t> index; // keyed by the rows' entries, each packed as act << 16 | operand
+
+    [[nodiscard]] bool passes_through(const ParsingTableEntry& pte) const {
+        return pte.act == ParsingTableEntry::Action::REDUCE && grammar.rules[pte.production_id].pass_through;
+    }
+
+    uint16_t add(const TableRow& row) {
+        std::vector<uint32_t> key;
+        for (const ParsingTableEntry& pte : row) key.push_back(uint32_t(pte.act) << 16 | pte.target_state);
+        const auto [it, inserted] = index.try_emplace(std::move(key), states.size());
+        if (inserted) states.push_back(row);
+        return it->second;
+    }
+
+    // The state entered by the GOTO on nonterminal from under: on each lookahead it acts as the LALR state that the
+    // pass-through reductions from GOTO[under][nonterminal] end in, and it takes the GOTOs of all those states
+    [[nodiscard]] TableRow merge(const TableRow& under, uint16_t nonterminal) const {
+        TableRow merged;
+        std::vector<uint16_t> ends;
+        for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+            if (grammar.nonterminal[sym]) continue;
+            uint16_t state = under[nonterminal].target_state;
+            while (passes_through(rows[state][sym])) {
+                state = under[grammar.rules[rows[state][sym].production_id].lhs].target_state;
+            }
+            merged[sym] = rows[state][sym];
+            if (merged[sym].act != ParsingTableEntry::Action::NIL) ends.push_back(state);
+        }
+        for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+            if (!grammar.nonterminal[sym]) continue;
+            for (const uint16_t state : ends) {
+                const ParsingTableEntry& pte = rows[state][sym];
+                if (pte.act != ParsingTableEntry::Action::GOTO) continue;
+                if (merged[sym].act == ParsingTableEntry::Action::GOTO && merged[sym].target_state != pte.target_state) {
+                    throw std::runtime_error{"ERROR: cannot eliminate the pass-through rules: the states they chain through"
+                                             " disagree on the GOTO on " + std::string{PARSER_SYMBOL_NAMES[sym]}};
+                }
+                merged[sym] = pte;
+            }
+        }
+        return merged;
+    }
+};
+
+void eliminate_unit_reductions(const Grammar& grammar, LALRTable& table) {
+    UnitEliminator elim{grammar, table.rows, {}, {}};
+    elim.add(table.rows.front());
+
+    // Breadth-first over the new states, pointing each SHIFT and GOTO at the new state it enters (under is a copy:
+    // add() may grow states)
+    std::vector<TableRow> rows;
+    for (size_t s = 0; s < elim.states.size(); s++) {
+        const TableRow under = elim.states[s];
+        TableRow row = under;
+        for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+            ParsingTableEntry& pte = row[sym];
+            if (pte.act == ParsingTableEntry::Action::SHIFT) pte.target_state = elim.add(table.rows[pte.target_state]);
+            else if (pte.act == ParsingTableEntry::Action::GOTO) pte.target_state = elim.add(elim.merge(under, sym));
+        }
+        rows.push_back(row);
+    }
+    table.states.clear();
+    table.rows = std::move(rows);
+}
@@ -0,0 +1,70 @@
+#ifndef XERLANG_LALR_H
+#define XERLANG_LALR_H
+
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <vector>
+#include "parser/table_entry.h"
+#include "util/types.h"
+
+// Grammar symbols are ParserSymbols; the augmented start symbol S' gets the one id past them
+#define AUGMENTED_START uint16_t{Parser::ParserSymbol::NUM_SYMBOLS}
+
+using SymbolSet = std::bitset<Parser::ParserSymbol::NUM_SYMBOLS>;
+
+struct Rule {
+    uint16_t lhs;
+    std::vector<uint16_t> rhs;
+    bool pass_through = false; // written "lhs => nonterminal .": the parser hands the child's value up unchanged
+};
+
+// Productions in the order of xer/grammar (so their index is the production id), then the augmented S' -> start
+struct Grammar {
+    std::vector<Rule> rules;
+    SymbolSet nonterminal;
+
+    [[nodiscard]] size_t num_productions() const { return rules.size() - 1; }
+    [[nodiscard]] uint16_t augmented_rule() const { return rules.size() - 1; }
+};
+
+// Reads "lhs -> sym sym ... ." lines (blank lines ignored); the first LHS is the start symbol. A unit rule written
+// "lhs => nonterminal ." is pass-through, so the parser never reduces it (see eliminate_unit_reductions).
+// Throws std::runtime_error naming the line on a malformed rule or a symbol that is not a ParserSymbol.
+Grammar read_grammar(std::istream& is);
+
+struct Item {
+    uint16_t rule;
+    uint16_t dot;
+
+    auto operator<=>(const Item&) const = default;
+};
+
+struct LRState {
+    std::vector<Item> kernel;                 // sorted
+    std::vector<SymbolSet> lookaheads;        // one set per kernel item
+    std::map<uint16_t, uint16_t> transitions; // grammar symbol -> state
+};
+
+using TableRow = std::array<ParsingTableEntry, Parser::ParserSymbol::NUM_SYMBOLS>;
+
+struct LALRTable {
+    std::vector<LRState> states; // state 0 is the start state, the rest in breadth-first discovery order
+    std::vector<TableRow> rows;  // one per state, until eliminate_unit_reductions() replaces the states
+};
+
+// Builds the LALR(1) automaton (LR(0) states with lookaheads propagated to a fixpoint) and its dense table.
+// Throws std::runtime_error listing every shift/reduce and reduce/reduce conflict.
+LALRTable build_lalr_table(const Grammar& grammar);
+
+// Rewrites the table so the parser never reduces a pass-through rule. A GOTO on A from state X leads instead to a
+// state that acts, on each lookahead, as the state the chain of pass-through reductions A => B => ... would end in
+// under X, so a primary expression lands straight on the rung of the expr1..expr14 ladder its lookahead needs.
+// States unreachable afterwards are dropped and the rest renumbered in breadth-first order; states is cleared, as
+// the new states are no longer LR(0) item sets. Throws std::runtime_error if two states of one chain disagree on a
+// GOTO, which the merged state could then not take.
+void eliminate_unit_reductions(const Grammar& grammar, LALRTable& table);
+
+#endif //XERLANG_LALR_H
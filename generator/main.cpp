@@ -0,0 +1,57 @@
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "emit.h"
+#include "lalr.h"
+#include "profile.h"
+
+// XerlangParserGen [--profile <source>]... <grammar> <parser_constants.h> [<parser_direct.inc> [<parser_dense.h>]]
+// Builds the LALR(1) table for the grammar, without its pass-through unit reductions, and writes the parser's
+// constants header and, if asked for, the directly-coded driver and the dense table. The states and the compressed
+// table's columns are ordered by how often parsing the --profile sources uses them.
+int main(int argc, char* argv[]) {
+    std::vector<std::string> sources;
+    std::vector<const char*> paths;
+    for (int i = 1; i < argc; i++) {
+        if (std::string_view{argv[i]} == "--profile" && i + 1 < argc) sources.push_back(argv[++i]);
+        else paths.push_back(argv[i]);
+    }
+    if (paths.size() < 2 || paths.size() > 4) {
+        std::cerr << "usage: " << argv[0] << " [--profile <source>]... <grammar> <parser_constants.h> "
+                  << "[<parser_direct.inc> [<parser_dense.h>]]" << std::endl;
+        return 2;
+    }
+
+    std::ifstream grammar_file{paths[0]};
+    if (!grammar_file) {
+        std::cerr << "ERROR: cannot open grammar " << paths[0] << std::endl;
+        return 1;
+    }
+
+    std::ostringstream outputs[3]; // one per output file, in command-line order
+    try {
+        const Grammar grammar = read_grammar(grammar_file);
+        LALRTable table = build_lalr_table(grammar);
+        eliminate_unit_reductions(grammar, table);
+        const Profile profile = profile_table(grammar, table, sources);
+        renumber_states(profile, table);
+        emit_parser_constants(grammar, table, profile, outputs[0]);
+        if (paths.size() >= 3) emit_direct_parser(grammar, table, outputs[1]);
+        if (paths.size() == 4) emit_dense_table(table, outputs[2]);
+    } catch (std::exception& e) {
+        std::cerr << paths[0] << ": " << e.what() << std::endl;
+        return 1;
+    }
+
+    for (size_t i = 1; i < paths.size(); i++) {
+        std::ofstream file{paths[i], std::ios::binary};
+        file << outputs[i - 1].str();
+        if (!file.flush()) {
+            std::cerr << "ERROR: cannot write " << paths[i] << std::endl;
+            return 1;
+        }
+    }
+}
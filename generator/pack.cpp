@@ -0,0 +1,158 @@
+#include "pack.h"
+#include <algorithm>
+#include <map>
+#include <stdexcept>
+
+using namespace Parser;
+
+// The entries of one table row or GOTO column that have to be stored explicitly, in index order
+struct SparseLine {
+    std::vector<uint16_t> index;
+    std::vector<uint16_t> value;
+};
+
+// First-fit row displacement: the smallest base at which none of line's entries hit an occupied slot. check grows
+// as needed, filled with empty.
+template <class T>
+size_t find_base(const SparseLine& line, std::vector<T>& check, T empty) {
+    for (size_t base = 0;; base++) {
+        if (check.size() < base + line.index.back() + 1) check.resize(base + line.index.back() + 1, empty);
+        size_t i = 0;
+        while (i < line.index.size() && check[base + line.index[i]] == empty) i++;
+        if (i == line.index.size()) return base;
+    }
+}
+
+uint16_t default_reduction(const TableRow& row) {
+    std::map<uint16_t, size_t> uses;
+    for (const ParsingTableEntry& pte : row) {
+        if (pte.act == ParsingTableEntry::Action::REDUCE) uses[pte.production_id]++;
+    }
+    uint16_t most_used = ACTION_ERROR;
+    size_t most = 0;
+    for (const auto& [production, count] : uses) {
+        if (count > most) {
+            most = count;
+            most_used = REDUCE_BIT | production;
+        }
+    }
+    return most_used;
+}
+
+// Symbols of one kind, most used first (ties in symbol order)
+std::vector<uint16_t> by_use(const Grammar& grammar, const Profile& profile, bool nonterminals) {
+    std::vector<uint16_t> symbols;
+    for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+        if (grammar.nonterminal[sym] == nonterminals) symbols.push_back(sym);
+    }
+    std::stable_sort(symbols.begin(), symbols.end(), [&](uint16_t a, uint16_t b) {
+        return profile.symbol_uses[a] > profile.symbol_uses[b];
+    });
+    return symbols;
+}
+
+void pack_actions(const Grammar& grammar, const LALRTable& table, const Profile& profile, PackedTable& packed) {
+    const size_t num_states = table.rows.size();
+    // Nonterminals never index ACTION; they keep column 0
+    packed.action_column.assign(NUM_SYMBOLS, 0);
+    const std::vector<uint16_t> terminals = by_use(grammar, profile, false);
+    for (size_t column = 0; column < terminals.size(); column++) packed.action_column[terminals[column]] = column;
+
+    std::vector<SparseLine> rows(num_states);
+    std::vector<uint16_t> order(num_states);
+    for (size_t s = 0; s < num_states; s++) {
+        order[s] = s;
+        packed.default_action.push_back(default_reduction(table.rows[s]));
+        for (const uint16_t sym : terminals) {
+            const uint16_t entry = pack_action(table.rows[s][sym]);
+            if (entry == ACTION_ERROR || entry == packed.default_action[s]) continue;
+            rows[s].index.push_back(packed.action_column[sym]);
+            rows[s].value.push_back(entry);
+        }
+    }
+
+    // Densest rows first: they are the hardest to place once the array fills up
+    std::stable_sort(order.begin(), order.end(), [&](uint16_t a, uint16_t b) {
+        return rows[a].index.size() > rows[b].index.size();
+    });
+    packed.action_base.assign(num_states, 0);
+    for (const uint16_t s : order) {
+        if (rows[s].index.empty()) continue; // base 0: nothing of this state's can match the check
+        const size_t base = find_base(rows[s], packed.action_check, EMPTY_ACTION_CHECK);
+        packed.action_base[s] = base;
+        packed.action.resize(packed.action_check.size(), ACTION_ERROR);
+        for (size_t i = 0; i < rows[s].index.size(); i++) {
+            packed.action[base + rows[s].index[i]] = rows[s].value[i];
+            packed.action_check[base + rows[s].index[i]] = s;
+        }
+    }
+    // Any base + column must stay in bounds, including for the rows that stored nothing
+    const size_t slots = *std::max_element(packed.action_base.begin(), packed.action_base.end()) + terminals.size();
+    packed.action.resize(slots, ACTION_ERROR);
+    packed.action_check.resize(slots, EMPTY_ACTION_CHECK);
+}
+
+void pack_gotos(const Grammar& grammar, const LALRTable& table, const Profile& profile, PackedTable& packed) {
+    const size_t num_states = table.rows.size();
+    packed.goto_default.assign(NUM_SYMBOLS, 0);
+    packed.goto_base.assign(NUM_SYMBOLS, 0);
+    for (const uint16_t sym : by_use(grammar, profile, true)) {
+        std::vector<size_t> uses(num_states);
+        for (const TableRow& row : table.rows) {
+            if (row[sym].act == ParsingTableEntry::Action::GOTO) uses[row[sym].target_state]++;
+        }
+        const auto most = std::max_element(uses.begin(), uses.end());
+        if (*most == 0) continue;
+        packed.goto_default[sym] = most - uses.begin();
+
+        SparseLine column;
+        for (size_t s = 0; s < num_states; s++) {
+            const ParsingTableEntry& pte = table.rows[s][sym];
+            if (pte.act != ParsingTableEntry::Action::GOTO || pte.target_state == packed.goto_default[sym]) continue;
+            column.index.push_back(s);
+            column.value.push_back(pte.target_state);
+        }
+        if (column.index.empty()) continue;
+        const size_t base = find_base(column, packed.goto_check, EMPTY_GOTO_CHECK);
+        packed.goto_base[sym] = base;
+        packed.goto_target.resize(packed.goto_check.size(), 0);
+        for (size_t i = 0; i < column.index.size(); i++) {
+            packed.goto_target[base + column.index[i]] = column.value[i];
+            packed.goto_check[base + column.index[i]] = sym;
+        }
+    }
+    const size_t slots = *std::max_element(packed.goto_base.begin(), packed.goto_base.end()) + num_states;
+    packed.goto_target.resize(slots, 0);
+    packed.goto_check.resize(slots, EMPTY_GOTO_CHECK);
+}
+
+// Every ACTION entry the dense table defines comes back unchanged, and every GOTO entry it defines is reproduced,
+// by the lookups of parser/parse_table.h
+bool packing_matches(const LALRTable& table, const PackedTable& packed) {
+    for (size_t s = 0; s < table.rows.size(); s++) {
+        for (size_t sym = 0; sym < NUM_SYMBOLS; sym++) {
+            const ParsingTableEntry& pte = table.rows[s][sym];
+            if (pte.act == ParsingTableEntry::Action::GOTO) {
+                const size_t i = packed.goto_base[sym] + s;
+                const uint16_t target = packed.goto_check[i] == sym ? packed.goto_target[i] : packed.goto_default[sym];
+                if (target != pte.target_state) return false;
+            }
+            else if (pack_action(pte) != ACTION_ERROR) {
+                const size_t i = packed.action_base[s] + packed.action_column[sym];
+                const uint16_t entry = packed.action_check[i] == s ? packed.action[i] : packed.default_action[s];
+                if (entry != pack_action(pte)) return false;
+            }
+        }
+    }
+    return true;
+}
+
+PackedTable pack_table(const Grammar& grammar, const LALRTable& table, const Profile& profile) {
+    if (table.rows.size() >= REDUCE_BIT - 1) throw std::runtime_error{"ERROR: parser states no longer fit the packed ACTION entries"};
+    if (NUM_SYMBOLS >= EMPTY_GOTO_CHECK) throw std::runtime_error{"ERROR: parser symbols no longer fit the 8-bit GOTO checks"};
+    PackedTable packed;
+    pack_actions(grammar, table, profile, packed);
+    pack_gotos(grammar, table, profile, packed);
+    if (!packing_matches(table, packed)) throw std::runtime_error{"ERROR: compressed parse table disagrees with the dense one"};
+    return packed;
+}
@@ -0,0 +1,30 @@
+#ifndef XERLANG_PACK_H
+#define XERLANG_PACK_H
+
+#include <cstdint>
+#include <vector>
+#include "lalr.h"
+#include "profile.h"
+
+// The arrays of the compressed parse table (CompressedParseTable in parser/table_entry.h; parser/parse_table.h
+// describes the layout)
+struct PackedTable {
+    std::vector<uint8_t> action_column;
+    std::vector<uint16_t> default_action;
+    std::vector<uint16_t> action_base;
+    std::vector<uint16_t> action;
+    std::vector<uint16_t> action_check;
+    std::vector<uint16_t> goto_default;
+    std::vector<uint16_t> goto_base;
+    std::vector<uint16_t> goto_target;
+    std::vector<uint8_t> goto_check;
+};
+
+// Compresses the dense table: default reductions, then first-fit row displacement of the ACTION rows (densest
+// first) and of the GOTO columns. The terminals are given ACTION columns and the GOTO columns are placed in order of
+// decreasing use in profile, so a state's hot entries share a cache line and the hot GOTO columns sit together.
+// Throws std::runtime_error if states or symbols outgrow the packed entries, or if the packed table would not
+// reproduce the dense one.
+PackedTable pack_table(const Grammar& grammar, const LALRTable& table, const Profile& profile);
+
+#endif //XERLANG_PACK_H
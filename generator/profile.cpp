@@ -0,0 +1,75 @@
+#include "profile.h"
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include "scanner/scanner.h"
+#include "util/interner.h"
+#include "util/source.h"
+
+using namespace Parser;
+
+// Runs the automaton over tokens like the parser's table driver, without semantic values; false on a syntax error
+bool profile_parse(const Grammar& grammar, const LALRTable& table, const std::vector<Token>& tokens, Profile& profile) {
+    std::vector<uint16_t> states = {0};
+    for (size_t next = 0;;) {
+        const ParsingTableEntry& pte = table.rows[states.back()][tokens[next].type];
+        profile.state_uses[states.back()]++;
+        profile.symbol_uses[tokens[next].type]++;
+        switch (pte.act) {
+            case ParsingTableEntry::Action::SHIFT:
+                states.push_back(pte.target_state);
+                next++;
+                break;
+            case ParsingTableEntry::Action::REDUCE: {
+                const Rule& rule = grammar.rules[pte.production_id];
+                states.resize(states.size() - rule.rhs.size());
+                profile.symbol_uses[rule.lhs]++;
+                states.push_back(table.rows[states.back()][rule.lhs].target_state);
+                break;
+            }
+            case ParsingTableEntry::Action::ACCEPT:
+                return true;
+            default:
+                return false;
+        }
+    }
+}
+
+Profile profile_table(const Grammar& grammar, const LALRTable& table, const std::vector<std::string>& sources) {
+    Profile profile;
+    profile.state_uses.resize(table.rows.size());
+    for (const std::string& path : sources) {
+        const SourceBuffer source{path};
+        Interner symbols;
+        std::ostringstream err;
+        std::vector<Token> tokens = {{BoF}};
+        if (!scan_tokens(source, symbols, tokens, err)) throw std::runtime_error{"ERROR: cannot scan " + path + ":\n" + err.str()};
+        const auto eof = static_cast<uint32_t>(source.text().size());
+        tokens.push_back({EoF, eof});
+        tokens.push_back({DOLLAR, eof});
+        if (!profile_parse(grammar, table, tokens, profile)) throw std::runtime_error{"ERROR: cannot parse " + path};
+    }
+    return profile;
+}
+
+void renumber_states(const Profile& profile, LALRTable& table) {
+    std::vector<uint16_t> order(table.rows.size());
+    for (size_t s = 0; s < order.size(); s++) order[s] = s;
+    std::stable_sort(order.begin() + 1, order.end(), [&](uint16_t a, uint16_t b) {
+        return profile.state_uses[a] > profile.state_uses[b];
+    });
+
+    std::vector<uint16_t> number(order.size());
+    for (size_t s = 0; s < order.size(); s++) number[order[s]] = s;
+    std::vector<TableRow> rows;
+    for (const uint16_t s : order) {
+        TableRow row = table.rows[s];
+        for (ParsingTableEntry& pte : row) {
+            if (pte.act == ParsingTableEntry::Action::SHIFT || pte.act == ParsingTableEntry::Action::GOTO) {
+                pte.target_state = number[pte.target_state];
+            }
+        }
+        rows.push_back(row);
+    }
+    table.rows = std::move(rows);
+}
@@ -0,0 +1,25 @@
+#ifndef XERLANG_PROFILE_H
+#define XERLANG_PROFILE_H
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "lalr.h"
+
+// How often parsing some sample programs consults each state and symbol of a table
+struct Profile {
+    std::vector<size_t> state_uses; // ACTION lookups in each state
+    // ACTION lookups on each terminal, GOTO lookups on each nonterminal
+    std::array<size_t, Parser::ParserSymbol::NUM_SYMBOLS> symbol_uses{};
+};
+
+// Scans each source file and runs table's automaton over its tokens, counting the lookups. No sources leave every
+// count 0. Throws std::runtime_error if a source cannot be read, scanned or parsed.
+Profile profile_table(const Grammar& grammar, const LALRTable& table, const std::vector<std::string>& sources);
+
+// Renumbers the states in order of decreasing use (ties in the old order), so the hot states' entries in the
+// per-state arrays share cache lines. The start state stays 0.
+void renumber_states(const Profile& profile, LALRTable& table);
+
+#endif //XERLANG_PROFILE_H
@@ -0,0 +1,262 @@
+#include "ir.h"
+#include <algorithm>
+#include <utility>
+
+const char* const IR_OP_NAMES[NUM_IR_OPS] = {
+    "const", "param", "global", "alloca", "load", "store", "copy", "zero", "field", "offset", "ptrdiff", "convert",
+    "add", "sub", "mul", "div", "mod", "pow", "shl", "shr", "and", "or", "xor", "neg", "not",
+    "eq", "ne", "lt", "le", "gt", "ge",
+    "call", "read", "new", "delete", "print", "phi",
+    "jmp", "br", "ret",
+};
+
+ValueId IRFunction::add(BlockId b, IRInstr instr) {
+    const ValueId id = make(b, std::move(instr));
+    blocks[b].instrs.push_back(id);
+    return id;
+}
+
+ValueId IRFunction::make(BlockId b, IRInstr instr) {
+    instr.block = b;
+    values.push_back(std::move(instr));
+    return static_cast<ValueId>(values.size() - 1);
+}
+
+const std::vector<BlockId>& successors(const IRFunction& f, BlockId b) {
+    return f.values[f.blocks[b].instrs.back()].targets;
+}
+
+void link_blocks(IRFunction& f) {
+    for (IRBlock& block : f.blocks) block.preds.clear();
+    for (BlockId b = 0; b < f.blocks.size(); b++) {
+        for (BlockId s : successors(f, b)) f.blocks[s].preds.push_back(b);
+    }
+}
+
+std::vector<BlockId> reverse_postorder(const IRFunction& f) {
+    std::vector<BlockId> order;
+    std::vector<bool> seen(f.blocks.size(), false);
+    std::vector<std::pair<BlockId, uint32_t>> stack = {{0, 0}}; // a block, and how many of its successors are done
+    seen[0] = true;
+    while (!stack.empty()) {
+        auto& [b, next] = stack.back();
+        const std::vector<BlockId>& succs = successors(f, b);
+        if (next == succs.size()) {
+            order.push_back(b);
+            stack.pop_back();
+            continue;
+        }
+        const BlockId s = succs[next++];
+        if (!seen[s]) {
+            seen[s] = true;
+            stack.push_back({s, 0});
+        }
+    }
+    std::ranges::reverse(order);
+    return order;
+}
+
+void remove_unreachable_blocks(IRFunction& f) {
+    const std::vector<BlockId> order = reverse_postorder(f);
+    std::vector<BlockId> renumbered(f.blocks.size(), NO_BLOCK);
+    for (BlockId b = 0; b < order.size(); b++) renumbered[order[b]] = b;
+    for (BlockId b = 0; b < f.blocks.size(); b++) {
+        if (renumbered[b] != NO_BLOCK) continue;
+        for (ValueId v : f.blocks[b].instrs) f.values[v].block = NO_BLOCK;
+    }
+    std::vector<IRBlock> blocks(order.size());
+    for (BlockId b = 0; b < order.size(); b++) blocks[b] = std::move(f.blocks[order[b]]);
+    f.blocks = std::move(blocks);
+
+    for (BlockId b = 0; b < f.blocks.size(); b++) {
+        for (ValueId v : f.blocks[b].instrs) {
+            IRInstr& instr = f.values[v];
+            instr.block = b;
+            if (instr.op == IR_PHI) {
+                // drop the operands from deleted blocks
+                size_t out = 0;
+                for (size_t i = 0; i < instr.targets.size(); i++) {
+                    if (renumbered[instr.targets[i]] == NO_BLOCK) continue;
+                    instr.args[out] = instr.args[i];
+                    instr.targets[out++] = renumbered[instr.targets[i]];
+                }
+                instr.args.resize(out);
+                instr.targets.resize(out);
+            }
+            else {
+                for (BlockId& target : instr.targets) target = renumbered[target];
+            }
+        }
+    }
+    link_blocks(f);
+}
+
+std::vector<BlockId> immediate_dominators(const IRFunction& f) {
+    const std::vector<BlockId> order = reverse_postorder(f);
+    std::vector<uint32_t> rank(f.blocks.size(), 0);
+    for (uint32_t i = 0; i < order.size(); i++) rank[order[i]] = i;
+
+    std::vector<BlockId> idom(f.blocks.size(), NO_BLOCK);
+    idom[0] = 0;
+    // The closest common dominator of a and b: walk up the tree from whichever comes later in the order
+    const auto intersect = [&](BlockId a, BlockId b) {
+        while (a != b) {
+            while (rank[a] > rank[b]) a = idom[a];
+            while (rank[b] > rank[a]) b = idom[b];
+        }
+        return a;
+    };
+    for (bool changed = true; changed;) {
+        changed = false;
+        for (size_t i = 1; i < order.size(); i++) {
+            const BlockId b = order[i];
+            BlockId dom = NO_BLOCK;
+            for (BlockId p : f.blocks[b].preds) {
+                if (idom[p] == NO_BLOCK) continue;
+                dom = dom == NO_BLOCK ? p : intersect(p, dom);
+            }
+            if (idom[b] != dom) {
+                idom[b] = dom;
+                changed = true;
+            }
+        }
+    }
+    return idom;
+}
+
+//// Printing
+
+struct IRPrinter {
+    const IRProgram& program;
+    const TypeTable& types;
+    const Interner& symbols;
+    OutputBuffer& out;
+
+    void type(TypeId t) { out << symbols.name(types.spelling(t)); }
+
+    void value(ValueId v) {
+        out << '%';
+        out.number(v);
+    }
+
+    void block(BlockId b) {
+        out << 'b';
+        out.number(b);
+    }
+
+    // The instruction's operands, comma separated
+    void operands(const IRInstr& instr) {
+        for (size_t i = 0; i < instr.args.size(); i++) {
+            if (i) out << ", ";
+            value(instr.args[i]);
+        }
+    }
+
+    void instruction(const IRFunction& f, ValueId v) {
+        const IRInstr& instr = f.values[v];
+        out << "    ";
+        if (instr.type != TYPE_VOID) {
+            value(v);
+            out << " = ";
+        }
+        out << IR_OP_NAMES[instr.op];
+        if (instr.type != TYPE_VOID) {
+            out << ' ';
+            type(instr.type);
+        }
+        switch (instr.op) {
+            case IR_CONST:
+            case IR_PARAM:
+                out << ' ';
+                out.number(instr.imm);
+                break;
+            case IR_GLOBAL:
+                out << " @" << symbols.name(static_cast<Symbol>(instr.imm));
+                break;
+            case IR_NEW:
+                out << ' ';
+                out.number(instr.imm);
+                break;
+            case IR_COPY:
+            case IR_ZERO:
+            case IR_FIELD:
+            case IR_OFFSET:
+            case IR_PTRDIFF:
+                out << ' ';
+                operands(instr);
+                out << ", ";
+                out.number(instr.imm);
+                break;
+            case IR_CALL:
+                out << " @" << symbols.name(program.procedures[instr.imm].name) << '(';
+                operands(instr);
+                out << ')';
+                break;
+            case IR_PHI:
+                for (size_t i = 0; i < instr.args.size(); i++) {
+                    out << (i ? ", [" : " [");
+                    value(instr.args[i]);
+                    out << ", ";
+                    block(instr.targets[i]);
+                    out << ']';
+                }
+                break;
+            case IR_JUMP:
+                out << ' ';
+                block(instr.targets[0]);
+                break;
+            case IR_BRANCH:
+                out << ' ';
+                operands(instr);
+                out << ", ";
+                block(instr.targets[0]);
+                out << ", ";
+                block(instr.targets[1]);
+                break;
+            default:
+                if (!instr.args.empty()) out << ' ';
+                operands(instr);
+        }
+        out << '\n';
+    }
+
+    void function(const IRFunction& f) {
+        for (BlockId b = 0; b < f.blocks.size(); b++) {
+            block(b);
+            out << ':';
+            if (!f.blocks[b].preds.empty()) {
+                out << "  # preds ";
+                for (size_t i = 0; i < f.blocks[b].preds.size(); i++) {
+                    if (i) out << ", ";
+                    block(f.blocks[b].preds[i]);
+                }
+            }
+            out << '\n';
+            for (ValueId v : f.blocks[b].instrs) instruction(f, v);
+        }
+        out << "}\n";
+    }
+};
+
+void print_ir(const IRProgram& program, const TypeTable& types, const Interner& symbols, OutputBuffer& out) {
+    IRPrinter printer{program, types, symbols, out};
+    for (const IRGlobal& global : program.globals) {
+        out << "global @" << symbols.name(global.name) << " : ";
+        printer.type(global.type);
+        out << '\n';
+    }
+    if (!program.globals.empty()) out << '\n';
+    out << "init {\n";
+    printer.function(program.init);
+    for (const IRFunction& f : program.procedures) {
+        out << "\nproc @" << symbols.name(f.name) << '(';
+        for (size_t i = 0; i < f.params.size(); i++) {
+            if (i) out << ", ";
+            printer.type(f.params[i]);
+        }
+        out << ") -> ";
+        printer.type(f.return_type);
+        out << " {\n";
+        printer.function(f);
+    }
+}
@@ -0,0 +1,121 @@
+#ifndef XERLANG_IR_H
+#define XERLANG_IR_H
+
+#include <cstdint>
+#include <vector>
+#include "../util/interner.h"
+#include "../util/output.h"
+#include "../util/type_table.h"
+
+// Index of an instruction in its IRFunction, and so of the value it defines, written %n
+using ValueId = uint32_t;
+// Index of a basic block in its IRFunction, written bn; b0 is the entry
+using BlockId = uint32_t;
+
+#define NO_BLOCK BlockId{0xFFFFFFFF}
+
+// The intermediate representation: typed, in SSA form, and made of basic blocks. Every instruction defines at most
+// one value, typed with a TypeTable type, and values are only ever defined once: a variable that changes either lives
+// in memory (an ALLOCA, read and written with LOAD and STORE) or, after promote_locals, is a PHI wherever control
+// flow merges. Structs are never values: a struct is handled by its address, and copied with COPY.
+// Each block starts with its PHIs and ends with exactly one terminator (JUMP, BRANCH or RETURN).
+enum IROp : uint8_t {
+    IR_CONST,   // imm, of the value's type (an integral, a pointer, or NULL's type)
+    IR_PARAM,   // the imm'th parameter
+    IR_GLOBAL,  // the address of the global named imm (a Symbol)
+    IR_ALLOCA,  // the address of a stack slot for a pointee of the value's type; in the entry block only
+    IR_LOAD,    // the value at address args[0]
+    IR_STORE,   // stores args[0] at address args[1]
+    IR_COPY,    // copies imm bytes from address args[1] to address args[0]
+    IR_ZERO,    // clears imm bytes at address args[0]
+    IR_FIELD,   // address args[0] plus imm bytes: where a field is
+    IR_OFFSET,  // pointer args[0] plus imm bytes times int args[1]
+    IR_PTRDIFF, // the distance between pointers args[0] and args[1], in units of imm bytes
+    // args[0] as another type: between integrals (to bool meaning != 0), from a pointer or NULL to bool, from NULL to
+    // a pointer, and from an int to int@ (for dereferencing an int)
+    IR_CONVERT,
+    // int arithmetic on args[0] and args[1]
+    IR_ADD, IR_SUB, IR_MUL, IR_DIV, IR_MOD, IR_POW, IR_SHL, IR_SHR, IR_AND, IR_OR, IR_XOR,
+    // int arithmetic on args[0]
+    IR_NEG, IR_NOT,
+    // comparisons of args[0] and args[1], two values of one type, yielding a bool; pointers compare unsigned
+    IR_EQ, IR_NE, IR_LT, IR_LE, IR_GT, IR_GE,
+    IR_CALL,    // the imm'th procedure of the program, with args; its result, if it has one
+    IR_READ,    // the next char of standard input
+    IR_NEW,     // the address of imm fresh zeroed bytes
+    IR_DELETE,  // frees what args[0] points to
+    IR_PRINT,   // prints args on a line
+    IR_PHI,     // args[i] if control came from the block targets[i]
+    // Terminators
+    IR_JUMP,    // to targets[0]
+    IR_BRANCH,  // to targets[0] if the bool args[0] holds, else to targets[1]
+    IR_RETURN,  // args[0], if the procedure returns a value
+    NUM_IR_OPS,
+};
+
+extern const char* const IR_OP_NAMES[NUM_IR_OPS];
+
+[[nodiscard]] inline bool is_terminator(IROp op) { return op >= IR_JUMP; }
+
+struct IRInstr {
+    IROp op;
+    TypeId type = TYPE_VOID;  // of the value defined; TYPE_VOID if none
+    int64_t imm = 0;
+    std::vector<ValueId> args{};
+    std::vector<BlockId> targets{}; // JUMP, BRANCH and PHI
+    BlockId block = NO_BLOCK;       // holding it; NO_BLOCK once a pass has deleted it
+};
+
+struct IRBlock {
+    std::vector<ValueId> instrs;
+    std::vector<BlockId> preds; // the blocks that end by going here, once per edge; kept by link_blocks
+};
+
+struct IRFunction {
+    Symbol name = 0;                 // none for the program's initializer
+    // A struct parameter is passed as the address of a copy the callee may change, and a struct result is copied to
+    // the address in an extra, last, parameter; such a procedure returns nothing
+    std::vector<TypeId> params;
+    TypeId return_type = TYPE_VOID;
+    std::vector<IRInstr> values;     // every instruction ever made, deleted ones included, by ValueId
+    std::vector<IRBlock> blocks;
+
+    // Appends instr to the end of block b
+    ValueId add(BlockId b, IRInstr instr);
+    // Makes instr, to be placed in b by the caller
+    ValueId make(BlockId b, IRInstr instr);
+};
+
+struct IRGlobal {
+    Symbol name;
+    TypeId type;
+};
+
+struct IRProgram {
+    std::vector<IRGlobal> globals;
+    IRFunction init;                     // runs the globals' initializers, in declaration order, before main
+    std::vector<IRFunction> procedures;  // main last
+};
+
+// The blocks a block's terminator goes to
+[[nodiscard]] const std::vector<BlockId>& successors(const IRFunction& f, BlockId b);
+
+// Sets every block's preds from the terminators
+void link_blocks(IRFunction& f);
+
+// Deletes the blocks control never reaches from the entry (with their instructions, and the PHI operands that came
+// from them), renumbers the rest in reverse postorder, so that a block mostly comes after its predecessors, and relinks
+// them
+void remove_unreachable_blocks(IRFunction& f);
+
+// The reachable blocks, each after all of its predecessors except along back edges
+[[nodiscard]] std::vector<BlockId> reverse_postorder(const IRFunction& f);
+
+// Per block: the closest block other than itself that every path from the entry to it goes through (the entry's is the
+// entry itself), or NO_BLOCK if it is unreachable. The iterative algorithm of Cooper, Harvey and Kennedy.
+[[nodiscard]] std::vector<BlockId> immediate_dominators(const IRFunction& f);
+
+// The text form: the globals, the initializer, then each procedure, block by block and one instruction per line
+void print_ir(const IRProgram& program, const TypeTable& types, const Interner& symbols, OutputBuffer& out);
+
+#endif // XERLANG_IR_H
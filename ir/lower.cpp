@@ -0,0 +1,396 @@
+#include "lower.h"
+#include <utility>
+
+struct Lowering : public StaticVisitor<Lowering> {
+    TypeTable& types;
+    IRProgram& ir;
+    const ProcedureNode* procedure = nullptr; // the one being lowered; none for the initializer
+    IRFunction* f = nullptr;
+    BlockId current = 0;                       // where instructions go
+    size_t prologue_end = 0;                   // in the entry block: where the next temporary's ALLOCA goes
+    std::vector<ValueId> addresses;            // per index in procedure's symbol_table: where the variable lives
+    ValueId result_address = 0;                // for a procedure returning a struct: where the result goes
+    size_t next_procedure = 0;
+    std::vector<BlockId> loop_ends;            // of the enclosing loops, innermost last: where a break goes
+    ValueId result = 0;                        // of the expression just lowered
+
+    Lowering(TypeTable& types, IRProgram& ir) : types{types}, ir{ir} {}
+
+    //// Building
+
+    BlockId new_block() {
+        f->blocks.emplace_back();
+        return static_cast<BlockId>(f->blocks.size() - 1);
+    }
+
+    [[nodiscard]] bool terminated() const {
+        const std::vector<ValueId>& instrs = f->blocks[current].instrs;
+        return !instrs.empty() && is_terminator(f->values[instrs.back()].op);
+    }
+
+    // Appends an instruction to the current block; code after a jump or a return goes to a block of its own, which
+    // nothing reaches, and which remove_unreachable_blocks deletes once the function is done
+    ValueId emit(IROp op, TypeId type, std::vector<ValueId> args = {}, int64_t imm = 0, std::vector<BlockId> targets = {}) {
+        if (terminated()) current = new_block();
+        return f->add(current, {op, type, imm, std::move(args), std::move(targets)});
+    }
+
+    ValueId constant(TypeId t, int64_t value) { return emit(IR_CONST, t, {}, value); }
+
+    void jump(BlockId to) {
+        if (!terminated()) f->add(current, {IR_JUMP, TYPE_VOID, 0, {}, {to}});
+    }
+
+    // Jumps to yes if the bool cond holds, else to no
+    void branch(ValueId cond, BlockId yes, BlockId no) { emit(IR_BRANCH, TYPE_VOID, {cond}, 0, {yes, no}); }
+
+    // The address of a fresh stack slot for a t, made in the entry block
+    ValueId temporary(TypeId t) {
+        const ValueId slot = f->make(0, {.op = IR_ALLOCA, .type = types.pointer_to(t)});
+        f->blocks[0].instrs.insert(f->blocks[0].instrs.begin() + static_cast<ptrdiff_t>(prologue_end++), slot);
+        return slot;
+    }
+
+    [[nodiscard]] TypeId type_of(ValueId v) const { return f->values[v].type; }
+
+    // v as a to, which the type checker allowed it to become
+    ValueId coerce(ValueId v, TypeId to) {
+        return type_of(v) == to ? v : emit(IR_CONVERT, to, {v});
+    }
+
+    ValueId value(ExprNode& e) {
+        dispatch(e);
+        return result;
+    }
+
+    // Reads the t at address, or for a struct, the address itself
+    ValueId load(TypeId t, ValueId address) {
+        return types.is_struct(t) ? address : emit(IR_LOAD, t, {address});
+    }
+
+    // Stores v, the value of expression of type t, at address; a struct is copied from the address v
+    void store(TypeId t, ValueId v, ValueId address) {
+        if (types.is_struct(t)) emit(IR_COPY, TYPE_VOID, {address, v}, types.size(t));
+        else emit(IR_STORE, TYPE_VOID, {coerce(v, t), address});
+    }
+
+    void zero(TypeId t, ValueId address) {
+        if (types.is_struct(t)) emit(IR_ZERO, TYPE_VOID, {address}, types.size(t));
+        else emit(IR_STORE, TYPE_VOID, {constant(t, 0), address});
+    }
+
+    // Where a variable lives
+    ValueId variable(const SymbolTableEntry& var) {
+        if (var.kind == SymbolTableEntry::GLOBAL) return emit(IR_GLOBAL, types.pointer_to(var.type), {}, var.name);
+        return addresses[var.index];
+    }
+
+    // Where the variable, dereference or field e lives; for a struct value, its address
+    ValueId address(ExprNode& e) {
+        if (auto id = ast_dyn_cast<IDNode>(&e)) return variable(*id->entry);
+        if (auto member = ast_dyn_cast<MemberAccessExprNode>(&e)) {
+            // the struct, or the pointer to it, is an address either way
+            const ValueId base = value(*member->arg);
+            return emit(IR_FIELD, types.pointer_to(member->type), {base}, member->field->offset);
+        }
+        if (auto un = ast_dyn_cast<UnaryExprNode>(&e); un && un->op == Parser::AT) {
+            const ValueId pointer = value(*un->arg);
+            return un->arg->type == TYPE_INT ? emit(IR_CONVERT, types.pointer_to(TYPE_INT), {pointer}) : pointer;
+        }
+        return value(e);
+    }
+
+    ValueId condition(ExprNode& e) { return coerce(value(e), TYPE_BOOL); }
+
+    //// Program Structure
+
+    void visit(ProgramNode& a) {
+        for (const VarInitNode* gv : a.global_vars) ir.globals.push_back({gv->dcl->id, gv->dcl->type});
+
+        begin(ir.init);
+        for (VarInitNode* gv : a.global_vars) {
+            if (gv->val) dispatch(*gv);
+        }
+        emit(IR_RETURN, TYPE_VOID);
+        remove_unreachable_blocks(ir.init);
+
+        ir.procedures.resize(a.procedures.size() + 1);
+        for (ProcedureNode* proc : a.procedures) dispatch(*proc);
+        dispatch(*a.main);
+    }
+
+    void begin(IRFunction& function) {
+        f = &function;
+        current = new_block();
+        prologue_end = 0;
+    }
+
+    // Into the next of ir.procedures, which are in the order of the procedures' entries
+    void visit(ProcedureNode& a) {
+        procedure = &a;
+        begin(ir.procedures[next_procedure++]);
+        f->name = a.id;
+        const size_t num_params = a.params ? a.params->declarations.size() : 0;
+        for (size_t i = 0; i < num_params; i++) {
+            const TypeId t = a.symbol_table[i]->type;
+            f->params.push_back(types.is_struct(t) ? types.pointer_to(t) : t);
+        }
+        const bool struct_result = types.is_struct(a.return_type);
+        if (struct_result) f->params.push_back(types.pointer_to(a.return_type));
+        f->return_type = struct_result ? TYPE_VOID : a.return_type;
+
+        // The parameters, then a slot for each local and scalar parameter, then the parameters stored in theirs
+        std::vector<ValueId> params;
+        for (size_t i = 0; i < f->params.size(); i++) params.push_back(emit(IR_PARAM, f->params[i], {}, static_cast<int64_t>(i)));
+        if (struct_result) result_address = params.back();
+        addresses.assign(a.symbol_table.size(), 0);
+        for (size_t i = 0; i < a.symbol_table.size(); i++) {
+            const TypeId t = a.symbol_table[i]->type;
+            addresses[i] = i < num_params && types.is_struct(t) ? params[i] : emit(IR_ALLOCA, types.pointer_to(t));
+        }
+        prologue_end = f->blocks[0].instrs.size();
+        for (size_t i = 0; i < num_params; i++) {
+            if (!types.is_struct(a.symbol_table[i]->type)) emit(IR_STORE, TYPE_VOID, {params[i], addresses[i]});
+        }
+
+        dispatch(*a.block);
+        if (f->return_type == TYPE_VOID) emit(IR_RETURN, TYPE_VOID);
+        else emit(IR_RETURN, TYPE_VOID, {constant(f->return_type, 0)});
+        remove_unreachable_blocks(*f);
+        procedure = nullptr;
+    }
+
+    void visit(BlockNode& a) {
+        for (StatementNode* s : a.statements) dispatch(*s);
+    }
+
+    //// Statements
+
+    void visit(DeclarationNode& a) { zero(a.type, variable(*a.entry)); }
+    void visit(VarInitNode& a) {
+        if (!a.val) {
+            zero(a.dcl->type, variable(*a.dcl->entry));
+            return;
+        }
+        const ValueId v = value(*a.val);
+        store(a.dcl->type, v, variable(*a.dcl->entry));
+    }
+    void visit(AssignmentNode& a) {
+        const ValueId to = address(*a.LHS);
+        const ValueId v = value(*a.RHS);
+        store(a.LHS->type, v, to);
+    }
+    void visit(IfNode& a) {
+        const BlockId end = new_block();
+        for (const IfNode::IfClause& clause : a.clauses) {
+            if (!clause.cond) {
+                dispatch(*clause.block);
+                break;
+            }
+            const BlockId then = new_block(), next = new_block();
+            branch(condition(*clause.cond), then, next);
+            current = then;
+            dispatch(*clause.block);
+            jump(end);
+            current = next;
+        }
+        jump(end);
+        current = end;
+    }
+    void visit(WhileNode& a) {
+        const BlockId head = new_block(), body = new_block(), end = new_block();
+        jump(head);
+        current = head;
+        branch(condition(*a.condition), body, end);
+        current = body;
+        loop_ends.push_back(end);
+        dispatch(*a.statements);
+        loop_ends.pop_back();
+        jump(head);
+        current = end;
+    }
+    void visit(ForNode& a) {
+        dispatch(*a.prologue);
+        const BlockId head = new_block(), body = new_block(), step = new_block(), end = new_block();
+        jump(head);
+        current = head;
+        branch(condition(*a.cond), body, end);
+        current = body;
+        loop_ends.push_back(end);
+        dispatch(*a.block);
+        loop_ends.pop_back();
+        jump(step);
+        current = step;
+        dispatch(*a.epilogue);
+        jump(head);
+        current = end;
+    }
+    void visit(ForPrologueNode& a) {
+        if (a.init) dispatch(*a.init);
+        else dispatch(*a.asst);
+    }
+    void visit(BreakNode&) { jump(loop_ends.back()); } // resolve_names rejects a break outside a loop
+    void visit(ReturnNode& a) {
+        if (!a.expr) {
+            emit(IR_RETURN, TYPE_VOID);
+            return;
+        }
+        const ValueId v = value(*a.expr);
+        if (types.is_struct(procedure->return_type)) {
+            emit(IR_COPY, TYPE_VOID, {result_address, v}, types.size(procedure->return_type));
+            emit(IR_RETURN, TYPE_VOID);
+        }
+        else {
+            emit(IR_RETURN, TYPE_VOID, {coerce(v, procedure->return_type)});
+        }
+    }
+    void visit(DeleteNode& a) { emit(IR_DELETE, TYPE_VOID, {value(*a.ptr)}); }
+    void visit(PrintNode& a) {
+        std::vector<ValueId> args;
+        for (ExprNode* arg : a.args->args) args.push_back(value(*arg));
+        emit(IR_PRINT, TYPE_VOID, std::move(args));
+    }
+
+    //// Expressions
+
+    void visit(NumNode& a) { result = constant(TYPE_INT, a.val); }
+    void visit(CharNode& a) { result = constant(TYPE_CHAR, static_cast<unsigned char>(a.val)); }
+    void visit(TrueNode&) { result = constant(TYPE_BOOL, 1); }
+    void visit(FalseNode&) { result = constant(TYPE_BOOL, 0); }
+    void visit(NilNode&) { result = constant(TYPE_NIL, 0); }
+    void visit(IDNode& a) { result = load(a.type, variable(*a.entry)); }
+    void visit(MemberAccessExprNode& a) { result = load(a.type, address(a)); }
+
+    void visit(AllocNode& a) {
+        result = emit(IR_NEW, a.ptr_type, {}, int64_t{a.size} * types.size(types.pointee(a.ptr_type)));
+    }
+    void visit(ReadCallNode&) { result = emit(IR_READ, TYPE_CHAR); }
+    void visit(FunctionCallNode& a) {
+        const ProcedureNode& node = *ast_cast<ProcedureNode>(a.callee->node);
+        std::vector<ValueId> args;
+        if (a.args) {
+            for (size_t i = 0; i < a.args->args.size(); i++) {
+                const TypeId param = node.params->declarations[i]->type;
+                const ValueId v = value(*a.args->args[i]);
+                if (!types.is_struct(param)) {
+                    args.push_back(coerce(v, param));
+                    continue;
+                }
+                // the callee gets a copy of its own
+                const ValueId copy = temporary(param);
+                emit(IR_COPY, TYPE_VOID, {copy, v}, types.size(param));
+                args.push_back(copy);
+            }
+        }
+        if (types.is_struct(node.return_type)) {
+            const ValueId to = temporary(node.return_type);
+            args.push_back(to);
+            emit(IR_CALL, TYPE_VOID, std::move(args), a.callee->index);
+            result = to;
+            return;
+        }
+        result = emit(IR_CALL, node.return_type, std::move(args), a.callee->index);
+    }
+
+    void visit(BinaryExprNode& a) {
+        if (a.op == Parser::AND || a.op == Parser::OR) {
+            // l && r is l ? r : false and l || r is l ? true : r, with the value l already has on the edge that skips r
+            const ValueId l = condition(*a.LHS);
+            const BlockId from = current, right = new_block(), done = new_block();
+            if (a.op == Parser::AND) branch(l, right, done);
+            else branch(l, done, right);
+            current = right;
+            const ValueId r = condition(*a.RHS);
+            const BlockId right_end = current;
+            jump(done);
+            current = done;
+            result = emit(IR_PHI, TYPE_BOOL, {l, r}, 0, {from, right_end});
+            return;
+        }
+        ValueId l = value(*a.LHS);
+        ValueId r = value(*a.RHS);
+        const TypeId lt = a.LHS->type, rt = a.RHS->type;
+        const bool lp = types.is_pointer(lt), rp = types.is_pointer(rt);
+        static constexpr std::pair<Parser::ParserSymbol, IROp> OPS[] = {
+            {Parser::PLUS, IR_ADD}, {Parser::SUB, IR_SUB}, {Parser::MULT, IR_MUL}, {Parser::DIV, IR_DIV},
+            {Parser::MOD, IR_MOD}, {Parser::EXP, IR_POW}, {Parser::LSHIFT, IR_SHL}, {Parser::RSHIFT, IR_SHR},
+            {Parser::BITAND, IR_AND}, {Parser::BITOR, IR_OR}, {Parser::BITXOR, IR_XOR}, {Parser::EQUALS, IR_EQ},
+            {Parser::NEQ, IR_NE}, {Parser::LT, IR_LT}, {Parser::LEQ, IR_LE}, {Parser::GT, IR_GT}, {Parser::GEQ, IR_GE},
+        };
+        IROp op = IR_ADD;
+        for (const auto& [symbol, ir_op] : OPS) {
+            if (symbol == a.op) op = ir_op;
+        }
+
+        if (op >= IR_EQ) {
+            // compared as ints, or as the pointer type of either side
+            const TypeId t = TypeTable::is_integral(lt) && TypeTable::is_integral(rt) ? (lt == rt ? lt : TYPE_INT)
+                             : lp                                                      ? lt
+                                                                                       : rt;
+            result = emit(op, TYPE_BOOL, {coerce(l, t), coerce(r, t)});
+            return;
+        }
+        if (lp && rp) {
+            result = emit(IR_PTRDIFF, TYPE_INT, {l, r}, types.size(types.pointee(lt)));
+            return;
+        }
+        if (lp || rp) {
+            if (rp) std::swap(l, r);
+            ValueId n = coerce(r, TYPE_INT);
+            if (op == IR_SUB) n = emit(IR_NEG, TYPE_INT, {n});
+            result = emit(IR_OFFSET, a.type, {l, n}, types.size(types.pointee(a.type)));
+            return;
+        }
+        result = emit(op, TYPE_INT, {coerce(l, TYPE_INT), coerce(r, TYPE_INT)});
+    }
+
+    void visit(UnaryExprNode& a) {
+        switch (a.op) {
+            case Parser::AT:
+                result = load(a.type, address(a));
+                return;
+            case Parser::ADDR:
+                result = address(*a.arg);
+                return;
+            case Parser::INCR:
+            case Parser::DECR: {
+                const ValueId at = address(*a.arg);
+                const ValueId old = emit(IR_LOAD, a.type, {at});
+                const ValueId one = constant(TYPE_INT, a.op == Parser::INCR ? 1 : -1);
+                const ValueId changed =
+                    types.is_pointer(a.type)
+                        ? emit(IR_OFFSET, a.type, {old, one}, types.size(types.pointee(a.type)))
+                        : coerce(emit(IR_ADD, TYPE_INT, {coerce(old, TYPE_INT), one}), a.type);
+                emit(IR_STORE, TYPE_VOID, {changed, at});
+                result = a.postfix() ? old : changed;
+                return;
+            }
+            default:
+                break;
+        }
+        const ValueId v = value(*a.arg);
+        switch (a.op) {
+            case Parser::NOT:
+                result = emit(IR_EQ, TYPE_BOOL, {v, constant(a.arg->type, 0)});
+                break;
+            case Parser::BITNOT:
+                result = emit(IR_NOT, TYPE_INT, {coerce(v, TYPE_INT)});
+                break;
+            case Parser::SUB:
+                result = emit(IR_NEG, TYPE_INT, {coerce(v, TYPE_INT)});
+                break;
+            default: // PLUS
+                result = coerce(v, TYPE_INT);
+        }
+    }
+
+    // Struct definitions and the argument and declaration lists are handled by their owners and never dispatched on
+    void visit(StructDefNode&) {}
+    void visit(DeclarationsNode&) {}
+    void visit(ArgsNode&) {}
+};
+
+void lower_program(ProgramNode& program, TypeTable& types, IRProgram& ir) {
+    Lowering lowering{types, ir};
+    lowering.dispatch(program);
+}
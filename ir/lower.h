@@ -0,0 +1,17 @@
+#ifndef XERLANG_LOWER_H
+#define XERLANG_LOWER_H
+
+#include "ir.h"
+#include "../parser/ast.h"
+#include "../util/type_table.h"
+
+// Lowering to the IR, of a tree that resolve_names, check_types and lay_out_structs accepted: a function per procedure, in
+// ProgramNode order with main last, and one for the globals' initializers.
+// Every variable lives in memory: each local and scalar parameter gets an ALLOCA in the entry block, and every use of
+// it is a LOAD or a STORE, so the only PHIs are those merging the two sides of && and ||, which are lowered as the
+// branches they short-circuit into. promote_locals then turns what it can into SSA values.
+// Conversions the language makes implicitly are explicit CONVERTs, and a declaration without an initializer stores
+// zero. A procedure that ends without a return returns zero, as the code generator has it.
+void lower_program(ProgramNode& program, TypeTable& types, IRProgram& ir);
+
+#endif // XERLANG_LOWER_H
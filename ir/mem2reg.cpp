@@ -0,0 +1,296 @@
+#include "mem2reg.h"
+#include <cstdint>
+#include <numeric>
+#include <utility>
+
+#define NO_VARIABLE uint32_t{0xFFFFFFFF}
+#define NO_VALUE ValueId{0xFFFFFFFF}
+
+struct Promotion {
+    IRFunction& f;
+    const TypeTable& types;
+    std::vector<ValueId> allocas;     // per promoted variable
+    std::vector<uint32_t> variable;   // per ValueId: the variable a promoted ALLOCA, or a PHI placed for one, stands for
+    std::vector<ValueId> replacement; // per ValueId: what a deleted LOAD or PHI is to be replaced by; itself otherwise
+    std::vector<ValueId> current;     // per variable: its value where renaming is, NO_VALUE while nothing was stored
+    std::vector<ValueId> zeros;       // per variable: the zero it starts as, once needed
+    std::vector<ValueId> constants;   // the zeros, to go at the top of the entry block
+    std::vector<std::pair<uint32_t, ValueId>> undo; // the variables renaming has set, and the values they had
+
+    Promotion(IRFunction& f, const TypeTable& types) : f{f}, types{types} {}
+
+    // Makes an instruction to be placed in b
+    ValueId make(BlockId b, IRInstr instr) {
+        const ValueId v = f.make(b, std::move(instr));
+        variable.push_back(NO_VARIABLE);
+        replacement.push_back(v);
+        return v;
+    }
+
+    [[nodiscard]] uint32_t promoted(ValueId address) const {
+        return f.values[address].op == IR_ALLOCA ? variable[address] : NO_VARIABLE;
+    }
+
+    [[nodiscard]] ValueId resolve(ValueId v) const {
+        while (replacement[v] != v) v = replacement[v];
+        return v;
+    }
+
+    void remove(ValueId v) { f.values[v].block = NO_BLOCK; }
+
+    // Picks the ALLOCAs of scalars whose every use is as the address of a LOAD or a STORE
+    void find_variables() {
+        variable.assign(f.values.size(), NO_VARIABLE);
+        replacement.resize(f.values.size());
+        std::iota(replacement.begin(), replacement.end(), ValueId{0});
+        std::vector<ValueId> candidates;
+        for (ValueId v : f.blocks[0].instrs) {
+            const IRInstr& instr = f.values[v];
+            if (instr.op != IR_ALLOCA || types.is_struct(types.pointee(instr.type))) continue;
+            variable[v] = static_cast<uint32_t>(candidates.size());
+            candidates.push_back(v);
+        }
+        std::vector<bool> escapes(candidates.size(), false);
+        for (const IRBlock& block : f.blocks) {
+            for (ValueId v : block.instrs) {
+                const IRInstr& instr = f.values[v];
+                for (size_t i = 0; i < instr.args.size(); i++) {
+                    const uint32_t k = variable[instr.args[i]];
+                    if (k == NO_VARIABLE) continue;
+                    if (!((instr.op == IR_LOAD && i == 0) || (instr.op == IR_STORE && i == 1))) escapes[k] = true;
+                }
+            }
+        }
+        for (size_t k = 0; k < candidates.size(); k++) {
+            if (escapes[k]) {
+                variable[candidates[k]] = NO_VARIABLE;
+                continue;
+            }
+            variable[candidates[k]] = static_cast<uint32_t>(allocas.size());
+            allocas.push_back(candidates[k]);
+        }
+    }
+
+    // Gives each variable a PHI at the iterated dominance frontier of the blocks that store to it
+    void place_phis(const std::vector<BlockId>& idom) {
+        const size_t num_blocks = f.blocks.size();
+        std::vector<std::vector<BlockId>> frontier(num_blocks);
+        for (BlockId b = 0; b < num_blocks; b++) {
+            if (f.blocks[b].preds.size() < 2) continue;
+            for (BlockId runner : f.blocks[b].preds) {
+                for (; runner != idom[b]; runner = idom[runner]) {
+                    if (frontier[runner].empty() || frontier[runner].back() != b) frontier[runner].push_back(b);
+                }
+            }
+        }
+
+        std::vector<std::vector<BlockId>> stores(allocas.size());
+        for (BlockId b = 0; b < num_blocks; b++) {
+            for (ValueId v : f.blocks[b].instrs) {
+                const IRInstr& instr = f.values[v];
+                if (instr.op != IR_STORE) continue;
+                const uint32_t k = promoted(instr.args[1]);
+                if (k != NO_VARIABLE && (stores[k].empty() || stores[k].back() != b)) stores[k].push_back(b);
+            }
+        }
+
+        std::vector<std::vector<ValueId>> phis(num_blocks);
+        std::vector<uint32_t> has_phi(num_blocks, NO_VARIABLE), queued(num_blocks, NO_VARIABLE);
+        for (uint32_t k = 0; k < allocas.size(); k++) {
+            std::vector<BlockId>& work = stores[k];
+            for (BlockId b : work) queued[b] = k;
+            while (!work.empty()) {
+                const BlockId b = work.back();
+                work.pop_back();
+                for (BlockId d : frontier[b]) {
+                    if (has_phi[d] == k) continue;
+                    has_phi[d] = k;
+                    const ValueId phi = make(d, {.op = IR_PHI, .type = types.pointee(f.values[allocas[k]].type)});
+                    variable[phi] = k;
+                    phis[d].push_back(phi);
+                    if (queued[d] != k) {
+                        queued[d] = k;
+                        work.push_back(d);
+                    }
+                }
+            }
+        }
+        for (BlockId b = 0; b < num_blocks; b++) {
+            f.blocks[b].instrs.insert(f.blocks[b].instrs.begin(), phis[b].begin(), phis[b].end());
+        }
+    }
+
+    ValueId value_of(uint32_t k) {
+        if (current[k] != NO_VALUE) return current[k];
+        if (zeros[k] == NO_VALUE) {
+            zeros[k] = make(0, {.op = IR_CONST, .type = types.pointee(f.values[allocas[k]].type)});
+            constants.push_back(zeros[k]);
+        }
+        return zeros[k];
+    }
+
+    void set(uint32_t k, ValueId v) {
+        undo.push_back({k, current[k]});
+        current[k] = v;
+    }
+
+    // Replaces the LOADs and STOREs of the variables in b by the values they carry, and passes those on to the PHIs
+    // of b's successors
+    void rename_block(BlockId b) {
+        std::vector<ValueId>& instrs = f.blocks[b].instrs;
+        size_t kept = 0;
+        for (ValueId v : instrs) {
+            const IROp op = f.values[v].op;
+            if (op == IR_PHI && variable[v] != NO_VARIABLE) {
+                set(variable[v], v);
+            }
+            else if (op == IR_LOAD && promoted(f.values[v].args[0]) != NO_VARIABLE) {
+                replacement[v] = value_of(promoted(f.values[v].args[0]));
+                remove(v);
+                continue;
+            }
+            else if (op == IR_STORE && promoted(f.values[v].args[1]) != NO_VARIABLE) {
+                set(promoted(f.values[v].args[1]), resolve(f.values[v].args[0]));
+                remove(v);
+                continue;
+            }
+            instrs[kept++] = v;
+        }
+        instrs.resize(kept);
+
+        const std::vector<BlockId> succs = successors(f, b);
+        for (BlockId s : succs) {
+            for (ValueId phi : f.blocks[s].instrs) {
+                if (f.values[phi].op != IR_PHI) break;
+                if (variable[phi] == NO_VARIABLE) continue;
+                const ValueId incoming = value_of(variable[phi]);
+                f.values[phi].args.push_back(incoming);
+                f.values[phi].targets.push_back(b);
+            }
+        }
+    }
+
+    // Renames block by block down the dominator tree, so that every block sees the values its dominators left
+    void rename(const std::vector<BlockId>& idom) {
+        std::vector<std::vector<BlockId>> children(f.blocks.size());
+        for (BlockId b = 1; b < f.blocks.size(); b++) children[idom[b]].push_back(b);
+        current.assign(allocas.size(), NO_VALUE);
+        zeros.assign(allocas.size(), NO_VALUE);
+
+        struct Step {
+            BlockId block;
+            size_t undo_mark; // SIZE_MAX to enter block, else to leave it, restoring the variables to what they were
+        };
+        std::vector<Step> steps = {{0, SIZE_MAX}};
+        while (!steps.empty()) {
+            const Step step = steps.back();
+            steps.pop_back();
+            if (step.undo_mark != SIZE_MAX) {
+                while (undo.size() > step.undo_mark) {
+                    current[undo.back().first] = undo.back().second;
+                    undo.pop_back();
+                }
+                continue;
+            }
+            steps.push_back({step.block, undo.size()});
+            rename_block(step.block);
+            for (BlockId child : children[step.block]) steps.push_back({child, SIZE_MAX});
+        }
+    }
+
+    // Replaces PHIs whose operands are one value (and the PHI itself) by that value, until there are none; then
+    // removes the PHIs nothing uses, and the zeros
+    void simplify_phis() {
+        std::vector<ValueId> phis;
+        for (const IRBlock& block : f.blocks) {
+            for (ValueId v : block.instrs) {
+                if (f.values[v].op == IR_PHI) phis.push_back(v);
+            }
+        }
+        for (bool changed = true; changed;) {
+            changed = false;
+            for (ValueId phi : phis) {
+                if (f.values[phi].block == NO_BLOCK) continue;
+                ValueId only = NO_VALUE;
+                bool trivial = true;
+                for (ValueId arg : f.values[phi].args) {
+                    arg = resolve(arg);
+                    if (arg == phi || arg == only) continue;
+                    if (only != NO_VALUE) {
+                        trivial = false;
+                        break;
+                    }
+                    only = arg;
+                }
+                if (!trivial || only == NO_VALUE) continue;
+                replacement[phi] = only;
+                remove(phi);
+                changed = true;
+            }
+        }
+        resolve_operands();
+
+        std::vector<uint32_t> uses(f.values.size(), 0);
+        for (const IRBlock& block : f.blocks) {
+            for (ValueId v : block.instrs) {
+                if (f.values[v].block == NO_BLOCK) continue;
+                for (ValueId arg : f.values[v].args) uses[arg]++;
+            }
+        }
+        std::vector<ValueId> dead;
+        for (ValueId phi : phis) {
+            if (f.values[phi].block != NO_BLOCK && uses[phi] == 0) dead.push_back(phi);
+        }
+        while (!dead.empty()) {
+            const ValueId phi = dead.back();
+            dead.pop_back();
+            remove(phi);
+            for (ValueId arg : f.values[phi].args) {
+                if (--uses[arg] == 0 && arg != phi && f.values[arg].op == IR_PHI && f.values[arg].block != NO_BLOCK) {
+                    dead.push_back(arg);
+                }
+            }
+        }
+        for (ValueId zero : constants) {
+            if (uses[zero] == 0) remove(zero);
+        }
+    }
+
+    void resolve_operands() {
+        for (const IRBlock& block : f.blocks) {
+            for (ValueId v : block.instrs) {
+                for (ValueId& arg : f.values[v].args) arg = resolve(arg);
+            }
+        }
+    }
+
+    // Drops the deleted instructions from the blocks
+    void compact() {
+        for (IRBlock& block : f.blocks) {
+            std::erase_if(block.instrs, [this](ValueId v) { return f.values[v].block == NO_BLOCK; });
+        }
+    }
+
+    void run() {
+        find_variables();
+        if (allocas.empty()) return;
+        const std::vector<BlockId> idom = immediate_dominators(f);
+        place_phis(idom);
+        rename(idom);
+        for (ValueId alloca : allocas) remove(alloca);
+        std::vector<ValueId>& entry = f.blocks[0].instrs;
+        entry.insert(entry.begin(), constants.begin(), constants.end());
+        resolve_operands();
+        simplify_phis();
+        compact();
+    }
+};
+
+void promote_locals(IRFunction& f, const TypeTable& types) {
+    Promotion{f, types}.run();
+}
+
+void promote_locals(IRProgram& program, const TypeTable& types) {
+    promote_locals(program.init, types);
+    for (IRFunction& f : program.procedures) promote_locals(f, types);
+}
@@ -0,0 +1,17 @@
+#ifndef XERLANG_MEM2REG_H
+#define XERLANG_MEM2REG_H
+
+#include "ir.h"
+#include "../util/type_table.h"
+
+// Promotion of memory to SSA values ("mem2reg"), on IR from lower_program. An ALLOCA of a scalar that is only ever
+// the address of a LOAD or a STORE, which is every int, char, bool and pointer local and parameter whose address the
+// program never takes with $, is replaced by values: each LOAD by the value last stored on the way to it, with a PHI
+// where control flow merges different ones (placed at the iterated dominance frontier of the stores, after Cytron et
+// al.) and zero where nothing was stored yet. PHIs nothing uses and PHIs that merge a single value are then removed.
+void promote_locals(IRFunction& f, const TypeTable& types);
+
+// Every function of the program
+void promote_locals(IRProgram& program, const TypeTable& types);
+
+#endif // XERLANG_MEM2REG_H
@@ -0,0 +1,310 @@
+#include "verifier.h"
+#include <algorithm>
+#include <ostream>
+
+struct Verifier {
+    const IRProgram& program;
+    const TypeTable& types;
+    const Interner& symbols;
+    std::ostream& err;
+    const IRFunction* f = nullptr;
+    std::vector<BlockId> where;     // per ValueId: the block it is in, NO_BLOCK if none
+    std::vector<uint32_t> position; // per ValueId: its index in that block
+    std::vector<BlockId> idom;
+    std::vector<TypeId> global_types; // per Symbol: the type of the global of that name, TYPE_VOID if there is none
+    bool ok = true;
+
+    Verifier(const IRProgram& program, const TypeTable& types, const Interner& symbols, std::ostream& err)
+        : program{program}, types{types}, symbols{symbols}, err{err} {}
+
+    // Starts a report; the caller writes the problem and the newline
+    std::ostream& error() {
+        err << "IR Error in ";
+        if (f == &program.init) err << "the initializer";
+        else err << "procedure " << symbols.name(f->name);
+        ok = false;
+        return err << ": ";
+    }
+
+    std::ostream& error(ValueId v) { return error() << '%' << v << " (" << IR_OP_NAMES[f->values[v].op] << "): "; }
+
+    [[nodiscard]] bool scalar(TypeId t) const {
+        return TypeTable::is_integral(t) || t == TYPE_NIL || types.is_pointer(t);
+    }
+
+    [[nodiscard]] bool converts(TypeId from, TypeId to) const {
+        if (TypeTable::is_integral(from) && TypeTable::is_integral(to)) return true;
+        if (to == TYPE_BOOL) return from == TYPE_NIL || types.is_pointer(from);
+        if (from == TYPE_NIL) return types.is_pointer(to);
+        return from == TYPE_INT && types.is_pointer(to) && types.pointee(to) == TYPE_INT;
+    }
+
+    [[nodiscard]] bool dominates(BlockId a, BlockId b) const {
+        while (b != a && b != 0) b = idom[b];
+        return b == a;
+    }
+
+    // Checks the blocks hold their instructions as they should, and records where each one is; false if the control
+    // flow graph cannot be walked
+    bool check_blocks() {
+        where.assign(f->values.size(), NO_BLOCK);
+        position.assign(f->values.size(), 0);
+        bool walkable = true;
+        if (f->blocks.empty()) {
+            error() << "no blocks\n";
+            return false;
+        }
+        for (BlockId b = 0; b < f->blocks.size(); b++) {
+            const std::vector<ValueId>& instrs = f->blocks[b].instrs;
+            if (instrs.empty()) {
+                error() << 'b' << b << " is empty\n";
+                walkable = false;
+                continue;
+            }
+            for (uint32_t i = 0; i < instrs.size(); i++) {
+                const ValueId v = instrs[i];
+                if (v >= f->values.size()) {
+                    error() << 'b' << b << " holds %" << v << ", which does not exist\n";
+                    walkable = false;
+                    continue;
+                }
+                if (where[v] != NO_BLOCK) error(v) << "in both b" << where[v] << " and b" << b << '\n';
+                where[v] = b;
+                position[v] = i;
+                const IRInstr& instr = f->values[v];
+                if (instr.block != b) error(v) << "in b" << b << " but records b" << instr.block << '\n';
+                if (is_terminator(instr.op) && i + 1 != instrs.size()) error(v) << "a terminator before the end of b" << b << '\n';
+                if (instr.op == IR_PHI && i > 0 && f->values[instrs[i - 1]].op != IR_PHI) {
+                    error(v) << "after the start of b" << b << '\n';
+                }
+                for (BlockId target : instr.targets) {
+                    if (target < f->blocks.size()) continue;
+                    error(v) << "refers to b" << target << ", which does not exist\n";
+                    walkable = false;
+                }
+            }
+            if (instrs.back() < f->values.size() && !is_terminator(f->values[instrs.back()].op)) {
+                error() << 'b' << b << " does not end with a terminator\n";
+                walkable = false;
+            }
+        }
+        return walkable;
+    }
+
+    // Checks the preds against the terminators, and that every block is reachable; false if one is not
+    bool check_graph() {
+        std::vector<std::vector<BlockId>> preds(f->blocks.size());
+        for (BlockId b = 0; b < f->blocks.size(); b++) {
+            for (BlockId s : successors(*f, b)) preds[s].push_back(b);
+        }
+        for (BlockId b = 0; b < f->blocks.size(); b++) {
+            std::vector<BlockId> recorded = f->blocks[b].preds;
+            std::ranges::sort(recorded);
+            if (recorded != preds[b]) error() << "the preds of b" << b << " are not the blocks that go to it\n";
+        }
+        if (!preds[0].empty()) error() << "the entry block has predecessors\n";
+
+        idom = immediate_dominators(*f);
+        bool reachable = true;
+        for (BlockId b = 0; b < f->blocks.size(); b++) {
+            if (idom[b] != NO_BLOCK) continue;
+            error() << 'b' << b << " is unreachable\n";
+            reachable = false;
+        }
+        return reachable;
+    }
+
+    // Checks v's operands are values defined before v; false if one is not a value at all
+    bool check_operands(ValueId v) {
+        const IRInstr& instr = f->values[v];
+        bool valid = true;
+        for (size_t i = 0; i < instr.args.size(); i++) {
+            const ValueId arg = instr.args[i];
+            if (arg >= f->values.size() || where[arg] == NO_BLOCK) {
+                error(v) << "uses %" << arg << ", which is not in any block\n";
+                valid = false;
+                continue;
+            }
+            if (f->values[arg].type == TYPE_VOID) {
+                error(v) << "uses %" << arg << ", which has no value\n";
+                valid = false;
+                continue;
+            }
+            bool defined;
+            if (instr.op == IR_PHI) defined = i >= instr.targets.size() || dominates(where[arg], instr.targets[i]);
+            else if (where[arg] == where[v]) defined = position[arg] < position[v];
+            else defined = dominates(where[arg], where[v]);
+            if (!defined) error(v) << "uses %" << arg << " where it may not have been defined\n";
+        }
+        return valid;
+    }
+
+    void check_types(ValueId v) {
+        const IRInstr& instr = f->values[v];
+        const auto arg = [&](size_t k) { return f->values[instr.args[k]].type; };
+        // Reports unless cond; false if it reported
+        const auto expect = [&](bool cond, const char* what) {
+            if (!cond) error(v) << what << '\n';
+            return cond;
+        };
+        const auto arity = [&](size_t n) {
+            if (instr.args.size() == n) return true;
+            error(v) << "takes " << n << " operands, not " << instr.args.size() << '\n';
+            return false;
+        };
+        const bool branches = instr.op == IR_JUMP || instr.op == IR_BRANCH || instr.op == IR_PHI;
+        expect(branches || instr.targets.empty(), "has targets");
+        const bool no_value = instr.op == IR_STORE || instr.op == IR_COPY || instr.op == IR_ZERO ||
+                              instr.op == IR_DELETE || instr.op == IR_PRINT || is_terminator(instr.op);
+        if (no_value) expect(instr.type == TYPE_VOID, "defines a value");
+        else if (instr.op != IR_CALL) expect(instr.type != TYPE_VOID && instr.type < types.num_types(), "defines no value");
+        if (instr.type != TYPE_VOID && instr.type >= types.num_types()) return;
+
+        switch (instr.op) {
+            case IR_CONST:
+                if (arity(0)) expect(scalar(instr.type), "not an integral, a pointer or NULL");
+                break;
+            case IR_PARAM:
+                if (arity(0)) {
+                    expect(instr.imm >= 0 && static_cast<size_t>(instr.imm) < f->params.size() &&
+                               f->params[instr.imm] == instr.type,
+                           "not a parameter of that type");
+                }
+                break;
+            case IR_GLOBAL:
+                if (arity(0)) {
+                    const bool found = instr.imm >= 0 && static_cast<size_t>(instr.imm) < global_types.size() &&
+                                       global_types[instr.imm] != TYPE_VOID && types.is_pointer(instr.type) &&
+                                       types.pointee(instr.type) == global_types[instr.imm];
+                    expect(found, "not the address of a global");
+                }
+                break;
+            case IR_ALLOCA:
+                if (arity(0)) {
+                    expect(types.is_pointer(instr.type), "not a pointer");
+                    expect(where[v] == 0, "outside the entry block");
+                }
+                break;
+            case IR_LOAD:
+                if (arity(1)) {
+                    expect(types.is_pointer(arg(0)) && types.pointee(arg(0)) == instr.type && scalar(instr.type),
+                           "does not load a scalar of its type from a pointer to one");
+                }
+                break;
+            case IR_STORE:
+                if (arity(2)) {
+                    expect(types.is_pointer(arg(1)) && types.pointee(arg(1)) == arg(0) && scalar(arg(0)),
+                           "does not store a scalar through a pointer to its type");
+                }
+                break;
+            case IR_COPY:
+                if (arity(2)) expect(types.is_pointer(arg(0)) && types.is_pointer(arg(1)) && instr.imm > 0, "not a copy between pointers");
+                break;
+            case IR_ZERO:
+                if (arity(1)) expect(types.is_pointer(arg(0)) && instr.imm > 0, "not a pointer");
+                break;
+            case IR_FIELD:
+                if (arity(1)) expect(types.is_pointer(arg(0)) && types.is_pointer(instr.type), "not a pointer");
+                break;
+            case IR_OFFSET:
+                if (arity(2)) {
+                    expect(types.is_pointer(arg(0)) && arg(1) == TYPE_INT && instr.type == arg(0),
+                           "does not offset a pointer by an int");
+                }
+                break;
+            case IR_PTRDIFF:
+                if (arity(2)) {
+                    expect(types.is_pointer(arg(0)) && arg(0) == arg(1) && instr.type == TYPE_INT && instr.imm > 0,
+                           "does not subtract two pointers of one type");
+                }
+                break;
+            case IR_CONVERT:
+                if (arity(1)) expect(converts(arg(0), instr.type), "not a conversion the language makes");
+                break;
+            case IR_NEG:
+            case IR_NOT:
+                if (arity(1)) expect(arg(0) == TYPE_INT && instr.type == TYPE_INT, "not on an int");
+                break;
+            case IR_EQ:
+            case IR_NE:
+            case IR_LT:
+            case IR_LE:
+            case IR_GT:
+            case IR_GE:
+                if (arity(2)) {
+                    expect(arg(0) == arg(1) && scalar(arg(0)) && instr.type == TYPE_BOOL,
+                           "does not compare two scalars of one type to a bool");
+                }
+                break;
+            case IR_CALL: {
+                if (instr.imm < 0 || static_cast<size_t>(instr.imm) >= program.procedures.size()) {
+                    expect(false, "calls a procedure that does not exist");
+                    break;
+                }
+                const IRFunction& callee = program.procedures[instr.imm];
+                bool match = instr.args.size() == callee.params.size() && instr.type == callee.return_type;
+                for (size_t i = 0; match && i < instr.args.size(); i++) match = arg(i) == callee.params[i];
+                expect(match, "does not match the signature of the procedure it calls");
+                break;
+            }
+            case IR_READ:
+                if (arity(0)) expect(instr.type == TYPE_CHAR, "not a char");
+                break;
+            case IR_NEW:
+                if (arity(0)) expect(types.is_pointer(instr.type), "not a pointer");
+                break;
+            case IR_DELETE:
+                if (arity(1)) expect(types.is_pointer(arg(0)), "not a pointer");
+                break;
+            case IR_PRINT:
+                for (size_t i = 0; i < instr.args.size(); i++) expect(scalar(arg(i)), "prints something other than a scalar");
+                break;
+            case IR_PHI: {
+                if (!expect(instr.args.size() == instr.targets.size(), "has a different number of operands and blocks")) break;
+                std::vector<BlockId> from = instr.targets;
+                std::vector<BlockId> preds = f->blocks[where[v]].preds;
+                std::ranges::sort(from);
+                std::ranges::sort(preds);
+                expect(from == preds, "does not have one operand per predecessor");
+                for (size_t i = 0; i < instr.args.size(); i++) expect(arg(i) == instr.type, "merges a value of another type");
+                break;
+            }
+            case IR_JUMP:
+                if (arity(0)) expect(instr.targets.size() == 1, "does not have one target");
+                break;
+            case IR_BRANCH:
+                if (arity(1)) {
+                    expect(arg(0) == TYPE_BOOL, "on something other than a bool");
+                    expect(instr.targets.size() == 2, "does not have two targets");
+                }
+                break;
+            case IR_RETURN:
+                if (f->return_type == TYPE_VOID) arity(0);
+                else if (arity(1)) expect(arg(0) == f->return_type, "returns a value of another type");
+                break;
+            default: // int arithmetic on two operands
+                if (arity(2)) {
+                    expect(arg(0) == TYPE_INT && arg(1) == TYPE_INT && instr.type == TYPE_INT, "not on two ints");
+                }
+        }
+    }
+
+    void check(const IRFunction& function) {
+        f = &function;
+        if (!check_blocks() || !check_graph()) return;
+        for (const IRBlock& block : f->blocks) {
+            for (ValueId v : block.instrs) {
+                if (check_operands(v)) check_types(v);
+            }
+        }
+    }
+};
+
+bool verify_ir(const IRProgram& program, const TypeTable& types, const Interner& symbols, std::ostream& err) {
+    Verifier verifier{program, types, symbols, err};
+    verifier.global_types.assign(symbols.size(), TYPE_VOID);
+    for (const IRGlobal& global : program.globals) verifier.global_types[global.name] = global.type;
+    verifier.check(program.init);
+    for (const IRFunction& f : program.procedures) verifier.check(f);
+    return verifier.ok;
+}
@@ -0,0 +1,19 @@
+#ifndef XERLANG_VERIFIER_H
+#define XERLANG_VERIFIER_H
+
+#include <iosfwd>
+#include "ir.h"
+#include "../util/interner.h"
+#include "../util/type_table.h"
+
+// Checks that program is well formed, so that each pass can be tested on its own by verifying what it leaves:
+// - every block is reachable from the entry, starts with its PHIs and ends with its only terminator, whose targets
+//   exist; every block's preds are the blocks that go to it, and the entry has none;
+// - every operand is a live value defined before its use, in the same block or one that dominates it (for a PHI, one
+//   that dominates the predecessor it comes from), and a PHI has one operand per predecessor;
+// - operands and results have the types their instruction calls for (see IROp), calls match the procedure they call,
+//   and returns the function's return type; ALLOCAs are in the entry block.
+// Reports each problem to err; false if there were any.
+bool verify_ir(const IRProgram& program, const TypeTable& types, const Interner& symbols, std::ostream& err);
+
+#endif // XERLANG_VERIFIER_H
@@ -1,26 +1,188 @@
+#include <cstdio>
 #include <fstream>
 #include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
+#include <unistd.h>
+#include "ir/ir.h"
+#include "ir/lower.h"
+#include "ir/mem2reg.h"
+#include "ir/verifier.h"
+#include "parser/ast_file.h"
+#include "parser/flat_ast.h"
 #include "parser/parser.h"
 #include "scanner/scanner.h"
+#include "util/arena.h"
+#include "util/interner.h"
+#include "util/output.h"
+#include "util/source.h"
 #include "util/types.h"
 
+#include "visitors/codegen.h"
+#include "visitors/layout.h"
 #include "visitors/printer.h"
+#include "visitors/resolver.h"
+#include "visitors/type_checker.h"
 
 int main(int argc, char* argv[]) {
-    // Scanner
-    std::ifstream ifs{"../xer/sample_program.xer"};
-    std::ofstream ofs{"../xer/sample_program.tokens"}; // std::ofstream ofs{"/dev/null"};
-    std::vector<Token> stream = {{{}, Parser::ParserSymbol::BoF}};
-    scan(ifs, ofs, stream, std::cerr);
-    if (stream.back().type == Parser::ParserSymbol::DOLLAR) return 1;
-    stream.push_back({{}, Parser::ParserSymbol::EoF});
-    stream.push_back({{}, Parser::ParserSymbol::DOLLAR});
+    // --flat dumps the flat, index-based form of the checked tree (the one --emit-ast saves) instead of the tree, and
+    // --flat-syntax the flat form the parser builds directly, before any semantic pass;
+    // --json and --sexpr dump the tree in a machine-readable format instead of the indented text;
+    // --emit-ast FILE saves the parsed tree as an AST file instead of dumping it, and --load-ast FILE dumps a saved
+    // tree without touching any source; --fused resolves names and checks types while parsing instead of in passes
+    // of their own; --reorder-fields lays out each struct's fields by alignment rather than as declared, and
+    // --layout-report prints the struct layouts instead of the tree; -o FILE compiles the program into the executable
+    // FILE instead, and --emit-asm FILE writes the assembly it is built from instead (or as well, kept next to it);
+    // --ir prints the program lowered to the IR instead of the tree, its locals promoted to SSA values unless with
+    // --no-mem2reg
+    bool flat = false;
+    bool flat_syntax = false;
+    bool fused = false;
+    FieldOrder field_order = FIELDS_AS_DECLARED;
+    bool layout_report = false;
+    bool dump_ir = false;
+    bool mem2reg = true;
+    DumpFormat format = DUMP_TEXT;
+    const char* emit_path = nullptr;
+    const char* load_path = nullptr;
+    const char* exe_path = nullptr;
+    const char* asm_path = nullptr;
+    const char* path = "../xer/sample_program.xer";
+    for (int i = 1; i < argc; i++) {
+        const std::string_view arg{argv[i]};
+        if (arg == "--flat") flat = true;
+        else if (arg == "--flat-syntax") flat_syntax = true;
+        else if (arg == "--fused") fused = true;
+        else if (arg == "--reorder-fields") field_order = FIELDS_BY_ALIGNMENT;
+        else if (arg == "--layout-report") layout_report = true;
+        else if (arg == "--ir") dump_ir = true;
+        else if (arg == "--no-mem2reg") mem2reg = false;
+        else if (arg == "--json") format = DUMP_JSON;
+        else if (arg == "--sexpr") format = DUMP_SEXPR;
+        else if (arg == "--emit-ast" && i + 1 < argc) emit_path = argv[++i];
+        else if (arg == "--load-ast" && i + 1 < argc) load_path = argv[++i];
+        else if (arg == "-o" && i + 1 < argc) exe_path = argv[++i];
+        else if (arg == "--emit-asm" && i + 1 < argc) asm_path = argv[++i];
+        else path = argv[i];
+    }
+
+    if (load_path) {
+        try {
+            const ASTFile file{load_path};
+            OutputBuffer out{STDOUT_FILENO};
+            print_flat_ast(file, out);
+            out.flush();
+            return out.good() ? 0 : 1;
+        } catch (std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
 
-    // Parser
-    std::unique_ptr<ASTNode> root = parse(stream, std::cerr);
+    std::optional<SourceBuffer> source;
+    try {
+        source.emplace(path);
+    } catch (std::exception& e) {
+        std::cerr << e.what() << std::endl;
+        return 1;
+    }
+
+    // Scanner + Parser
+    // The parser pulls tokens straight from the lexer, so memory stays bounded by the parse stack. Large inputs on a
+    // multi-core machine are instead lexed up front by the parallel scanner and replayed.
+    std::ofstream ofs{"../xer/sample_program.tokens"}; // std::ofstream ofs{"/dev/null"};
+    Interner symbols;
+    TypeTable types{symbols};
+    Arena ast; // owns every AST node; the whole tree is released at once when main returns
+    ASTNode* root = nullptr;
+    FlatAST flat_ast;
+    ParserContext parser;
+    const auto parse_tokens = [&](TokenSource& tokens) {
+        if (flat_syntax) return parser.parse_flat(tokens, *source, types, flat_ast, std::cerr);
+        root = fused ? parser.parse_checked(tokens, *source, symbols, types, ast, std::cerr)
+                     : parser.parse(tokens, *source, types, ast, std::cerr);
+        return root != nullptr;
+    };
+    bool parsed;
+    if (source->text().size() >= PARALLEL_SCAN_MIN_BYTES && std::thread::hardware_concurrency() > 1) {
+        std::vector<Token> stream = {{Parser::ParserSymbol::BoF}};
+        scan(*source, symbols, ofs, stream, std::cerr);
+        const bool failed = stream.back().type == Parser::ParserSymbol::DOLLAR;
+        const auto eof = static_cast<uint32_t>(source->text().size());
+        if (!failed) stream.push_back({Parser::ParserSymbol::EoF, eof});
+        VectorTokenSource tokens{stream, failed};
+        parsed = parse_tokens(tokens);
+    }
+    else {
+        Lexer tokens{*source, symbols, std::cerr, &ofs};
+        parsed = parse_tokens(tokens);
+    }
+    if (!parsed) return 1;
+    if (flat_syntax) {
+        OutputBuffer out{STDOUT_FILENO};
+        print_flat_ast(flat_ast, symbols, out);
+        out.flush();
+        return out.good() ? 0 : 1;
+    }
 
     // Semantic Analysis
-    Printer printer;
-    root->accept(printer);
-}
\ No newline at end of file
+    ProgramNode& program = *ast_cast<ProgramNode>(root);
+    if (!fused && !resolve_names(program, ast, symbols, types, std::cerr)) return 1;
+    if (!fused && !check_types(program, types, symbols, std::cerr)) return 1;
+    if (!lay_out_structs(program, types, symbols, field_order, std::cerr)) return 1;
+
+    // Intermediate Representation, verified after each pass
+    if (dump_ir) {
+        IRProgram ir;
+        lower_program(*ast_cast<ProgramNode>(root), types, ir);
+        if (!verify_ir(ir, types, symbols, std::cerr)) return 1;
+        if (mem2reg) {
+            promote_locals(ir, types);
+            if (!verify_ir(ir, types, symbols, std::cerr)) return 1;
+        }
+        OutputBuffer out{STDOUT_FILENO};
+        print_ir(ir, types, symbols, out);
+        out.flush();
+        return out.good() ? 0 : 1;
+    }
+
+    // Code Generation (the assembly goes next to the executable unless asked for, and is removed once linked)
+    if (exe_path || asm_path) {
+        const std::string assembly = asm_path ? asm_path : std::string{exe_path} + ".s";
+        std::ofstream file{assembly};
+        if (!file) {
+            std::cerr << "Cannot write " << assembly << std::endl;
+            return 1;
+        }
+        OutputBuffer out{file};
+        generate_assembly(*ast_cast<ProgramNode>(root), types, symbols, out);
+        out.flush();
+        file.close();
+        bool built = file.good();
+        if (!built) std::cerr << "Cannot write " << assembly << std::endl;
+        built = built && (!exe_path || assemble_and_link(assembly, exe_path, std::cerr));
+        if (!asm_path) std::remove(assembly.c_str());
+        return built ? 0 : 1;
+    }
+
+    if (flat || emit_path) flatten_ast(*root, types, flat_ast);
+    if (emit_path) {
+        try {
+            write_ast_file(flat_ast, symbols, emit_path);
+            return 0;
+        } catch (std::exception& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    OutputBuffer out{STDOUT_FILENO};
+    if (flat) print_flat_ast(flat_ast, symbols, out);
+    else if (layout_report) print_layout_report(*ast_cast<ProgramNode>(root), types, symbols, out);
+    else dump_ast(*root, symbols, types, format, out);
+    out.flush();
+    return out.good() ? 0 : 1;
+}
@@ -1,41 +1,67 @@
 #include "ast.h"
-#include <memory>
-#include <utility>
+#include <charconv>
+
+int parse_int(std::string_view lexeme) {
+    int val = 0;
+    std::from_chars(lexeme.data(), lexeme.data() + lexeme.size(), val);
+    return val;
+}
+
+// The control characters a CHARLIT escape can write, and the letter after the backslash for each
+#define CHAR_ESCAPES "\n\t\r\b\a\0\f\v"
+#define ESCAPE_LETTERS "ntrba0fv"
+
+char parse_char(std::string_view lexeme) {
+    if (lexeme.size() == 3) return lexeme.at(1);
+    const size_t escape = std::string_view{ESCAPE_LETTERS}.find(lexeme.at(2));
+    return escape == std::string_view::npos ? lexeme.at(2) : CHAR_ESCAPES[escape];
+}
+
+std::string_view spell_char(const char& c) {
+    static constexpr std::string_view escapes[] = {"\\n", "\\t", "\\r", "\\b", "\\a", "\\0", "\\f", "\\v"};
+    constexpr std::string_view controls{CHAR_ESCAPES, sizeof(CHAR_ESCAPES) - 1};
+    const size_t escape = controls.find(c);
+    if (escape != std::string_view::npos) return escapes[escape];
+    if (c == '\\') return "\\\\";
+    return {&c, 1};
+}
 
 //// Base Classes
 
-ArgsNode::ArgsNode() : ASTNode{Parser::ParserSymbol::args}, args{} {}
+ArgsNode::ArgsNode(std::pmr::memory_resource* mem) : ASTNode{Parser::ParserSymbol::args}, args{mem} {}
 
-DeclarationsNode::DeclarationsNode() : ASTNode{Parser::ParserSymbol::dcls}, declarations{} {}
+DeclarationsNode::DeclarationsNode(std::pmr::memory_resource* mem)
+    : ASTNode{Parser::ParserSymbol::dcls}, declarations{mem} {}
 
-TypeNode::TypeNode(std::string lexeme) : ASTNode{Parser::ParserSymbol::type}, lexeme{std::move(lexeme)} {}
+TypeNode::TypeNode(TypeId type) : ASTNode{Parser::ParserSymbol::type}, type{type} {}
 
 StarNode::StarNode() : ASTNode{Parser::ParserSymbol::AT}, count{0} {}
 
-ForPrologueNode::ForPrologueNode(std::unique_ptr<VarInitNode> init)
-    : ASTNode{Parser::ParserSymbol::forprologue}, init{std::move(init)}, asst{nullptr} {}
-ForPrologueNode::ForPrologueNode(std::unique_ptr<AssignmentNode> asst)
-    : ASTNode{Parser::ParserSymbol::forprologue}, init{nullptr}, asst{std::move(asst)} {}
+ForPrologueNode::ForPrologueNode(VarInitNode* init)
+    : ASTNode{Parser::ParserSymbol::forprologue}, init{init}, asst{nullptr} {}
+ForPrologueNode::ForPrologueNode(AssignmentNode* asst)
+    : ASTNode{Parser::ParserSymbol::forprologue}, init{nullptr}, asst{asst} {}
 
-StructDefNode::StructDefNode(std::string id, std::unique_ptr<DeclarationsNode> dcls)
-    : ASTNode{Parser::ParserSymbol::structdef}, id{std::move(id)}, fields{std::move(dcls)} {}
+StructDefNode::StructDefNode(Symbol id, TypeId type, DeclarationsNode* dcls)
+    : ASTNode{Parser::ParserSymbol::structdef}, id{id}, type{type}, fields{dcls} {}
 
-ProcedureNode::ProcedureNode(std::string id, std::string return_type, std::unique_ptr<DeclarationsNode> params,
-                             std::unique_ptr<BlockNode> block)
-    : ASTNode{Parser::ParserSymbol::procedure}, id{std::move(id)}, symbol_table{}, params{std::move(params)},
-      block{std::move(block)}, return_type{std::move(return_type)} {}
-ProcedureNode::ProcedureNode(std::string id, std::string return_type, std::unique_ptr<DeclarationsNode> params,
-                             std::unique_ptr<BlockNode> block, Parser::ParserSymbol node_type)
-    : ASTNode{node_type}, id{std::move(id)}, symbol_table{}, params{std::move(params)},
-      block{std::move(block)}, return_type{std::move(return_type)} {}
+ProcedureNode::ProcedureNode(std::pmr::memory_resource* mem, Symbol id, TypeId return_type, DeclarationsNode* params,
+                             BlockNode* block)
+    : ASTNode{Parser::ParserSymbol::procedure}, id{id}, symbol_table{mem}, params{params},
+      block{block}, return_type{return_type} {}
+ProcedureNode::ProcedureNode(std::pmr::memory_resource* mem, Symbol id, TypeId return_type, DeclarationsNode* params,
+                             BlockNode* block, Parser::ParserSymbol node_type)
+    : ASTNode{node_type}, id{id}, symbol_table{mem}, params{params},
+      block{block}, return_type{return_type} {}
 
-MainNode::MainNode(std::unique_ptr<BlockNode> b)
-    : ProcedureNode{"main", "int", nullptr, std::move(b), Parser::ParserSymbol::MAIN} {}
+MainNode::MainNode(std::pmr::memory_resource* mem, BlockNode* b)
+    : ProcedureNode{mem, SYM_MAIN, TYPE_INT, nullptr, b, Parser::ParserSymbol::MAIN} {}
 
-ProgramNode::ProgramNode()
-    : ASTNode{Parser::ParserSymbol::start}, struct_defs{}, global_vars{}, procedures{}, main{nullptr} {}
+ProgramNode::ProgramNode(std::pmr::memory_resource* mem)
+    : ASTNode{Parser::ParserSymbol::start}, struct_defs{mem}, global_vars{mem}, procedures{mem}, main{nullptr},
+      symbol_table{mem} {}
 
-BlockNode::BlockNode() : ASTNode{Parser::ParserSymbol::statements}, statements{} {}
+BlockNode::BlockNode(std::pmr::memory_resource* mem) : ASTNode{Parser::ParserSymbol::statements}, statements{mem} {}
 
 //// Statements
 
@@ -45,109 +71,83 @@ StatementNode::StatementNode(Parser::ParserSymbol node_type) : ASTNode{node_type
 
 ExprNode::ExprNode() : StatementNode{Parser::ParserSymbol::expr1} {}
 ExprNode::ExprNode(Parser::ParserSymbol node_type) : StatementNode{node_type} {}
-ExprNode::ExprNode(std::string type, Parser::ParserSymbol node_type)
-    : StatementNode{node_type}, type{std::move(type)} {}
+ExprNode::ExprNode(TypeId type, Parser::ParserSymbol node_type)
+    : StatementNode{node_type}, type{type} {}
 
-NumNode::NumNode(const std::string& lexeme)
-    : ExprNode{"int", Parser::ParserSymbol::NUM}, val{std::stoi(lexeme)} {}
+NumNode::NumNode(std::string_view lexeme)
+    : ExprNode{TYPE_INT, Parser::ParserSymbol::NUM}, val{parse_int(lexeme)} {}
 
-CharNode::CharNode(const std::string& lexeme)
-    : ExprNode{"char", Parser::ParserSymbol::CHARLIT},
-      val{(lexeme.size() == 3) ? lexeme.at(1) : lexeme.at(2)} {}
+CharNode::CharNode(std::string_view lexeme)
+    : ExprNode{TYPE_CHAR, Parser::ParserSymbol::CHARLIT}, val{parse_char(lexeme)} {}
 
-TrueNode::TrueNode() : ExprNode{"bool", Parser::ParserSymbol::TRUE}, val{true} {}
+TrueNode::TrueNode() : ExprNode{TYPE_BOOL, Parser::ParserSymbol::TRUE}, val{true} {}
 
-FalseNode::FalseNode() : ExprNode{"bool", Parser::ParserSymbol::FALSE}, val{false} {}
+FalseNode::FalseNode() : ExprNode{TYPE_BOOL, Parser::ParserSymbol::FALSE}, val{false} {}
 
-IDNode::IDNode(std::string lexeme)
-    : ExprNode{Parser::ParserSymbol::ID}, name{std::move(lexeme)} {}
+IDNode::IDNode(Symbol name)
+    : ExprNode{Parser::ParserSymbol::ID}, name{name} {}
 
-NilNode::NilNode() : ExprNode{"*", Parser::ParserSymbol::NIL} {}
+NilNode::NilNode() : ExprNode{TYPE_NIL, Parser::ParserSymbol::NIL} {}
 
-BinaryExprNode::BinaryExprNode(Parser::ParserSymbol op, std::unique_ptr<ExprNode> l, std::unique_ptr<ExprNode> r)
-    : ExprNode{op}, op{op}, LHS{std::move(l)}, RHS{std::move(r)} {}
+BinaryExprNode::BinaryExprNode(Parser::ParserSymbol op, ExprNode* l, ExprNode* r)
+    : ExprNode{op}, op{op}, LHS{l}, RHS{r} {}
 
-MemberAccessExprNode::MemberAccessExprNode(Parser::ParserSymbol op, std::unique_ptr<ExprNode> arg, std::string id)\
-    : ExprNode{op}, op{op}, arg{std::move(arg)}, id{std::move(id)} {}
+MemberAccessExprNode::MemberAccessExprNode(Parser::ParserSymbol op, ExprNode* arg, Symbol id)
+    : ExprNode{op}, op{op}, arg{arg}, id{id} {}
 
-UnaryExprNode::UnaryExprNode(Parser::ParserSymbol op, std::unique_ptr<ExprNode> arg)
-    : ExprNode{op}, op{op}, arg{std::move(arg)} {}
+UnaryExprNode::UnaryExprNode(Parser::ParserSymbol op, ExprNode* arg, bool postfix)
+    : ExprNode{postfix ? Parser::ParserSymbol::expr13 : Parser::ParserSymbol::expr11}, op{op}, arg{arg} {}
 
-AllocNode::AllocNode(std::string type, int size)
-    : ExprNode{Parser::ParserSymbol::NEW}, ptr_type{std::move(type)}, size{size} {}
+AllocNode::AllocNode(TypeId type, int size)
+    : ExprNode{Parser::ParserSymbol::NEW}, ptr_type{type}, size{size} {}
 
-FunctionCallNode::FunctionCallNode(std::string id, std::unique_ptr<ArgsNode> args)
-    : ExprNode{Parser::ParserSymbol::paramlist}, id{std::move(id)}, args{std::move(args)} {}
-FunctionCallNode::FunctionCallNode(std::string id, std::unique_ptr<ArgsNode> args, Parser::ParserSymbol node_type)
-    : ExprNode{node_type}, id{std::move(id)}, args{std::move(args)} {}
+FunctionCallNode::FunctionCallNode(Symbol id, ArgsNode* args)
+    : ExprNode{Parser::ParserSymbol::paramlist}, id{id}, args{args} {}
+FunctionCallNode::FunctionCallNode(Symbol id, ArgsNode* args, Parser::ParserSymbol node_type)
+    : ExprNode{node_type}, id{id}, args{args} {}
 
-ReadCallNode::ReadCallNode() : FunctionCallNode{"read", nullptr, Parser::ParserSymbol::READ} {}
+ReadCallNode::ReadCallNode() : FunctionCallNode{SYM_READ, nullptr, Parser::ParserSymbol::READ} {}
 
 /////////
 
 // Statements
 
-DeclarationNode::DeclarationNode(std::string type, std::string id)
-    : StatementNode{Parser::ParserSymbol::dcl}, type{std::move(type)}, id{std::move(id)} {}
+DeclarationNode::DeclarationNode(TypeId type, Symbol id)
+    : StatementNode{Parser::ParserSymbol::dcl}, type{type}, id{id} {}
 
-VarInitNode::VarInitNode(std::unique_ptr<DeclarationNode> dcl)
-    : StatementNode{Parser::ParserSymbol::expr2}, dcl{std::move(dcl)}, val{nullptr} {}
-VarInitNode::VarInitNode(std::unique_ptr<DeclarationNode> dcl, std::unique_ptr<ExprNode> val)
-    : StatementNode{Parser::ParserSymbol::expr2}, dcl{std::move(dcl)}, val{std::move(val)} {}
+VarInitNode::VarInitNode(DeclarationNode* dcl)
+    : StatementNode{Parser::ParserSymbol::statement}, dcl{dcl}, val{nullptr} {}
+VarInitNode::VarInitNode(DeclarationNode* dcl, ExprNode* val)
+    : StatementNode{Parser::ParserSymbol::statement}, dcl{dcl}, val{val} {}
 
-IfNode::IfNode() : StatementNode{Parser::ParserSymbol::IF}, clauses{} {}
+IfNode::IfNode(std::pmr::memory_resource* mem) : StatementNode{Parser::ParserSymbol::IF}, clauses{mem} {}
 
-DeleteNode::DeleteNode(std::unique_ptr<ExprNode> ptr)
-    : StatementNode{Parser::ParserSymbol::DELETE}, ptr{std::move(ptr)} {}
+DeleteNode::DeleteNode(ExprNode* ptr)
+    : StatementNode{Parser::ParserSymbol::DELETE}, ptr{ptr} {}
 
-PrintNode::PrintNode(std::unique_ptr<ArgsNode> args)
-    : StatementNode{Parser::ParserSymbol::PRINT}, args{std::move(args)} {}
+PrintNode::PrintNode(ArgsNode* args)
+    : StatementNode{Parser::ParserSymbol::PRINT}, args{args} {}
 
-ReturnNode::ReturnNode(std::unique_ptr<ExprNode> expr)
-    : StatementNode{Parser::ParserSymbol::RETURN}, expr{std::move(expr)} {}
+ReturnNode::ReturnNode(ExprNode* expr)
+    : StatementNode{Parser::ParserSymbol::RETURN}, expr{expr} {}
 
-WhileNode::WhileNode(std::unique_ptr<ExprNode> condition, std::unique_ptr<BlockNode> statements)
-    : StatementNode{Parser::ParserSymbol::WHILE}, condition{std::move(condition)}, statements{std::move(statements)} {}
+WhileNode::WhileNode(ExprNode* condition, BlockNode* statements)
+    : StatementNode{Parser::ParserSymbol::WHILE}, condition{condition}, statements{statements} {}
 
-AssignmentNode::AssignmentNode(std::unique_ptr<ExprNode> LHS, std::unique_ptr<ExprNode> RHS)
-    : StatementNode{Parser::ParserSymbol::BECOMES}, LHS{std::move(LHS)}, RHS{std::move(RHS)} {}
+AssignmentNode::AssignmentNode(ExprNode* LHS, ExprNode* RHS)
+    : StatementNode{Parser::ParserSymbol::BECOMES}, LHS{LHS}, RHS{RHS} {}
 
-ForNode::ForNode(std::unique_ptr<ForPrologueNode> pro, std::unique_ptr<ExprNode> cond,
-                 std::unique_ptr<StatementNode> asst, std::unique_ptr<BlockNode> block)
-    : StatementNode{Parser::ParserSymbol::FOR}, prologue{std::move(pro)}, cond{std::move(cond)},
-      epilogue{std::move(asst)}, block{std::move(block)} {}
+ForNode::ForNode(ForPrologueNode* pro, ExprNode* cond,
+                 StatementNode* asst, BlockNode* block)
+    : StatementNode{Parser::ParserSymbol::FOR}, prologue{pro}, cond{cond},
+      epilogue{asst}, block{block} {}
 
 BreakNode::BreakNode() : StatementNode{Parser::ParserSymbol::BREAK} {}
 
 //// Visitor
 
-void ArgsNode::accept(struct Visitor& v) { v.visit(*this); }
-void DeclarationsNode::accept(struct Visitor& v) { v.visit(*this); }
-void ForPrologueNode::accept(struct Visitor& v) { v.visit(*this); }
-void ProgramNode::accept(struct Visitor& v) { v.visit(*this); }
-void StructDefNode::accept(struct Visitor& v) { v.visit(*this); }
-void ProcedureNode::accept(struct Visitor& v) { v.visit(*this); }
-void MainNode::accept(struct Visitor& v) { v.visit(*this); }
-void BlockNode::accept(struct Visitor& v) { v.visit(*this); }
-void DeclarationNode::accept(struct Visitor& v) { v.visit(*this); }
-void VarInitNode::accept(struct Visitor& v) { v.visit(*this); }
-void IfNode::accept(struct Visitor& v) { v.visit(*this); }
-void DeleteNode::accept(struct Visitor& v) { v.visit(*this); }
-void PrintNode::accept(struct Visitor& v) { v.visit(*this); }
-void ReturnNode::accept(struct Visitor& v) { v.visit(*this); }
-void WhileNode::accept(struct Visitor& v) { v.visit(*this); }
-void AssignmentNode::accept(struct Visitor& v) { v.visit(*this); }
-void ForNode::accept(struct Visitor& v) { v.visit(*this); }
-void BreakNode::accept(struct Visitor& v) { v.visit(*this); }
-void NumNode::accept(struct Visitor& v) { v.visit(*this); }
-void CharNode::accept(struct Visitor& v) { v.visit(*this); }
-void TrueNode::accept(struct Visitor& v) { v.visit(*this); }
-void FalseNode::accept(struct Visitor& v) { v.visit(*this); }
-void IDNode::accept(struct Visitor& v) { v.visit(*this); }
-void NilNode::accept(struct Visitor& v) { v.visit(*this); }
-void BinaryExprNode::accept(struct Visitor& v) { v.visit(*this); }
-void MemberAccessExprNode::accept(struct Visitor& v) { v.visit(*this); }
-void UnaryExprNode::accept(struct Visitor& v) { v.visit(*this); }
-void AllocNode::accept(struct Visitor& v) { v.visit(*this); }
-void FunctionCallNode::accept(struct Visitor& v) { v.visit(*this); }
-void ReadCallNode::accept(struct Visitor& v) { v.visit(*this); }
\ No newline at end of file
+void ASTNode::accept(struct Visitor& v) {
+    const auto visit = DISPATCH_TABLE<Visitor>[node_type];
+    assert(visit && "accept on a node_type no AST class carries");
+    visit(v, *this);
+}
@@ -1,80 +1,86 @@
 #ifndef XERLANG_AST_H
 #define XERLANG_AST_H
 
-#include <unordered_map>
-#include <memory>
+#include <array>
+#include <cassert>
+#include <initializer_list>
+#include <memory_resource>
+#include <string_view>
+#include "../util/interner.h"
 #include "../util/types.h"
 
+int parse_int(std::string_view lexeme);
+// The character a CHARLIT lexeme ('a', '\n', ...) stands for
+char parse_char(std::string_view lexeme);
+// The inverse, without the quotes: c itself (which the result views), or the escape a CHARLIT writes it with ("\\n"
+// for a newline)
+std::string_view spell_char(const char& c);
+
+// Nodes are allocated in the compilation unit's Arena (util/arena.h) and never destroyed one by one: child links are
+// plain non-owning pointers, and the lists and symbol tables draw from the arena memory passed to their constructor.
+
 //// Base Classes
 
 struct ArgsNode : public ASTNode {
-    std::vector<std::unique_ptr<ExprNode>> args;
-    ArgsNode();
-    void accept(Visitor& v) override;
+    std::pmr::vector<ExprNode*> args;
+    explicit ArgsNode(std::pmr::memory_resource* mem);
 };
 
 struct DeclarationsNode : public ASTNode {
-    std::vector<std::unique_ptr<DeclarationNode>> declarations;
-    DeclarationsNode();
-    void accept(Visitor& v) override;
+    std::pmr::vector<DeclarationNode*> declarations;
+    explicit DeclarationsNode(std::pmr::memory_resource* mem);
 };
 
 struct TypeNode : public ASTNode {
-    const std::string lexeme;
-    TypeNode(std::string lexeme);
-    void accept(Visitor& v) override {}
+    const TypeId type;
+    TypeNode(TypeId type);
 };
 
 struct StarNode : public ASTNode {
     size_t count = 0;
     StarNode();
-    void accept(Visitor& v) override {}
 };
 
 struct ForPrologueNode : public ASTNode {
-    std::unique_ptr<VarInitNode> init;
-    std::unique_ptr<AssignmentNode> asst;
-    ForPrologueNode(std::unique_ptr<VarInitNode> init);
-    ForPrologueNode(std::unique_ptr<AssignmentNode> asst);
-    void accept(Visitor& v) override;
+    VarInitNode* init;
+    AssignmentNode* asst;
+    ForPrologueNode(VarInitNode* init);
+    ForPrologueNode(AssignmentNode* asst);
 };
 
 struct StructDefNode : public ASTNode {
-    const std::string id;
-    std::unique_ptr<DeclarationsNode> fields;
-    StructDefNode(std::string id, std::unique_ptr<DeclarationsNode> dcls);
-    void accept(Visitor& v) override;
+    const Symbol id;
+    const TypeId type; // the struct type it defines
+    DeclarationsNode* fields;
+    StructDefNode(Symbol id, TypeId type, DeclarationsNode* dcls);
 };
 
 struct ProcedureNode : public ASTNode {
-    std::string id;
-    std::unordered_map<std::string, SymbolTableEntry> symbol_table;
-    std::unique_ptr<DeclarationsNode> params;
-    std::unique_ptr<BlockNode> block;
-    std::string return_type;
-    ProcedureNode(std::string id, std::string return_type, std::unique_ptr<DeclarationsNode> params, std::unique_ptr<BlockNode> block);
-    ProcedureNode(std::string id, std::string return_type, std::unique_ptr<DeclarationsNode> params, std::unique_ptr<BlockNode> block, Parser::ParserSymbol node_type);
-    void accept(Visitor& v) override;
+    Symbol id;
+    std::pmr::vector<SymbolTableEntry*> symbol_table; // params then locals, in declaration order; filled by resolve_names
+    DeclarationsNode* params;
+    BlockNode* block;
+    TypeId return_type;
+    ProcedureNode(std::pmr::memory_resource* mem, Symbol id, TypeId return_type, DeclarationsNode* params, BlockNode* block);
+    ProcedureNode(std::pmr::memory_resource* mem, Symbol id, TypeId return_type, DeclarationsNode* params, BlockNode* block, Parser::ParserSymbol node_type);
 };
 
 struct MainNode : public ProcedureNode {
-    MainNode(std::unique_ptr<BlockNode> b);
-    void accept(Visitor& v) override;
+    MainNode(std::pmr::memory_resource* mem, BlockNode* b);
 };
 
 struct ProgramNode : public ASTNode {
-    std::vector<std::unique_ptr<StructDefNode>> struct_defs;
-    std::vector<std::unique_ptr<VarInitNode>> global_vars;
-    std::vector<std::unique_ptr<ProcedureNode>> procedures;
-    std::unique_ptr<MainNode> main;
-    ProgramNode();
-    void accept(Visitor& v) override;
+    std::pmr::vector<StructDefNode*> struct_defs;
+    std::pmr::vector<VarInitNode*> global_vars;
+    std::pmr::vector<ProcedureNode*> procedures;
+    MainNode* main;
+    std::pmr::vector<SymbolTableEntry*> symbol_table; // structs, globals and procedures; filled by resolve_names
+    explicit ProgramNode(std::pmr::memory_resource* mem);
 };
 
 struct BlockNode : public ASTNode {
-    std::vector<std::unique_ptr<StatementNode>> statements;
-    BlockNode();
-    void accept(Visitor& v) override;
+    std::pmr::vector<StatementNode*> statements;
+    explicit BlockNode(std::pmr::memory_resource* mem);
 };
 
 //// Statements
@@ -86,162 +92,299 @@ struct StatementNode : public ASTNode {
 // Expressions
 
 struct ExprNode : public StatementNode {
-    std::string type;
+    TypeId type = NO_TYPE_ID; // set for literals when built and for the rest by check_types
     ExprNode();
     ExprNode(Parser::ParserSymbol node_type);
-    ExprNode(std::string type, Parser::ParserSymbol node_type);
+    ExprNode(TypeId type, Parser::ParserSymbol node_type);
 };
 
 struct NumNode : public ExprNode {
     const int val;
-    NumNode(const std::string& lexeme);
-    void accept(Visitor& v) override;
+    NumNode(std::string_view lexeme);
 };
 
 struct CharNode : public ExprNode {
     const char val;
-    CharNode(const std::string& lexeme);
-    void accept(Visitor& v) override;
+    CharNode(std::string_view lexeme);
 };
 
 struct TrueNode : public ExprNode {
     const bool val = true;
     TrueNode();
-    void accept(Visitor& v) override;
 };
 
 struct FalseNode : public ExprNode {
     const bool val = false;
     FalseNode();
-    void accept(Visitor& v) override;
 };
 
 struct IDNode : public ExprNode {
-    const std::string name;
-    IDNode(std::string lexeme);
-    void accept(Visitor& v) override;
+    const Symbol name;
+    SymbolTableEntry* entry = nullptr; // the variable it names, once resolved
+    IDNode(Symbol name);
 };
 
 struct NilNode : public ExprNode {
     NilNode();
-    void accept(Visitor& v) override;
 };
 
 struct BinaryExprNode : public ExprNode {
     Parser::ParserSymbol op;
-    std::unique_ptr<ExprNode> LHS;
-    std::unique_ptr<ExprNode> RHS;
-    BinaryExprNode(Parser::ParserSymbol op, std::unique_ptr<ExprNode> l, std::unique_ptr<ExprNode> r);
-    void accept(Visitor& v) override;
+    ExprNode* LHS;
+    ExprNode* RHS;
+    BinaryExprNode(Parser::ParserSymbol op, ExprNode* l, ExprNode* r);
 };
 
 struct MemberAccessExprNode : public ExprNode {
     Parser::ParserSymbol op;
-    std::unique_ptr<ExprNode> arg;
-    const std::string id;
-    MemberAccessExprNode(Parser::ParserSymbol op, std::unique_ptr<ExprNode> arg, std::string id);
-    void accept(Visitor& v) override;
+    ExprNode* arg;
+    const Symbol id;
+    SymbolTableEntry* field = nullptr; // the field selected, once type checked
+    MemberAccessExprNode(Parser::ParserSymbol op, ExprNode* arg, Symbol id);
 };
 
+// Prefix forms are tagged expr11 and postfix ones (INCR, DECR) expr13, after their rungs of the grammar, so that
+// neither shares a tag with StarNode (AT) or with the binary PLUS and SUB
 struct UnaryExprNode : public ExprNode {
     Parser::ParserSymbol op;
-    std::unique_ptr<ExprNode> arg;
-    UnaryExprNode(Parser::ParserSymbol op, std::unique_ptr<ExprNode> arg);
-    void accept(Visitor& v) override;
+    ExprNode* arg;
+    UnaryExprNode(Parser::ParserSymbol op, ExprNode* arg, bool postfix);
+    [[nodiscard]] bool postfix() const { return node_type == Parser::ParserSymbol::expr13; }
 };
 
 struct AllocNode : public ExprNode {
-    const std::string ptr_type;
+    const TypeId ptr_type;
     const int size;
-    AllocNode(std::string type, int size);
-    void accept(Visitor& v) override;
+    AllocNode(TypeId type, int size);
 };
 
 struct FunctionCallNode : public ExprNode {
-    const std::string id;
-    std::unique_ptr<ArgsNode> args;
-    FunctionCallNode(std::string id, std::unique_ptr<ArgsNode> args);
-    FunctionCallNode(std::string id, std::unique_ptr<ArgsNode> args, Parser::ParserSymbol node_type);
-    void accept(Visitor& v) override;
+    const Symbol id;
+    ArgsNode* args;
+    SymbolTableEntry* callee = nullptr; // the procedure called, once resolved (read() has none)
+    FunctionCallNode(Symbol id, ArgsNode* args);
+    FunctionCallNode(Symbol id, ArgsNode* args, Parser::ParserSymbol node_type);
 };
 
 struct ReadCallNode : public FunctionCallNode {
     ReadCallNode();
-    void accept(Visitor& v) override;
 };
 
 // Statements
 
 struct DeclarationNode : public StatementNode {
-    std::string type;
-    std::string id;
-    DeclarationNode(std::string type, std::string id);
-    void accept(Visitor& v) override;
+    TypeId type;
+    Symbol id;
+    SymbolTableEntry* entry = nullptr; // the global, param, local or field it declares, once resolved
+    DeclarationNode(TypeId type, Symbol id);
 };
 
 struct VarInitNode : public StatementNode {
-    std::unique_ptr<DeclarationNode> dcl;
-    std::unique_ptr<ExprNode> val;
-    VarInitNode(std::unique_ptr<DeclarationNode> dcl);
-    VarInitNode(std::unique_ptr<DeclarationNode> dcl, std::unique_ptr<ExprNode> val);
-    void accept(Visitor& v) override;
+    DeclarationNode* dcl;
+    ExprNode* val;
+    VarInitNode(DeclarationNode* dcl);
+    VarInitNode(DeclarationNode* dcl, ExprNode* val);
 };
 
 struct IfNode : public StatementNode {
     struct IfClause {
-        std::unique_ptr<ExprNode> cond;
-        std::unique_ptr<BlockNode> block;
+        ExprNode* cond;
+        BlockNode* block;
     };
 
-    std::vector<IfClause> clauses;
-    IfNode();
-    void accept(Visitor& v) override;
+    std::pmr::vector<IfClause> clauses;
+    explicit IfNode(std::pmr::memory_resource* mem);
 };
 
 struct DeleteNode : public StatementNode {
-    std::unique_ptr<ExprNode> ptr;
-    DeleteNode(std::unique_ptr<ExprNode> ptr);
-    void accept(Visitor& v) override;
+    ExprNode* ptr;
+    DeleteNode(ExprNode* ptr);
 };
 
 struct PrintNode : public StatementNode {
-    std::unique_ptr<ArgsNode> args;
-    PrintNode(std::unique_ptr<ArgsNode> args);
-    void accept(Visitor& v) override;
+    ArgsNode* args;
+    PrintNode(ArgsNode* args);
 };
 
 struct ReturnNode : public StatementNode {
-    std::unique_ptr<ExprNode> expr;
-    ReturnNode(std::unique_ptr<ExprNode> expr);
-    void accept(Visitor& v) override;
+    ExprNode* expr;
+    ReturnNode(ExprNode* expr);
 };
 
 struct WhileNode : public StatementNode {
-    std::unique_ptr<ExprNode> condition;
-    std::unique_ptr<BlockNode> statements;
-    WhileNode(std::unique_ptr<ExprNode> condition, std::unique_ptr<BlockNode> statements);
-    void accept(Visitor& v) override;
+    ExprNode* condition;
+    BlockNode* statements;
+    WhileNode(ExprNode* condition, BlockNode* statements);
 };
 
 struct AssignmentNode : public StatementNode {
-    std::unique_ptr<ExprNode> LHS;
-    std::unique_ptr<ExprNode> RHS;
-    AssignmentNode(std::unique_ptr<ExprNode> LHS, std::unique_ptr<ExprNode> RHS);
-    void accept(Visitor& v) override;
+    ExprNode* LHS;
+    ExprNode* RHS;
+    AssignmentNode(ExprNode* LHS, ExprNode* RHS);
 };
 
 struct ForNode : public StatementNode {
-    std::unique_ptr<ForPrologueNode> prologue;
-    std::unique_ptr<ExprNode> cond;
-    std::unique_ptr<StatementNode> epilogue;
-    std::unique_ptr<BlockNode> block;
-    ForNode(std::unique_ptr<ForPrologueNode> pro, std::unique_ptr<ExprNode> cond, std::unique_ptr<StatementNode> asst, std::unique_ptr<BlockNode> block);
-    void accept(Visitor& v) override;
+    ForPrologueNode* prologue;
+    ExprNode* cond;
+    StatementNode* epilogue;
+    BlockNode* block;
+    ForNode(ForPrologueNode* pro, ExprNode* cond, StatementNode* asst, BlockNode* block);
 };
 
 struct BreakNode : public StatementNode {
     BreakNode();
-    void accept(Visitor& v) override;
+};
+
+//// Tag-checked downcasts
+
+// The set of node_type tags a node of some class (or of a class derived from it) can carry. node_type is enough to
+// tell every concrete class apart, so downcasts need neither RTTI nor dynamic_cast.
+using TagSet = std::array<bool, Parser::ParserSymbol::NUM_SYMBOLS>;
+
+consteval TagSet tags(std::initializer_list<Parser::ParserSymbol> own, std::initializer_list<TagSet> derived = {}) {
+    TagSet set{};
+    for (const Parser::ParserSymbol t : own) set[t] = true;
+    for (const TagSet& d : derived) {
+        for (size_t t = 0; t < set.size(); t++) set[t] = set[t] || d[t];
+    }
+    return set;
+}
+
+template <class T>
+inline constexpr TagSet NODE_TAGS = {}; // every AST class has its own specialisation below
+
+template <> inline constexpr TagSet NODE_TAGS<ArgsNode> = tags({Parser::args});
+template <> inline constexpr TagSet NODE_TAGS<DeclarationsNode> = tags({Parser::dcls});
+template <> inline constexpr TagSet NODE_TAGS<TypeNode> = tags({Parser::type});
+template <> inline constexpr TagSet NODE_TAGS<StarNode> = tags({Parser::AT});
+template <> inline constexpr TagSet NODE_TAGS<ForPrologueNode> = tags({Parser::forprologue});
+template <> inline constexpr TagSet NODE_TAGS<StructDefNode> = tags({Parser::structdef});
+template <> inline constexpr TagSet NODE_TAGS<MainNode> = tags({Parser::MAIN});
+template <> inline constexpr TagSet NODE_TAGS<ProcedureNode> = tags({Parser::procedure}, {NODE_TAGS<MainNode>});
+template <> inline constexpr TagSet NODE_TAGS<ProgramNode> = tags({Parser::start});
+template <> inline constexpr TagSet NODE_TAGS<BlockNode> = tags({Parser::statements});
+
+template <> inline constexpr TagSet NODE_TAGS<NumNode> = tags({Parser::NUM});
+template <> inline constexpr TagSet NODE_TAGS<CharNode> = tags({Parser::CHARLIT});
+template <> inline constexpr TagSet NODE_TAGS<TrueNode> = tags({Parser::TRUE});
+template <> inline constexpr TagSet NODE_TAGS<FalseNode> = tags({Parser::FALSE});
+template <> inline constexpr TagSet NODE_TAGS<IDNode> = tags({Parser::ID});
+template <> inline constexpr TagSet NODE_TAGS<NilNode> = tags({Parser::NIL});
+template <> inline constexpr TagSet NODE_TAGS<BinaryExprNode> = tags({
+    Parser::OR, Parser::AND, Parser::BITOR, Parser::BITXOR, Parser::BITAND, Parser::EQUALS, Parser::NEQ, Parser::LT,
+    Parser::LEQ, Parser::GT, Parser::GEQ, Parser::LSHIFT, Parser::RSHIFT, Parser::PLUS, Parser::SUB, Parser::MULT,
+    Parser::DIV, Parser::MOD, Parser::EXP});
+template <> inline constexpr TagSet NODE_TAGS<MemberAccessExprNode> = tags({Parser::ARROW, Parser::DOT});
+template <> inline constexpr TagSet NODE_TAGS<UnaryExprNode> = tags({Parser::expr11, Parser::expr13});
+template <> inline constexpr TagSet NODE_TAGS<AllocNode> = tags({Parser::NEW});
+template <> inline constexpr TagSet NODE_TAGS<ReadCallNode> = tags({Parser::READ});
+template <> inline constexpr TagSet NODE_TAGS<FunctionCallNode> = tags({Parser::paramlist}, {NODE_TAGS<ReadCallNode>});
+template <> inline constexpr TagSet NODE_TAGS<ExprNode> = tags({}, {
+    NODE_TAGS<NumNode>, NODE_TAGS<CharNode>, NODE_TAGS<TrueNode>, NODE_TAGS<FalseNode>, NODE_TAGS<IDNode>,
+    NODE_TAGS<NilNode>, NODE_TAGS<BinaryExprNode>, NODE_TAGS<MemberAccessExprNode>, NODE_TAGS<UnaryExprNode>,
+    NODE_TAGS<AllocNode>, NODE_TAGS<FunctionCallNode>});
+
+template <> inline constexpr TagSet NODE_TAGS<DeclarationNode> = tags({Parser::dcl});
+template <> inline constexpr TagSet NODE_TAGS<VarInitNode> = tags({Parser::statement});
+template <> inline constexpr TagSet NODE_TAGS<IfNode> = tags({Parser::IF});
+template <> inline constexpr TagSet NODE_TAGS<DeleteNode> = tags({Parser::DELETE});
+template <> inline constexpr TagSet NODE_TAGS<PrintNode> = tags({Parser::PRINT});
+template <> inline constexpr TagSet NODE_TAGS<ReturnNode> = tags({Parser::RETURN});
+template <> inline constexpr TagSet NODE_TAGS<WhileNode> = tags({Parser::WHILE});
+template <> inline constexpr TagSet NODE_TAGS<AssignmentNode> = tags({Parser::BECOMES});
+template <> inline constexpr TagSet NODE_TAGS<ForNode> = tags({Parser::FOR});
+template <> inline constexpr TagSet NODE_TAGS<BreakNode> = tags({Parser::BREAK});
+template <> inline constexpr TagSet NODE_TAGS<StatementNode> = tags({}, {
+    NODE_TAGS<DeclarationNode>, NODE_TAGS<VarInitNode>, NODE_TAGS<IfNode>, NODE_TAGS<DeleteNode>,
+    NODE_TAGS<PrintNode>, NODE_TAGS<ReturnNode>, NODE_TAGS<WhileNode>, NODE_TAGS<AssignmentNode>, NODE_TAGS<ForNode>,
+    NODE_TAGS<BreakNode>, NODE_TAGS<ExprNode>});
+
+// No tag may be claimed by two classes, except along an inheritance chain
+consteval bool tags_disjoint(std::initializer_list<TagSet> classes) {
+    for (size_t t = 0; t < Parser::ParserSymbol::NUM_SYMBOLS; t++) {
+        size_t claimed = 0;
+        for (const TagSet& c : classes) claimed += c[t];
+        if (claimed > 1) return false;
+    }
+    return true;
+}
+
+static_assert(tags_disjoint({
+    NODE_TAGS<ArgsNode>, NODE_TAGS<DeclarationsNode>, NODE_TAGS<TypeNode>, NODE_TAGS<StarNode>,
+    NODE_TAGS<ForPrologueNode>, NODE_TAGS<StructDefNode>, NODE_TAGS<ProcedureNode>, NODE_TAGS<ProgramNode>,
+    NODE_TAGS<BlockNode>, NODE_TAGS<NumNode>, NODE_TAGS<CharNode>, NODE_TAGS<TrueNode>, NODE_TAGS<FalseNode>,
+    NODE_TAGS<IDNode>, NODE_TAGS<NilNode>, NODE_TAGS<BinaryExprNode>, NODE_TAGS<MemberAccessExprNode>,
+    NODE_TAGS<UnaryExprNode>, NODE_TAGS<AllocNode>, NODE_TAGS<FunctionCallNode>, NODE_TAGS<DeclarationNode>,
+    NODE_TAGS<VarInitNode>, NODE_TAGS<IfNode>, NODE_TAGS<DeleteNode>, NODE_TAGS<PrintNode>, NODE_TAGS<ReturnNode>,
+    NODE_TAGS<WhileNode>, NODE_TAGS<AssignmentNode>, NODE_TAGS<ForNode>, NODE_TAGS<BreakNode>}),
+    "two AST classes share a node_type tag");
+
+template <class T>
+constexpr bool isa(const ASTNode& node) { return NODE_TAGS<T>[node.node_type]; }
+
+// Downcast checked against node_type in debug builds; a plain static_cast otherwise
+template <class T>
+T* ast_cast(ASTNode* node) {
+    assert((!node || isa<T>(*node)) && "ast_cast to the wrong node class");
+    return static_cast<T*>(node);
+}
+
+// Downcast that yields nullptr when node is not a T
+template <class T>
+T* ast_dyn_cast(ASTNode* node) {
+    return node && isa<T>(*node) ? static_cast<T*>(node) : nullptr;
+}
+
+//// Static dispatch
+
+template <class... Ts>
+struct NodeList {};
+
+// Every class a finished tree is made of, each ahead of its bases so a tag goes to the most derived class carrying
+// it. TypeNode and StarNode only exist on the parse stack.
+using CONCRETE_NODES = NodeList<
+    ArgsNode, DeclarationsNode, ForPrologueNode, StructDefNode, MainNode, ProcedureNode, ProgramNode, BlockNode,
+    DeclarationNode, VarInitNode, IfNode, DeleteNode, PrintNode, ReturnNode, WhileNode, AssignmentNode, ForNode,
+    BreakNode, NumNode, CharNode, TrueNode, FalseNode, IDNode, NilNode, BinaryExprNode, MemberAccessExprNode,
+    UnaryExprNode, AllocNode, ReadCallNode, FunctionCallNode>;
+
+template <class V, class T>
+void visit_as(V& v, ASTNode& node) { v.visit(static_cast<T&>(node)); }
+
+template <class V>
+using DispatchTable = std::array<void (*)(V&, ASTNode&), Parser::ParserSymbol::NUM_SYMBOLS>;
+
+template <class V, class... Ts>
+consteval DispatchTable<V> dispatch_table(NodeList<Ts...>) {
+    DispatchTable<V> table{};
+    std::array<bool, Parser::ParserSymbol::NUM_SYMBOLS> claimed{}; // not !table[t]: GCC's UBSan rejects that here
+    const auto claim = [&table, &claimed](const TagSet& tags, void (*visit)(V&, ASTNode&)) {
+        for (size_t t = 0; t < table.size(); t++) {
+            if (tags[t] && !claimed[t]) {
+                table[t] = visit;
+                claimed[t] = true;
+            }
+        }
+    };
+    (claim(NODE_TAGS<Ts>, &visit_as<V, Ts>), ...);
+    return table;
+}
+
+// node_type -> V::visit overload for the node's concrete class, resolved at compile time (an overload for a base
+// class such as ExprNode& catches all of its subclasses). Null for tags no finished tree contains.
+template <class V>
+inline constexpr DispatchTable<V> DISPATCH_TABLE = dispatch_table<V>(CONCRETE_NODES{});
+
+// CRTP base for passes dispatched without virtual calls: Derived overloads visit() for the node classes it handles
+// and recurses with dispatch(child). Each dispatch() is an indexed load and a direct call into Derived, so every call
+// site keeps its own branch prediction, which a single switch over node_type would share across the whole pass.
+template <class Derived>
+struct StaticVisitor {
+    void dispatch(ASTNode& node) {
+        const auto visit = DISPATCH_TABLE<Derived>[node.node_type];
+        assert(visit && "dispatch on a node_type no AST class carries");
+        visit(static_cast<Derived&>(*this), node);
+    }
 };
 
 #endif // XERLANG_AST_H
@@ -0,0 +1,204 @@
+#include "ast_file.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Byte offset of every section, derived from the counts in the header; end is the size of the whole file
+struct ASTFileLayout {
+    size_t kind, op, type, first_child, child_list, offset, length, payload, name_offsets, names, end;
+};
+
+constexpr size_t align8(size_t at) {
+    return (at + 7) & ~size_t{7};
+}
+
+ASTFileLayout layout(const ASTFileHeader& h) {
+    ASTFileLayout l{};
+    l.kind = align8(sizeof(ASTFileHeader));
+    l.op = align8(l.kind + size_t{h.nodes} * sizeof(Flat::NodeKind));
+    l.type = align8(l.op + size_t{h.nodes} * sizeof(uint8_t));
+    l.first_child = align8(l.type + size_t{h.nodes} * sizeof(Symbol));
+    l.child_list = align8(l.first_child + (size_t{h.nodes} + 1) * sizeof(uint32_t));
+    l.offset = align8(l.child_list + size_t{h.children} * sizeof(NodeId));
+    l.length = align8(l.offset + size_t{h.nodes} * sizeof(uint32_t));
+    l.payload = align8(l.length + size_t{h.nodes} * sizeof(uint32_t));
+    l.name_offsets = align8(l.payload + size_t{h.nodes} * sizeof(uint32_t));
+    l.names = align8(l.name_offsets + (size_t{h.symbols} + 1) * sizeof(uint32_t));
+    l.end = l.names + h.name_bytes;
+    return l;
+}
+
+//// Writing
+
+struct SectionWriter {
+    std::ofstream os;
+    size_t at = 0;
+
+    template <class T>
+    void section(size_t offset, std::span<const T> values) {
+        static constexpr char ZEROS[8] = {};
+        os.write(ZEROS, offset - at);
+        os.write(reinterpret_cast<const char*>(values.data()), values.size_bytes());
+        at = offset + values.size_bytes();
+    }
+};
+
+void write_ast_file(const FlatAST& ast, const Interner& symbols, const std::string& path) {
+    std::vector<uint32_t> name_offsets = {0};
+    std::string names;
+    for (Symbol sym = 0; sym < symbols.size(); sym++) {
+        names += symbols.name(sym);
+        name_offsets.push_back(names.size());
+    }
+
+    ASTFileHeader header{};
+    std::memcpy(header.magic, AST_FILE_MAGIC, sizeof(header.magic));
+    header.version = AST_FILE_VERSION;
+    header.byte_order = AST_FILE_BYTE_ORDER;
+    header.nodes = ast.size();
+    header.children = ast.child_list.size();
+    header.symbols = symbols.size();
+    header.root = ast.root;
+    header.name_bytes = names.size();
+    const ASTFileLayout l = layout(header);
+
+    SectionWriter w{std::ofstream{path, std::ios::binary | std::ios::trunc}};
+    if (!w.os) throw std::runtime_error{"ERROR: Cannot open AST file " + path + " for writing"};
+    const FlatView v = ast.view();
+    w.section(0, std::span<const ASTFileHeader>{&header, 1});
+    w.section(l.kind, v.kind);
+    w.section(l.op, v.op);
+    w.section(l.type, v.type);
+    w.section(l.first_child, v.first_child);
+    w.section(l.child_list, v.child_list);
+    w.section(l.offset, v.offset);
+    w.section(l.length, v.length);
+    w.section(l.payload, v.payload);
+    w.section(l.name_offsets, std::span<const uint32_t>{name_offsets});
+    w.section(l.names, std::span<const char>{names});
+    w.os.flush();
+    if (!w.os) throw std::runtime_error{"ERROR: Failed writing AST file " + path};
+}
+
+//// Loading
+
+template <class T>
+std::span<const T> section(const std::byte* data, size_t offset, size_t count) {
+    return {reinterpret_cast<const T*>(data + offset), count};
+}
+
+// Children the printer indexes directly, which a node of kind has to have at least
+uint32_t min_children(Flat::NodeKind kind) {
+    switch (kind) {
+        case Flat::MAIN: return 1;
+        case Flat::PROCEDURE:
+        case Flat::ASSIGNMENT:
+        case Flat::IF: return 2;
+        case Flat::FOR: return 4;
+        default: return 0;
+    }
+}
+
+bool names_symbol(Flat::NodeKind kind) {
+    switch (kind) {
+        case Flat::STRUCT_DEF:
+        case Flat::PROCEDURE:
+        case Flat::MAIN:
+        case Flat::DECLARATION:
+        case Flat::PARAM:
+        case Flat::LOCAL:
+        case Flat::ID:
+        case Flat::MEMBER:
+        case Flat::CALL:
+        case Flat::READ: return true;
+        default: return false;
+    }
+}
+
+bool has_type(Flat::NodeKind kind) {
+    return kind == Flat::PROCEDURE || kind == Flat::DECLARATION || kind == Flat::PARAM || kind == Flat::LOCAL ||
+           kind == Flat::ALLOC;
+}
+
+// Checks every index the arrays hold against what they index, so that nothing read through view() or name() later
+// can land outside the mapping; returns what is wrong, or nullptr. Children come before their parents, as both
+// flatten_ast and the parser number them, which also rules out cycles.
+const char* check_indices(const FlatView& ast, std::span<const uint32_t> name_offsets, uint64_t name_bytes) {
+    const size_t num_symbols = name_offsets.size() - 1;
+    if (name_offsets.front() != 0 || name_offsets.back() != name_bytes) return "has a corrupt string table";
+    for (size_t sym = 0; sym < num_symbols; sym++) {
+        if (name_offsets[sym] > name_offsets[sym + 1]) return "has a corrupt string table";
+    }
+
+    if (ast.first_child.front() != 0 || ast.first_child.back() != ast.child_list.size()) return "has a corrupt child index";
+    for (NodeId n = 0; n < ast.size(); n++) {
+        const Flat::NodeKind kind = ast.kind[n];
+        if (kind >= Flat::NUM_KINDS || ast.op[n] >= Parser::ParserSymbol::NUM_SYMBOLS) return "has a corrupt node";
+        if (ast.first_child[n] > ast.first_child[n + 1]) return "has a corrupt child index";
+        const std::span<const NodeId> kids = ast.children(n);
+        if (kids.size() < min_children(kind) || (kind == Flat::IF && kids.size() % 2 != 0)) return "has a corrupt node";
+        for (size_t i = 0; i < kids.size(); i++) {
+            const bool else_clause = kind == Flat::IF && i % 2 == 0 && i > 0;
+            if (kids[i] >= n && !(else_clause && kids[i] == NO_NODE)) return "has a corrupt child index";
+        }
+        if (names_symbol(kind) && ast.payload[n] >= num_symbols) return "has a corrupt symbol index";
+        if (ast.type[n] != NO_TYPE || has_type(kind)) {
+            if (ast.type[n] >= num_symbols) return "has a corrupt symbol index";
+        }
+    }
+    return nullptr;
+}
+
+ASTFile::ASTFile(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error{"ERROR: Cannot open AST file " + path};
+    struct stat st{};
+    if (::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && size_t(st.st_size) >= sizeof(ASTFileHeader)) {
+        void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            data = static_cast<const std::byte*>(addr);
+            size = st.st_size;
+        }
+    }
+    ::close(fd);
+    if (!data) throw std::runtime_error{"ERROR: Cannot map AST file " + path};
+
+    ASTFileHeader h;
+    std::memcpy(&h, data, sizeof(h));
+    const char* problem = nullptr;
+    if (std::memcmp(h.magic, AST_FILE_MAGIC, sizeof(h.magic)) != 0) problem = "is not an AST file";
+    else if (h.byte_order != AST_FILE_BYTE_ORDER) problem = "was written with the other byte order";
+    else if (h.version != AST_FILE_VERSION) problem = "was written by another version of the compiler";
+    else if (h.name_bytes > size || layout(h).end != size) problem = "is truncated or corrupt";
+    else if (h.root != NO_NODE && h.root >= h.nodes) problem = "has a corrupt root";
+    if (!problem) {
+        const ASTFileLayout l = layout(h);
+        flat = {
+            section<Flat::NodeKind>(data, l.kind, h.nodes),
+            section<uint8_t>(data, l.op, h.nodes),
+            section<Symbol>(data, l.type, h.nodes),
+            section<uint32_t>(data, l.first_child, size_t{h.nodes} + 1),
+            section<NodeId>(data, l.child_list, h.children),
+            section<uint32_t>(data, l.offset, h.nodes),
+            section<uint32_t>(data, l.length, h.nodes),
+            section<uint32_t>(data, l.payload, h.nodes),
+            h.root,
+        };
+        name_offsets = section<uint32_t>(data, l.name_offsets, size_t{h.symbols} + 1);
+        names = reinterpret_cast<const char*>(data + l.names);
+        problem = check_indices(flat, name_offsets, h.name_bytes);
+    }
+    if (problem) {
+        ::munmap(const_cast<std::byte*>(data), size);
+        throw std::runtime_error{"ERROR: AST file " + path + " " + problem};
+    }
+}
+
+ASTFile::~ASTFile() {
+    ::munmap(const_cast<std::byte*>(data), size);
+}
@@ -0,0 +1,61 @@
+#ifndef XERLANG_AST_FILE_H
+#define XERLANG_AST_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include "flat_ast.h"
+
+// Serialised AST: the FlatAST arrays and the names their Symbols refer to, laid out so that a mapped file can be
+// used in place. Bump AST_FILE_VERSION whenever the layout, the NodeKinds or the ParserSymbol numbering changes.
+#define AST_FILE_MAGIC "XERAST\r\n"
+#define AST_FILE_VERSION uint32_t{2}
+#define AST_FILE_BYTE_ORDER uint32_t{0x01020304}
+
+// File layout: this header, then kind, op, type, first_child (nodes + 1 entries), child_list, offset, length,
+// payload, the name offsets (symbols + 1 entries) and the name characters. Every array starts on an 8-byte boundary
+// and holds native-endian values; byte_order tells a reader with the other endianness to reject the file.
+struct ASTFileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t nodes;
+    uint32_t children;
+    uint32_t symbols;
+    NodeId root;
+    uint64_t name_bytes;
+};
+
+// Writes ast and the names of every symbol in symbols. Throws std::runtime_error if path cannot be written.
+void write_ast_file(const FlatAST& ast, const Interner& symbols, const std::string& path);
+
+// An AST file mapped read-only. Loading checks the header, the file size and, in one pass over the arrays, that every
+// child, symbol and string index is in range, and copies nothing: view() and name() point straight into the mapping.
+// Throws std::runtime_error if the file cannot be mapped, is not an AST file of this version or is corrupt.
+class ASTFile {
+    const std::byte* data = nullptr;
+    size_t size = 0;
+    FlatView flat;
+    std::span<const uint32_t> name_offsets;
+    const char* names = nullptr;
+
+public:
+    explicit ASTFile(const std::string& path);
+    ASTFile(const ASTFile&) = delete;
+    ASTFile& operator=(const ASTFile&) = delete;
+    ~ASTFile();
+
+    [[nodiscard]] const FlatView& view() const { return flat; }
+    [[nodiscard]] std::string_view name(Symbol sym) const {
+        return {names + name_offsets[sym], name_offsets[sym + 1] - name_offsets[sym]};
+    }
+    [[nodiscard]] size_t num_symbols() const { return name_offsets.size() - 1; }
+};
+
+inline void print_flat_ast(const ASTFile& file, OutputBuffer& out) {
+    print_flat_ast(file.view(), file, out);
+}
+
+#endif // XERLANG_AST_FILE_H
@@ -0,0 +1,416 @@
+#include "flat_ast.h"
+#include <algorithm>
+#include "ast.h"
+#include "ast_file.h"
+
+#define INDENT 4
+
+size_t FlatAST::bytes() const {
+    return kind.capacity() * sizeof(Flat::NodeKind) + op.capacity() * sizeof(uint8_t) + type.capacity() * sizeof(Symbol) +
+           first_child.capacity() * sizeof(uint32_t) + child_list.capacity() * sizeof(NodeId) +
+           offset.capacity() * sizeof(uint32_t) + length.capacity() * sizeof(uint32_t) +
+           payload.capacity() * sizeof(uint32_t);
+}
+
+FlatView FlatAST::view() const {
+    return {kind, op, type, first_child, child_list, offset, length, payload, root};
+}
+
+void FlatAST::clear() {
+    kind.clear();
+    op.clear();
+    type.clear();
+    first_child.clear();
+    child_list.clear();
+    offset.clear();
+    length.clear();
+    payload.clear();
+    root = NO_NODE;
+}
+
+//// Building
+
+FlatBuilder::FlatBuilder(FlatAST& ast) : ast{ast} { ast.clear(); }
+
+NodeId FlatBuilder::add(const FlatNode& node, const Token& span, std::span<const NodeId> children) {
+    const auto id = static_cast<NodeId>(ast.kind.size());
+    ast.kind.push_back(node.kind);
+    ast.op.push_back(node.op);
+    ast.type.push_back(node.type);
+    ast.first_child.push_back(ast.child_list.size());
+    ast.child_list.insert(ast.child_list.end(), children.begin(), children.end());
+    ast.offset.push_back(span.offset);
+    ast.length.push_back(span.length);
+    ast.payload.push_back(node.payload);
+    return id;
+}
+
+uint32_t FlatBuilder::prepend(uint32_t list, NodeId node) {
+    links.push_back({node, list});
+    return links.size() - 1;
+}
+
+NodeId FlatBuilder::close(const FlatNode& node, const Token& span, uint32_t list, bool reversed) {
+    const NodeId id = add(node, span);
+    const size_t first = ast.child_list.size();
+    for (; list != NO_LIST; list = links[list].next) ast.child_list.push_back(links[list].node);
+    if (reversed) std::reverse(ast.child_list.begin() + first, ast.child_list.end());
+    return id;
+}
+
+void FlatBuilder::finish(NodeId root) {
+    ast.first_child.push_back(ast.child_list.size());
+    ast.root = root;
+    links.clear();
+}
+
+//// Flattening the pointer tree
+
+// Post-order walk that adds each node after its children, as the parser's flat actions do
+struct Flattener : public StaticVisitor<Flattener> {
+    const TypeTable& types;
+    FlatBuilder build;
+    NodeId last = NO_NODE; // id of the node dispatch() just added
+
+    Flattener(const TypeTable& types, FlatAST& ast) : types{types}, build{ast} {}
+
+    NodeId flatten(ASTNode* node) {
+        if (!node) return NO_NODE;
+        dispatch(*node);
+        return last;
+    }
+    template <class Range>
+    void append(std::vector<NodeId>& ids, const Range& nodes) {
+        for (ASTNode* node : nodes) ids.push_back(flatten(node));
+    }
+    void add(const FlatNode& node, std::span<const NodeId> children = {}) { last = build.add(node, Token{}, children); }
+    void add(const FlatNode& node, std::initializer_list<NodeId> children) { last = build.add(node, Token{}, children); }
+    // The type check_types gave an expression, if it has run
+    Symbol type_of(const ExprNode& a) const { return a.type == NO_TYPE_ID ? NO_TYPE : types.spelling(a.type); }
+    // Optional children are left out rather than stored as NO_NODE
+    void add_present(const FlatNode& node, std::initializer_list<NodeId> children) {
+        std::vector<NodeId> ids;
+        for (const NodeId c : children) if (c != NO_NODE) ids.push_back(c);
+        add(node, ids);
+    }
+
+    void visit(ArgsNode& a) {
+        std::vector<NodeId> ids;
+        append(ids, a.args);
+        add({.kind = Flat::ARGS}, ids);
+    }
+    void visit(DeclarationsNode& a) {
+        std::vector<NodeId> ids;
+        append(ids, a.declarations);
+        add({.kind = Flat::DECLS}, ids);
+    }
+    void visit(ForPrologueNode& a) {
+        add({.kind = Flat::FOR_PROLOGUE}, {a.init ? flatten(a.init) : flatten(a.asst)});
+    }
+    void visit(ProgramNode& a) {
+        std::vector<NodeId> ids;
+        append(ids, a.struct_defs);
+        append(ids, a.global_vars);
+        append(ids, a.procedures);
+        ids.push_back(flatten(a.main));
+        add({.kind = Flat::PROGRAM}, ids);
+    }
+    void visit(StructDefNode& a) {
+        add({.kind = Flat::STRUCT_DEF, .payload = a.id}, {flatten(a.fields)});
+    }
+    // The procedure's params and locals, as resolve_names listed them
+    NodeId symbol_table(const ProcedureNode& a) {
+        std::vector<NodeId> ids;
+        for (const SymbolTableEntry* entry : a.symbol_table) {
+            const Flat::NodeKind kind = entry->kind == SymbolTableEntry::PARAM ? Flat::PARAM : Flat::LOCAL;
+            ids.push_back(build.add({.kind = kind, .type = types.spelling(entry->type), .payload = entry->name}, Token{}));
+        }
+        return build.add({.kind = Flat::SYMBOL_TABLE}, Token{}, ids);
+    }
+    void visit(ProcedureNode& a) {
+        const NodeId params = flatten(a.params);
+        const NodeId block = flatten(a.block);
+        add({.kind = Flat::PROCEDURE, .type = types.spelling(a.return_type), .payload = a.id},
+            {params, block, symbol_table(a)});
+    }
+    void visit(MainNode& a) {
+        const NodeId block = flatten(a.block);
+        add({.kind = Flat::MAIN, .type = SYM_INT, .payload = SYM_MAIN}, {block, symbol_table(a)});
+    }
+    void visit(BlockNode& a) {
+        std::vector<NodeId> ids;
+        append(ids, a.statements);
+        add({.kind = Flat::BLOCK}, ids);
+    }
+    void visit(DeclarationNode& a) {
+        add({.kind = Flat::DECLARATION, .type = types.spelling(a.type), .payload = a.id});
+    }
+    void visit(VarInitNode& a) {
+        const NodeId dcl = flatten(a.dcl);
+        add_present({.kind = Flat::VAR_INIT}, {dcl, flatten(a.val)});
+    }
+    void visit(IfNode& a) {
+        std::vector<NodeId> ids;
+        for (const IfNode::IfClause& clause : a.clauses) {
+            ids.push_back(flatten(clause.cond));
+            ids.push_back(flatten(clause.block));
+        }
+        add({.kind = Flat::IF}, ids);
+    }
+    void visit(DeleteNode& a) { add({.kind = Flat::DELETE}, {flatten(a.ptr)}); }
+    void visit(PrintNode& a) { add({.kind = Flat::PRINT}, {flatten(a.args)}); }
+    void visit(ReturnNode& a) { add_present({.kind = Flat::RETURN}, {flatten(a.expr)}); }
+    void visit(WhileNode& a) {
+        const NodeId cond = flatten(a.condition);
+        add({.kind = Flat::WHILE}, {cond, flatten(a.statements)});
+    }
+    void visit(AssignmentNode& a) {
+        const NodeId lhs = flatten(a.LHS);
+        add({.kind = Flat::ASSIGNMENT}, {lhs, flatten(a.RHS)});
+    }
+    void visit(ForNode& a) {
+        const NodeId prologue = flatten(a.prologue);
+        const NodeId cond = flatten(a.cond);
+        const NodeId epilogue = flatten(a.epilogue);
+        add({.kind = Flat::FOR}, {prologue, cond, epilogue, flatten(a.block)});
+    }
+    void visit(BreakNode&) { add({.kind = Flat::BREAK}); }
+    void visit(NumNode& a) { add({.kind = Flat::NUM, .type = SYM_INT, .payload = static_cast<uint32_t>(a.val)}); }
+    void visit(CharNode& a) {
+        add({.kind = Flat::CHARLIT, .type = SYM_CHAR, .payload = static_cast<unsigned char>(a.val)});
+    }
+    void visit(TrueNode&) { add({.kind = Flat::TRUE, .type = SYM_BOOL, .payload = 1}); }
+    void visit(FalseNode&) { add({.kind = Flat::FALSE, .type = SYM_BOOL}); }
+    void visit(IDNode& a) {
+        add({.kind = Flat::ID, .type = type_of(a), .payload = a.name});
+    }
+    void visit(NilNode& a) { add({.kind = Flat::NIL, .type = type_of(a)}); }
+    void visit(BinaryExprNode& a) {
+        const NodeId lhs = flatten(a.LHS);
+        add({.kind = Flat::BINARY, .op = a.op, .type = type_of(a)}, {lhs, flatten(a.RHS)});
+    }
+    void visit(MemberAccessExprNode& a) {
+        add({.kind = Flat::MEMBER, .op = a.op, .type = type_of(a), .payload = a.id}, {flatten(a.arg)});
+    }
+    void visit(UnaryExprNode& a) {
+        add({.kind = a.postfix() ? Flat::POSTFIX : Flat::UNARY, .op = a.op, .type = type_of(a)}, {flatten(a.arg)});
+    }
+    void visit(AllocNode& a) {
+        add({.kind = Flat::ALLOC, .type = types.spelling(a.ptr_type), .payload = static_cast<uint32_t>(a.size)});
+    }
+    void visit(FunctionCallNode& a) {
+        add_present({.kind = Flat::CALL, .type = type_of(a), .payload = a.id}, {flatten(a.args)});
+    }
+    void visit(ReadCallNode& a) { add({.kind = Flat::READ, .type = type_of(a), .payload = SYM_READ}); }
+};
+
+void flatten_ast(ASTNode& root, const TypeTable& types, FlatAST& out) {
+    Flattener flattener{types, out};
+    flattener.build.finish(flattener.flatten(&root));
+}
+
+//// Printing
+
+template <class Names>
+struct FlatPrinter {
+    const FlatView& ast;
+    const Names& symbols;
+    OutputBuffer& out;
+
+    void indent(size_t indent, std::string_view message) const {
+        out.spaces(indent ? indent - 1 : 0);
+        out << message;
+    }
+
+    void print_children(NodeId n, size_t depth) const {
+        for (const NodeId c : ast.children(n)) print(c, depth + 1);
+    }
+
+    // table is the procedure's SYMBOL_TABLE child, or NO_NODE if it has none
+    void print_symbol_table(size_t at, NodeId table) const {
+        indent(at + (INDENT >> 1), "> Symbol Table\n");
+        if (table == NO_NODE) return;
+        for (const NodeId entry : ast.children(table)) {
+            indent(at + INDENT, ast.kind[entry] == Flat::PARAM ? "> param " : "> local ");
+            out << symbols.name(ast.payload[entry]) << " : " << symbols.name(ast.type[entry]) << '\n';
+        }
+    }
+
+    void print(NodeId n, size_t depth) const {
+        const size_t at = INDENT * depth;
+        const std::span<const NodeId> kids = ast.children(n);
+        switch (ast.kind[n]) {
+            case Flat::ARGS:
+                indent(at, "↪ Args\n");
+                print_children(n, depth);
+                break;
+            case Flat::DECLS:
+                if (kids.empty()) break;
+                indent(at, "↪ Declarations\n");
+                print_children(n, depth);
+                break;
+            case Flat::FOR_PROLOGUE:
+                indent(at, "↪ For Prologue\n");
+                print_children(n, depth);
+                break;
+            case Flat::PROGRAM:
+                indent(at, "↪ Program\n");
+                indent(at + (INDENT >> 1), "> Struct Definitions\n");
+                for (const NodeId c : kids) if (ast.kind[c] == Flat::STRUCT_DEF) print(c, depth + 1);
+                indent(at + (INDENT >> 1), "> Global Vars\n");
+                for (const NodeId c : kids) if (ast.kind[c] == Flat::VAR_INIT) print(c, depth + 1);
+                indent(at + (INDENT >> 1), "> Procedures\n");
+                for (const NodeId c : kids) if (ast.kind[c] == Flat::PROCEDURE) print(c, depth + 1);
+                for (const NodeId c : kids) if (ast.kind[c] == Flat::MAIN) print(c, depth + 1);
+                break;
+            case Flat::STRUCT_DEF:
+                indent(at, "↪ Struct Definition\n");
+                print_children(n, depth);
+                break;
+            case Flat::PROCEDURE:
+                indent(at, "↪ Procedure: ");
+                out << symbols.name(ast.payload[n]) << " -> " << symbols.name(ast.type[n]) << '\n';
+                if (!ast.children(kids[0]).empty()) {
+                    indent(at + (INDENT >> 1), "> Parameters\n");
+                    print(kids[0], depth + 1);
+                }
+                print_symbol_table(at, kids.size() > 2 ? kids[2] : NO_NODE);
+                indent(at + (INDENT >> 1), "> Statements\n");
+                print(kids[1], depth + 1);
+                break;
+            case Flat::MAIN:
+                indent(at, "↪ Main: main\n");
+                print_symbol_table(at, kids.size() > 1 ? kids[1] : NO_NODE);
+                indent(at + (INDENT >> 1), "> Statements\n");
+                print(kids[0], depth + 1);
+                break;
+            case Flat::BLOCK:
+                indent(at, "↪ Block\n");
+                print_children(n, depth);
+                break;
+            case Flat::DECLARATION:
+                indent(at, "↪ Declaration: ");
+                out << symbols.name(ast.payload[n]) << " : " << symbols.name(ast.type[n]) << '\n';
+                break;
+            case Flat::VAR_INIT:
+                indent(at, "↪ Variable Initialization\n");
+                print_children(n, depth);
+                break;
+            case Flat::IF:
+                indent(at, "↪ If Tree\n");
+                for (size_t i = 0; i < kids.size(); i += 2) {
+                    if (i == 0) indent(at + (INDENT >> 1), "> IF\n");
+                    else indent(at + (INDENT >> 1), kids[i] != NO_NODE ? "> ELIF\n" : "> ELSE\n");
+                    if (kids[i] != NO_NODE) print(kids[i], depth + 1);
+                    print(kids[i + 1], depth + 1);
+                }
+                break;
+            case Flat::DELETE:
+                indent(at, "↪ Delete\n");
+                print_children(n, depth);
+                break;
+            case Flat::PRINT:
+                indent(at, "↪ Print\n");
+                print_children(n, depth);
+                break;
+            case Flat::RETURN:
+                indent(at, "↪ Return\n");
+                print_children(n, depth);
+                break;
+            case Flat::WHILE:
+                indent(at, "↪ While\n");
+                print_children(n, depth);
+                break;
+            case Flat::ASSIGNMENT:
+                indent(at, "↪ Assignment\n");
+                indent(at + (INDENT >> 1), "> LValue\n");
+                print(kids[0], depth + 1);
+                indent(at + (INDENT >> 1), "> New Value\n");
+                print(kids[1], depth + 1);
+                break;
+            case Flat::FOR:
+                indent(at, "↪ For\n");
+                print(kids[0], depth + 1);
+                indent(at + (INDENT >> 1), "> Condition\n");
+                print(kids[1], depth + 1);
+                indent(at + (INDENT >> 1), "> For Epilogue\n");
+                print(kids[2], depth + 1);
+                indent(at + (INDENT >> 1), "> Statements\n");
+                print(kids[3], depth + 1);
+                break;
+            case Flat::BREAK:
+                indent(at, "↪ Break\n");
+                break;
+            case Flat::NUM:
+                indent(at, "↪ Integer : ");
+                out.number(static_cast<int>(ast.payload[n]));
+                out << '\n';
+                break;
+            case Flat::CHARLIT: {
+                const char c = static_cast<char>(ast.payload[n]);
+                indent(at, "↪ Character : ");
+                out << spell_char(c) << '\n';
+                break;
+            }
+            case Flat::TRUE:
+                indent(at, "↪ Boolean : TRUE\n");
+                break;
+            case Flat::FALSE:
+                indent(at, "↪ Boolean : FALSE\n");
+                break;
+            case Flat::ID:
+                indent(at, "↪ ID : ");
+                out << symbols.name(ast.payload[n]);
+                if (ast.type[n] != NO_TYPE) out << " : " << symbols.name(ast.type[n]);
+                out << '\n';
+                break;
+            case Flat::NIL:
+                indent(at, "↪ Pointer : NULL\n");
+                break;
+            case Flat::BINARY:
+                indent(at, "↪ Binary Expression: ");
+                out << PARSER_SYMBOL_NAMES[ast.op[n]] << '\n';
+                print_children(n, depth);
+                break;
+            case Flat::MEMBER:
+                indent(at, "↪ Member Access: ");
+                out << PARSER_SYMBOL_NAMES[ast.op[n]] << '\n';
+                print_children(n, depth);
+                indent(at + (INDENT >> 1), "> Field : ");
+                out << symbols.name(ast.payload[n]) << '\n';
+                break;
+            case Flat::UNARY:
+            case Flat::POSTFIX:
+                indent(at, "↪ Unary Expression: ");
+                out << PARSER_SYMBOL_NAMES[ast.op[n]] << '\n';
+                print_children(n, depth);
+                break;
+            case Flat::ALLOC:
+                indent(at, "↪ Allocation: ");
+                out << symbols.name(ast.type[n]) << " [ ";
+                out.number(static_cast<int>(ast.payload[n]));
+                out << " ]\n";
+                break;
+            case Flat::CALL:
+                indent(at, "↪ Function Call: ");
+                out << symbols.name(ast.payload[n]) << '\n';
+                if (kids.empty()) break;
+                indent(at + (INDENT >> 1), "> Arguments\n");
+                print(kids[0], depth + 1);
+                break;
+            case Flat::READ:
+                indent(at, "↪ Function Call: read\n");
+                break;
+            default:
+                break;
+        }
+    }
+};
+
+template <class Names>
+void print_flat_ast(const FlatView& ast, const Names& names, OutputBuffer& out) {
+    if (ast.root != NO_NODE) FlatPrinter<Names>{ast, names, out}.print(ast.root, 0);
+}
+
+template void print_flat_ast(const FlatView&, const Interner&, OutputBuffer&);
+template void print_flat_ast(const FlatView&, const ASTFile&, OutputBuffer&);
@@ -0,0 +1,138 @@
+#ifndef XERLANG_FLAT_AST_H
+#define XERLANG_FLAT_AST_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+#include "../util/interner.h"
+#include "../util/output.h"
+#include "../util/types.h"
+
+// Flat, index-based alternative to the pointer AST of ast.h: one entry per node in a set of parallel arrays, with
+// 32-bit node ids instead of pointers, no vtables and no parent links. Nodes are numbered in the order the parser
+// reduces them (children before parents), and a node's children are a contiguous run of the shared child array.
+
+namespace Flat {
+    enum NodeKind : uint8_t {
+        PROGRAM, STRUCT_DEF, PROCEDURE, MAIN, BLOCK, ARGS, DECLS,
+        DECLARATION, SYMBOL_TABLE, PARAM, LOCAL, VAR_INIT, IF, DELETE, PRINT, RETURN, WHILE, ASSIGNMENT, FOR, FOR_PROLOGUE, BREAK,
+        NUM, CHARLIT, TRUE, FALSE, ID, NIL, BINARY, MEMBER, UNARY, POSTFIX, ALLOC, CALL, READ,
+        NUM_KINDS,
+    };
+}
+
+using NodeId = uint32_t;
+
+#define NO_NODE NodeId{0xFFFFFFFF}
+#define NO_TYPE Symbol{0xFFFFFFFF}
+
+// Children by kind (absent optional children are left out unless noted):
+//   PROGRAM      struct defs, global VAR_INITs, procedures and MAIN, in source order
+//   STRUCT_DEF   DECLS                        PROCEDURE  DECLS (params), BLOCK [, SYMBOL_TABLE]
+//   MAIN         BLOCK [, SYMBOL_TABLE]       SYMBOL_TABLE  PARAMs then LOCALs, in declaration order
+//   BLOCK        statements                   ARGS       exprs                    DECLS DECLARATIONs
+//   VAR_INIT     DECLARATION [, expr]         FOR_PROLOGUE  VAR_INIT or ASSIGNMENT
+//   IF           (cond, BLOCK) per clause; an ELSE clause's cond is NO_NODE
+//   FOR          FOR_PROLOGUE, cond, epilogue, BLOCK
+//   CALL         [ARGS]                       RETURN     [expr]
+// payload holds the name Symbol (STRUCT_DEF, PROCEDURE, DECLARATION, PARAM, LOCAL, ID, MEMBER, CALL), the value
+// (NUM, CHARLIT) or the element count (ALLOC); type holds the declared or return type of a declaration or procedure,
+// and the type of every expression. Only a flattened tree has SYMBOL_TABLEs and the types of non-literal expressions,
+// filled once resolve_names and check_types have run; the parser leaves them out.
+struct FlatAST {
+    // Hot: all a pass over kinds and operators has to stream through
+    std::vector<Flat::NodeKind> kind;
+    std::vector<uint8_t> op; // Parser::ParserSymbol of BINARY, MEMBER, UNARY and POSTFIX, DOLLAR elsewhere
+    std::vector<Symbol> type;
+
+    // Shape: node n's children are child_list[first_child[n] .. first_child[n + 1])
+    std::vector<uint32_t> first_child;
+    std::vector<NodeId> child_list;
+
+    // Cold
+    std::vector<uint32_t> offset; // source span of the node's handle
+    std::vector<uint32_t> length;
+    std::vector<uint32_t> payload;
+
+    NodeId root = NO_NODE;
+
+    [[nodiscard]] size_t size() const { return kind.size(); }
+    [[nodiscard]] std::span<const NodeId> children(NodeId n) const {
+        return {child_list.data() + first_child[n], first_child[n + 1] - first_child[n]};
+    }
+    [[nodiscard]] size_t bytes() const;
+    [[nodiscard]] struct FlatView view() const;
+    void clear();
+};
+
+// Read-only view of the same arrays wherever they live: in a FlatAST, or in a mapped AST file (ast_file.h)
+struct FlatView {
+    std::span<const Flat::NodeKind> kind;
+    std::span<const uint8_t> op;
+    std::span<const Symbol> type;
+    std::span<const uint32_t> first_child;
+    std::span<const NodeId> child_list;
+    std::span<const uint32_t> offset;
+    std::span<const uint32_t> length;
+    std::span<const uint32_t> payload;
+    NodeId root = NO_NODE;
+
+    [[nodiscard]] size_t size() const { return kind.size(); }
+    [[nodiscard]] std::span<const NodeId> children(NodeId n) const {
+        return child_list.subspan(first_child[n], first_child[n + 1] - first_child[n]);
+    }
+};
+
+struct FlatNode {
+    Flat::NodeKind kind;
+    Parser::ParserSymbol op = Parser::ParserSymbol::DOLLAR;
+    Symbol type = NO_TYPE;
+    uint32_t payload = 0;
+};
+
+// Handle of a list that is still being reduced (statements, args, dcls, ifs, procedures); NO_LIST is empty
+#define NO_LIST uint32_t{0xFFFFFFFF}
+
+// Appends nodes to a FlatAST bottom-up, as the parser reduces. A list's node can only be added once the list is
+// complete (its children have to be contiguous), so until then its elements are chained on scratch links.
+class FlatBuilder {
+    struct Link {
+        NodeId node;
+        uint32_t next;
+    };
+
+    FlatAST& ast;
+    std::vector<Link> links;
+
+public:
+    explicit FlatBuilder(FlatAST& ast);
+
+    NodeId add(const FlatNode& node, const Token& span, std::span<const NodeId> children);
+    NodeId add(const FlatNode& node, const Token& span, std::initializer_list<NodeId> children = {}) {
+        return add(node, span, std::span<const NodeId>{children.begin(), children.size()});
+    }
+
+    // Puts node in front of list and returns the new list
+    uint32_t prepend(uint32_t list, NodeId node);
+    // Adds the node owning list's elements as its children, reversed if the list was built back to front
+    NodeId close(const FlatNode& node, const Token& span, uint32_t list, bool reversed = false);
+
+    // Seals the child index and records the root
+    void finish(NodeId root);
+};
+
+// Builds the flat form of the pointer tree rooted at root, whose types are in types (spans are left empty: tree
+// nodes do not record them)
+void flatten_ast(ASTNode& root, const TypeTable& types, FlatAST& out);
+
+// Dumps the tree in the same text format as the Printer visitor. Names is anything with the Interner's
+// name(Symbol); it is instantiated for Interner and for ASTFile.
+template <class Names>
+void print_flat_ast(const FlatView& ast, const Names& names, OutputBuffer& out);
+
+inline void print_flat_ast(const FlatAST& ast, const Interner& symbols, OutputBuffer& out) {
+    print_flat_ast(ast.view(), symbols, out);
+}
+
+#endif // XERLANG_FLAT_AST_H
@@ -0,0 +1,54 @@
+#ifndef XERLANG_PARSE_TABLE_H
+#define XERLANG_PARSE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include "parser_constants.h"
+
+// Compressed form of the LALR(1) table, packed by XerlangParserGen (generator/pack.cpp) into PARSE_TABLE; the
+// generator checks it against the dense table, which only the table benchmark sees (parser_dense.h).
+//
+// ACTION: every state gets a default action, namely its most frequent reduction (or error if it never reduces),
+// which also covers its error entries. Only the entries that differ from the default are stored, with the rows
+// overlaid on each other by row displacement: the entry for (state, terminal) lives at action[action_base[state] +
+// action_column[terminal]] if action_check there names state, otherwise the default applies. Reducing by default
+// on what would have been an error only delays the error until before the next shift, so the lookahead reported is
+// unchanged. The columns, like the state numbers, go to the terminals in order of how often parsing
+// xer/sample_program.xer looks them up.
+//
+// GOTO: stored column-wise the same way, keyed by nonterminal, with each nonterminal's most common target as its
+// default. GOTO is only consulted for (state, nonterminal) pairs the LR automaton can actually reach, so the
+// default never needs a check.
+
+//// Lookup
+
+constexpr ParsingTableEntry unpack_action(uint16_t packed) {
+    ParsingTableEntry pte;
+    if (packed == ACTION_ERROR) return pte;
+    if (packed == ACTION_ACCEPT) {
+        pte.act = ParsingTableEntry::Action::ACCEPT;
+    }
+    else if (packed & REDUCE_BIT) {
+        pte.act = ParsingTableEntry::Action::REDUCE;
+        pte.production_id = packed & ~REDUCE_BIT;
+    }
+    else {
+        pte.act = ParsingTableEntry::Action::SHIFT;
+        pte.target_state = packed - 1;
+    }
+    return pte;
+}
+
+// ACTION[state][terminal]; NIL means a syntax error
+constexpr ParsingTableEntry action(uint16_t state, ParserSymbol terminal) {
+    const size_t i = PARSE_TABLE.action_base[state] + PARSE_TABLE.action_column[terminal];
+    return unpack_action(PARSE_TABLE.action_check[i] == state ? PARSE_TABLE.action[i] : PARSE_TABLE.default_action[state]);
+}
+
+// GOTO[state][nonterminal], for a state that has just uncovered a handle reducing to nonterminal
+constexpr uint16_t goto_state(uint16_t state, ParserSymbol nonterminal) {
+    const size_t i = PARSE_TABLE.goto_base[nonterminal] + state;
+    return PARSE_TABLE.goto_check[i] == nonterminal ? PARSE_TABLE.goto_target[i] : PARSE_TABLE.goto_default[nonterminal];
+}
+
+#endif //XERLANG_PARSE_TABLE_H
@@ -1,117 +1,38 @@
 #include "parser.h"
+#include <algorithm>
+#include <array>
+#include <cassert>
 #include <iostream>
 #include <vector>
-#include <memory>
+#include <ranges>
+#include <span>
 #include "parser_constants.h"
+#include "parse_table.h"
 #include "ast.h"
+#include "flat_ast.h"
+#include "util/symbol_table.h"
+#include "visitors/type_rules.h"
 
 using namespace Parser;
 
 std::ostream& operator<<(std::ostream& os, Parser::ParserSymbol state) {
-    switch (state) {
-        case MAIN: os << "MAIN"; break;
-        case READ: os << "READ"; break;
-        case PRINT: os << "PRINT"; break;
-        case INT: os << "INT"; break;
-        case CHAR: os << "CHAR"; break;
-        case BOOL: os << "BOOL"; break;
-        case STRUCT: os << "STRUCT"; break;
-        case TRUE: os << "TRUE"; break;
-        case FALSE: os << "FALSE"; break;
-        case NIL: os << "NIL"; break;
-        case NUM: os << "NUM"; break;
-        case CHARLIT: os << "CHARLIT"; break;
-        case ID: os << "ID"; break;
-        case RETURN: os << "RETURN"; break;
-        case IF: os << "IF"; break;
-        case ELIF: os << "ELIF"; break;
-        case ELSE: os << "ELSE"; break;
-        case FOR: os << "FOR"; break;
-        case WHILE: os << "WHILE"; break;
-        case BREAK: os << "BREAK"; break;
-        case DELETE: os << "DELETE"; break;
-        case NEW: os << "NEW"; break;
-        case COLON: os << "COLON"; break;
-        case LPAREN: os << "LPAREN"; break;
-        case RPAREN: os << "RPAREN"; break;
-        case SEMI: os << "SEMI"; break;
-        case LCURLY: os << "LCURLY"; break;
-        case RCURLY: os << "RCURLY"; break;
-        case COMMA: os << "COMMA"; break;
-        case LBRACK: os << "LBRACK"; break;
-        case RBRACK: os << "RBRACK"; break;
-        case BECOMES: os << "BECOMES"; break;
-        case NOT: os << "NOT"; break;
-        case OR: os << "OR"; break;
-        case AND: os << "AND"; break;
-        case GEQ: os << "GEQ"; break;
-        case GT: os << "GT"; break;
-        case LEQ: os << "LEQ"; break;
-        case LT: os << "LT"; break;
-        case EQUALS: os << "EQUALS"; break;
-        case NEQ: os << "NEQ"; break;
-        case PLUS: os << "PLUS"; break;
-        case SUB: os << "SUB"; break;
-        case MULT: os << "MULT"; break;
-        case AT: os << "AT"; break;
-        case ADDR: os << "ADDR"; break;
-        case DIV: os << "DIV"; break;
-        case MOD: os << "MOD"; break;
-        case LSHIFT: os << "LSHIFT"; break;
-        case RSHIFT: os << "RSHIFT"; break;
-        case EXP: os << "EXP"; break;
-        case BITOR: os << "BITOR"; break;
-        case BITXOR: os << "BITXOR"; break;
-        case BITAND: os << "BITAND"; break;
-        case BITNOT: os << "BITNOT"; break;
-        case INCR: os << "INCR"; break;
-        case DECR: os << "DECR"; break;
-        case ARROW: os << "ARROW"; break;
-        case DOT: os << "DOT"; break;
-        case BoF: os << "BoF"; break;
-        case EoF: os << "EoF"; break;
-        case start: os << "start"; break;
-        case procedures: os << "procedures"; break;
-        case procedure: os << "procedure"; break;
-        case main: os << "main"; break;
-        case type: os << "type"; break;
-        case star: os << "star"; break;
-        case params: os << "params"; break;
-        case dcls: os << "dcls"; break;
-        case dcl: os << "dcl"; break;
-        case statements: os << "statements"; break;
-        case statement: os << "statement"; break;
-        case ifs: os << "ifs"; break;
-        case forprologue: os << "forprologue"; break;
-        case forepilogue: os << "forepilogue"; break;
-        case expr1: os << "expr1"; break;
-        case expr2: os << "expr2"; break;
-        case expr3: os << "expr3"; break;
-        case expr4: os << "expr4"; break;
-        case expr5: os << "expr5"; break;
-        case expr6: os << "expr6"; break;
-        case expr7: os << "expr7"; break;
-        case expr8: os << "expr8"; break;
-        case expr9: os << "expr9"; break;
-        case expr10: os << "expr10"; break;
-        case expr11: os << "expr11"; break;
-        case expr12: os << "expr12"; break;
-        case expr13: os << "expr13"; break;
-        case expr14: os << "expr14"; break;
-        case args: os << "args"; break;
-        case structdef: os << "structdef"; break;
-        default: os << "NONE"; break;
-    }
-    return os;
+    if (state < 0 || state >= Parser::ParserSymbol::NUM_SYMBOLS) return os << "NONE";
+    return os << PARSER_SYMBOL_NAMES[state];
+}
+
+void print_stream_line(const SourceBuffer& source, const SourceLocation& loc, std::ostream& err) {
+    err << source.line_text(loc.line) << '\n';
+    for (size_t i = 1; i < loc.col; i++) err << ' ';
+    err << "^\n";
 }
 
-void print_stream_line(const std::vector<Token>& stream, std::ostream& err, const size_t i) {
-    const size_t line_num = stream.at(i).line_num;
-    size_t l = i;
-    while (l >= 0 && stream.at(l).line_num == line_num) l--;
-    l++;
-    for (; stream.at(l).line_num == line_num; l++) {
-        err << stream.at(l).lexeme << ' ';
+void print_recent_tokens(const TokenSource& tokens, const SourceBuffer& source, std::ostream& err) {
+    std::array<Token, RECENT_TOKENS> recent;
+    const size_t n = tokens.recent(recent);
+    err << "Recent tokens:";
+    for (size_t i = 0; i < n; i++) {
+        err << ' ' << recent[i].type;
+        if (recent[i].length) err << '(' << source.lexeme(recent[i]) << ')';
     }
     err << '\n';
 }
@@ -119,467 +40,1174 @@ void print_stream_line(const std::vector<Token>& stream, std::ostream& err, cons
 // Constructing Concrete Syntax Tree (CST)
 
 struct SemanticValue {
-    Token token;
-    std::unique_ptr<ASTNode> node = nullptr;
+    Token token; // the terminal shifted, or for a nonterminal the source span of its handle
+    union {
+        ASTNode* node = nullptr; // owned by the parse's Arena
+        NodeId index;            // in a flat parse: the node, or the list still being reduced
+    };
 };
 
-struct LALRData {
-    uint16_t state = 0;
-    SemanticValue data;
+// sv's node as a T. The grammar fixes which node kind each RHS symbol carries, so a mismatch is a parser bug,
+// caught by ast_cast's tag check in debug builds.
+template <class T>
+T* node_cast(const SemanticValue& sv) {
+    return ast_cast<T>(sv.node);
+}
+
+ParserContext::ParserContext() {
+    states.reserve(INITIAL_PARSE_STACK);
+    values.reserve(INITIAL_PARSE_STACK);
+}
+
+ParserContext::~ParserContext() = default;
+
+template <class Actions>
+void ParserContext::reduce(uint16_t production_id, Actions& actions) {
+    const size_t len = PRODUCTIONS[production_id].len;
+    // The handle's values stay on the stack while the action reads them; popped afterwards
+    const std::span<SemanticValue> RHS = std::span{values}.last(len);
+
+    // An empty handle sits just after the value below it
+    SemanticValue result{.token = {PRODUCTIONS[production_id].LHS}, .node = nullptr};
+    if (len) {
+        result.token.offset = RHS.front().token.offset;
+        result.token.length = RHS.back().token.offset + RHS.back().token.length - result.token.offset;
+    }
+    else {
+        result.token.offset = values.back().token.offset + values.back().token.length;
+    }
+    actions.reduce(production_id, RHS, result);
+
+    states.resize(states.size() - len);
+    values.erase(values.end() - len, values.end());
+    assert(!states.empty());
+    // theoretically, this ^^^ cannot occur, assuming correctness of parser implementation
+    values.push_back(result);
+}
+
+// The type named by a type production: base is its INT, CHAR, BOOL or (struct) ID token, followed by stars '@'s
+TypeId make_type(TypeTable& types, const Token& base, size_t stars) {
+    TypeId type = (base.type == ID) ? types.struct_type(base.symbol)
+                : (base.type == INT) ? TYPE_INT
+                : (base.type == CHAR) ? TYPE_CHAR
+                : TYPE_BOOL;
+    for (; stars; stars--) type = types.pointer_to(type);
+    return type;
+}
+
+// Semantic actions building the pointer AST in an Arena
+struct TreeActions {
+    const SourceBuffer& source;
+    TypeTable& types;
+    Arena& ast;
+
+    void reduce(uint16_t production_id, std::span<SemanticValue> RHS, SemanticValue& result);
 };
 
-template <class T>
-std::unique_ptr<T> unique_ptr_cast(SemanticValue& sv) {
-    std::unique_ptr<T> ptr = std::unique_ptr<T>(dynamic_cast<T*>(sv.node.release()));
-    if (!ptr) throw std::runtime_error{"ERROR: dynamic_cast failed"};
-    return ptr;
-}
-
-std::vector<LALRData> stack;
-
-std::unique_ptr<ASTNode> parse(const std::vector<Token>& stream, std::ostream& err) {
-    if (!stack.empty()) stack.clear();
-    stack.push_back({0, {{}, nullptr}});
-    size_t token_idx = 0;
-
-    try {
-        while (token_idx < stream.size()) {
-            const Token& lookahead = stream.at(token_idx);
-            uint16_t current_state = stack.back().state;
-
-            const ParsingTableEntry& pte = PARSING_TABLE[current_state][lookahead.type];
-
-            switch (pte.act) {
-                case ParsingTableEntry::Action::SHIFT:
-                    stack.push_back({pte.target_state, {lookahead, {}}});
-                    token_idx++;
-                    break;
-                case ParsingTableEntry::Action::REDUCE: {
-                    const Production& prod = PRODUCTIONS[pte.production_id];
-
-                    std::vector<SemanticValue> RHS(prod.len);
-                    int i;
-                    for (i = 0; i < prod.len; i++) {
-                        RHS.at(i) = std::move(stack.at(stack.size() - prod.len + i).data);
-                    }
-                    for (i = 0; i < prod.len; i++) {
-                        stack.pop_back();
-                    }
-
-                    std::unique_ptr<ASTNode> new_node;
-                    switch (pte.production_id) {
-                        case start_BoFproceduresEoF: {
-                            new_node = std::move(RHS.at(1).node);
-                            break;
-                        }
-                        case procedures_dclSEMIprocedures: {
-                            auto program = unique_ptr_cast<ProgramNode>(RHS.back());
-                            auto var_init = std::make_unique<VarInitNode>(unique_ptr_cast<DeclarationNode>(RHS.front()));
-                            program->global_vars.insert(program->global_vars.begin(), std::move(var_init));
-                            program->global_vars.front()->parent = program.get();
-                            program->global_vars.front()->dcl->parent = program->global_vars.front().get();
-                            new_node = std::move(program);
-                            break;
-                        }
-                        case procedures_dclBECOMESexpr1SEMIprocedures: {
-                            auto program = unique_ptr_cast<ProgramNode>(RHS.back());
-                            auto init = std::make_unique<VarInitNode>(unique_ptr_cast<DeclarationNode>(RHS.front()), unique_ptr_cast<ExprNode>(RHS.at(2)));
-                            init->dcl->parent = init.get();
-                            init->val->parent = init.get();
-                            init->parent = program.get();
-                            program->global_vars.insert(program->global_vars.begin(), std::move(init));
-                            new_node = std::move(program);
-                            break;
-                        }
-                        case procedures_structdefprocedures: {
-                            auto sd = unique_ptr_cast<StructDefNode>(RHS.front());
-                            auto program = unique_ptr_cast<ProgramNode>(RHS.back());
-                            program->struct_defs.insert(program->struct_defs.begin(), std::move(sd));
-                            program->struct_defs.front()->parent = program.get();
-                            new_node = std::move(program);
-                            break;
-                        }
-                        case structdef_STRUCTIDLCURLYdclsRCURLYSEMI: {
-                            auto dcls = unique_ptr_cast<DeclarationsNode>(RHS.at(3));
-                            auto sd = std::make_unique<StructDefNode>(RHS.at(1).token.lexeme, std::move(dcls));
-                            sd->fields->parent = sd.get();
-                            new_node = std::move(sd);
-                            break;
-                        }
-                        case procedures_procedureprocedures: {
-                            auto program = unique_ptr_cast<ProgramNode>(RHS.back());
-                            program->procedures.insert(program->procedures.begin(), unique_ptr_cast<ProcedureNode>(RHS.at(0)));
-                            program->procedures.front()->parent = program.get();
-                            new_node = std::move(program);
-                            break;
-                        }
-                        case procedure_IDCOLONLPARENparamsRPARENARROWtypeLCURLYstatementsRCURLY:
-                        case procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY: {
-                            const std::string id = RHS.at(0).token.lexeme;
-                            auto params = unique_ptr_cast<DeclarationsNode>(RHS.at(3));
-                            auto block = unique_ptr_cast<BlockNode>(RHS.at(8));
-                            std::unique_ptr<ProcedureNode> proc;
-                            if (pte.production_id == procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY) {
-                                proc = std::make_unique<ProcedureNode>(id, "void", std::move(params), std::move(block));
-                            }
-                            else {
-                                auto type = unique_ptr_cast<TypeNode>(RHS.at(6));
-                                proc = std::make_unique<ProcedureNode>(id, type->lexeme, std::move(params), std::move(block));
-                            }
-                            proc->params->parent = proc.get();
-                            proc->block->parent = proc.get();
-                            new_node = std::move(proc);
-                            break;
-                        }
-                        case procedures_main: {
-                            auto program = std::make_unique<ProgramNode>();
-                            program->main = unique_ptr_cast<MainNode>(RHS.front());
-                            program->main->parent = program.get();
-                            new_node = std::move(program);
-                            break;
-                        }
-                        case main_MAINCOLONLPARENRPARENARROWINTLCURLYstatementsRCURLY: {
-                            auto main = std::make_unique<MainNode>(unique_ptr_cast<BlockNode>(RHS.at(7)));
-                            main->block->parent = main.get();
-                            new_node = std::move(main);
-                            break;
-                        }
-                        case statements_statementsstatement: {
-                            auto block = unique_ptr_cast<BlockNode>(RHS.front());
-                            block->statements.push_back(unique_ptr_cast<StatementNode>(RHS.back()));
-                            block->statements.back()->parent = block.get();
-                            new_node = std::move(block);
-                            break;
-                        }
-                        case args_expr1COMMAargs: {
-                            auto arg_list = unique_ptr_cast<ArgsNode>(RHS.back());
-                            arg_list->args.insert(arg_list->args.begin(), unique_ptr_cast<ExprNode>(RHS.front()));
-                            arg_list->args.front()->parent = arg_list.get();
-                            new_node = std::move(arg_list);
-                            break;
-                        }
-                        case args_expr1: {
-                            auto arg_list = std::make_unique<ArgsNode>();
-                            arg_list->args.push_back(unique_ptr_cast<ExprNode>(RHS.front()));
-                            arg_list->args.back()->parent = arg_list.get();
-                            new_node = std::move(arg_list);
-                            break;
-                        }
-                        case paramlist_dclCOMMAparamlist:
-                        case dcls_dclSEMIdcls: {
-                            auto dcl_list = unique_ptr_cast<DeclarationsNode>(RHS.back());
-                            dcl_list->declarations.insert(dcl_list->declarations.begin(), unique_ptr_cast<DeclarationNode>(RHS.front()));
-                            dcl_list->declarations.front()->parent = dcl_list.get();
-                            new_node = std::move(dcl_list);
-                            break;
-                        }
-                        case dcl_typeID: {
-                            new_node = std::make_unique<DeclarationNode>(unique_ptr_cast<TypeNode>(RHS.front())->lexeme, RHS.back().token.lexeme);
-                            break;
-                        }
-                        case type_INTstar:
-                        case type_CHARstar:
-                        case type_BOOLstar:
-                        case type_STRUCTIDstar: {
-                            auto stars = unique_ptr_cast<StarNode>(RHS.back());
-                            const std::string type = RHS.at(RHS.size() - 2).token.lexeme + std::string(stars->count, '*');
-                            new_node = std::make_unique<TypeNode>(type);
-                            break;
-                        }
-                        case star_ATstar: {
-                            auto stars = unique_ptr_cast<StarNode>(RHS.back());
-                            stars->count++;
-                            new_node = std::move(stars);
-                            break;
-                        }
-                        case star_: {
-                            new_node = std::make_unique<StarNode>();
-                            break;
-                        }
-                        case paramlist_dcl:
-                        case dcls_dclSEMI: {
-                            auto dcl_list = std::make_unique<DeclarationsNode>();
-                            dcl_list->declarations.push_back(unique_ptr_cast<DeclarationNode>(RHS.front()));
-                            dcl_list->declarations.back()->parent = dcl_list.get();
-                            new_node = std::move(dcl_list);
-                            break;
-                        }
-                        case statement_dclBECOMESexpr1SEMI: {
-                            auto var_init = std::make_unique<VarInitNode>(unique_ptr_cast<DeclarationNode>(RHS.front()), unique_ptr_cast<ExprNode>(RHS.at(2)));
-                            var_init->dcl->parent = var_init.get();
-                            var_init->val->parent = var_init.get();
-                            new_node = std::move(var_init);
-                            break;
-                        }
-                        case statement_dclSEMI: {
-                            new_node = std::move(unique_ptr_cast<DeclarationNode>(RHS.front()));
-                            break;
-                        }
-                        case statement_expr1BECOMESexpr1SEMI: {
-                            auto asst = std::make_unique<AssignmentNode>(unique_ptr_cast<ExprNode>(RHS.front()), unique_ptr_cast<ExprNode>(RHS.at(2)));
-                            asst->LHS->parent = asst.get();
-                            asst->RHS->parent = asst.get();
-                            new_node = std::move(asst);
-                            break;
-                        }
-                        case statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs:
-                        case ifs_ELIFLPARENexpr1RPARENLCURLYstatementsRCURLYifs: {
-                            auto ifn = unique_ptr_cast<IfNode>(RHS.back());
-                            ifn->clauses.insert(ifn->clauses.begin(), {unique_ptr_cast<ExprNode>(RHS.at(2)), unique_ptr_cast<BlockNode>(RHS.at(5))});
-                            ifn->clauses.front().cond->parent = ifn.get();
-                            ifn->clauses.front().block->parent = ifn.get();
-                            new_node = std::move(ifn);
-                            break;
-                        }
-                        case ifs_: {
-                            new_node = std::make_unique<IfNode>();
-                            break;
-                        }
-                        case ifs_ELSELCURLYstatementsRCURLY: {
-                            auto ifn = std::make_unique<IfNode>();
-                            ifn->clauses.push_back({nullptr, unique_ptr_cast<BlockNode>(RHS.at(2))});
-                            ifn->clauses.back().block->parent = ifn.get();
-                            new_node = std::move(ifn);
-                            break;
-                        }
-                        case statement_FORLPARENforprologueSEMIexpr1SEMIforepilogueRPARENLCURLYstatementsRCURLY: {
-                            auto pro = unique_ptr_cast<ForPrologueNode>(RHS.at(2));
-                            auto cond = unique_ptr_cast<ExprNode>(RHS.at(4));
-                            auto epi = unique_ptr_cast<StatementNode>(RHS.at(6));
-                            auto block = unique_ptr_cast<BlockNode>(RHS.at(9));
-                            auto fn = std::make_unique<ForNode>(std::move(pro), std::move(cond), std::move(epi), std::move(block));
-                            fn->prologue->parent = fn.get();
-                            fn->cond->parent = fn.get();
-                            fn->epilogue->parent = fn.get();
-                            fn->block->parent = fn.get();
-                            new_node = std::move(fn);
-                            break;
-                        }
-                        case forprologue_dclBECOMESexpr1: {
-                            auto dcl = unique_ptr_cast<DeclarationNode>(RHS.front());
-                            auto expr = unique_ptr_cast<ExprNode>(RHS.back());
-                            auto pro = std::make_unique<ForPrologueNode>(std::make_unique<VarInitNode>(std::move(dcl), std::move(expr)));
-                            pro->init->parent = pro.get();
-                            pro->init->dcl->parent = pro->init.get();
-                            pro->init->val->parent = pro->init.get();
-                            new_node = std::move(pro);
-                            break;
-                        }
-                        case forprologue_expr1BECOMESexpr1: {
-                            auto L = unique_ptr_cast<ExprNode>(RHS.front());
-                            auto R = unique_ptr_cast<ExprNode>(RHS.back());
-                            auto pro = std::make_unique<ForPrologueNode>(std::make_unique<AssignmentNode>(std::move(L), std::move(R)));
-                            pro->asst->parent = pro.get();
-                            pro->asst->LHS->parent = pro->asst.get();
-                            pro->asst->RHS->parent = pro->asst.get();
-                            new_node = std::move(pro);
-                            break;
-                        }
-                        case forepilogue_expr1BECOMESexpr1: {
-                            auto L = unique_ptr_cast<ExprNode>(RHS.front());
-                            auto R = unique_ptr_cast<ExprNode>(RHS.back());
-                            auto asst = std::make_unique<AssignmentNode>(std::move(L), std::move(R));
-                            asst->LHS->parent = asst.get();
-                            asst->RHS->parent = asst.get();
-                            new_node = std::move(asst);
-                            break;
-                        }
-                        case statement_BREAKSEMI: {
-                            new_node = std::make_unique<BreakNode>();
-                            break;
-                        }
-                        case statement_expr1SEMI: {
-                            new_node = unique_ptr_cast<ExprNode>(RHS.front());
-                            break;
-                        }
-                        case statement_DELETEexpr1SEMI: {
-                            auto del = std::make_unique<DeleteNode>(unique_ptr_cast<ExprNode>(RHS.at(1)));
-                            del->ptr->parent = del.get();
-                            new_node = std::move(del);
-                            break;
-                        }
-                        case statement_PRINTLPARENargsRPARENSEMI: {
-                            auto print = std::make_unique<PrintNode>(unique_ptr_cast<ArgsNode>(RHS.at(2)));
-                            print->args->parent = print.get();
-                            new_node = std::move(print);
-                            break;
-                        }
-                        case statement_RETURNexpr1SEMI: {
-                            auto ret = std::make_unique<ReturnNode>(unique_ptr_cast<ExprNode>(RHS.at(1)));
-                            ret->expr->parent = ret.get();
-                            new_node = std::move(ret);
-                            break;
-                        }
-                        case statement_RETURNSEMI: {
-                            new_node = std::make_unique<ReturnNode>(nullptr);
-                            break;
-                        }
-                        case statement_WHILELPARENexpr1RPARENLCURLYstatementsRCURLY: {
-                            auto w = std::make_unique<WhileNode>(unique_ptr_cast<ExprNode>(RHS.at(2)), unique_ptr_cast<BlockNode>(RHS.at(5)));
-                            w->condition->parent = w.get();
-                            w->statements->parent = w.get();
-                            new_node = std::move(w);
-                            break;
-                        }
-                        case statements_: {
-                            new_node = std::make_unique<BlockNode>();
-                            break;
-                        }
-                        case params_: {
-                            new_node = std::make_unique<DeclarationsNode>();
-                            break;
-                        }
-                        case params_paramlist: {
-                            new_node = std::move(RHS.front().node);
-                            break;
-                        }
-                        case expr1_expr2:
-                        case expr2_expr3:
-                        case expr3_expr4:
-                        case expr4_expr5:
-                        case expr5_expr6:
-                        case expr6_expr7:
-                        case expr7_expr8:
-                        case expr8_expr9:
-                        case expr9_expr10:
-                        case expr10_expr11:
-                        case expr11_expr12:
-                        case expr12_expr13:
-                        case expr13_expr14:
-                        case forepilogue_expr1: {
-                            // exprX -> expr(X+1), a -> b
-                            new_node = std::move(RHS.at(0).node);
-                            break;
-                        }
-                        case expr14_LPARENexpr1RPAREN: { // expr14 -> ( expr1 )
-                            new_node = std::move(RHS.at(1).node);
-                            break;
-                        }
-                        case expr14_ID: { // expr14 -> ID
-                            new_node = std::make_unique<IDNode>(RHS.front().token.lexeme);
-                            break;
-                        }
-                        case expr14_TRUE: { // expr14 -> TRUE
-                            new_node = std::make_unique<TrueNode>();
-                            break;
-                        }
-                        case expr14_FALSE: { // expr14 -> FALSE
-                            new_node = std::make_unique<FalseNode>();
-                            break;
-                        }
-                        case expr14_NIL: { // expr14 -> NIL
-                            new_node = std::make_unique<NilNode>();
-                            break;
-                        }
-                        case expr14_NUM: { // expr14 -> NUM
-                            new_node = std::make_unique<NumNode>(RHS.front().token.lexeme);
-                            break;
-                        }
-                        case expr14_CHARLIT: { // expr14 -> CHARLIT
-                            new_node = std::make_unique<CharNode>(RHS.front().token.lexeme);
-                            break;
-                        }
-                        case expr1_expr1ORexpr2:
-                        case expr2_expr2ANDexpr3:
-                        case expr3_expr3BITORexpr4:
-                        case expr4_expr4BITXORexpr5:
-                        case expr5_expr5BITANDexpr6:
-                        case expr6_expr6EQUALSexpr7:
-                        case expr6_expr6NEQexpr7:
-                        case expr7_expr7LTexpr8:
-                        case expr7_expr7LEQexpr8:
-                        case expr7_expr7GTexpr8:
-                        case expr7_expr7GEQexpr8:
-                        case expr8_expr8LSHIFTexpr9:
-                        case expr8_expr8RSHIFTexpr9:
-                        case expr9_expr9PLUSexpr10:
-                        case expr9_expr9SUBexpr10:
-                        case expr10_expr10MULTexpr11:
-                        case expr10_expr10DIVexpr11:
-                        case expr10_expr10MODexpr11:
-                        case expr12_expr13EXPexpr12: {
-                            // arg1 op arg2
-                            auto expr = std::make_unique<BinaryExprNode>(prod.RHS.at(1), unique_ptr_cast<ExprNode>(RHS.front()), unique_ptr_cast<ExprNode>(RHS.back()));
-                            expr->LHS->parent = expr.get();
-                            expr->RHS->parent = expr.get();
-                            new_node = std::move(expr);
-                            break;
-                        }
-                        case expr13_expr13ARROWID:
-                        case expr13_expr13DOTID: { // arg->ID, arg.ID
-                            auto ref = std::make_unique<MemberAccessExprNode>(prod.RHS.at(1), unique_ptr_cast<ExprNode>(RHS.front()), RHS.back().token.lexeme);
-                            ref->arg->parent = ref.get();
-                            new_node = std::move(ref);
-                            break;
-                        }
-                        case expr11_ATexpr11:
-                        case expr11_ADDRexpr11:
-                        case expr11_NOTexpr11:
-                        case expr11_BITNOTexpr11:
-                        case expr11_INCRexpr11:
-                        case expr11_DECRexpr11:
-                        case expr11_SUBexpr11:
-                        case expr11_PLUSexpr11: { // op arg
-                            auto un = std::make_unique<UnaryExprNode>(RHS.front().token.type, unique_ptr_cast<ExprNode>(RHS.back()));
-                            un->arg->parent = un.get();
-                            new_node = std::move(un);
-                            break;
-                        }
-                        case expr13_expr13INCR:
-                        case expr13_expr13DECR: { // arg op
-                            auto un = std::make_unique<UnaryExprNode>(RHS.back().token.type, unique_ptr_cast<ExprNode>(RHS.front()));
-                            un->arg->parent = un.get();
-                            new_node = std::move(un);
-                            break;
-                        }
-                        case expr14_READLPARENRPAREN: {
-                            new_node = std::make_unique<ReadCallNode>();
-                            break;
-                        }
-                        case expr14_IDLPARENargsRPAREN: {
-                            auto call = std::make_unique<FunctionCallNode>(RHS.front().token.lexeme, unique_ptr_cast<ArgsNode>(RHS.at(2)));
-                            call->args->parent = call.get();
-                            new_node = std::move(call);
-                            break;
-                        }
-                        case expr14_IDLPARENRPAREN: {
-                            new_node = std::make_unique<FunctionCallNode>(RHS.front().token.lexeme, nullptr);
-                            break;
-                        }
-                        case expr14_NEWtypeLBRACKNUMRBRACK: {
-                            auto type = unique_ptr_cast<TypeNode>(RHS.at(1));
-                            new_node = std::make_unique<AllocNode>(type->lexeme + '*', std::stoi(RHS.at(3).token.lexeme));
-                            break;
-                        }
-                        default:
-                            throw std::runtime_error{"ERROR: Unknown production used to produce AST node"};
-                            // ^^^ this shouldn't be possible, theoretically...
-                    }
-
-                    if(stack.empty()) throw std::runtime_error{"ERROR: Attempting to read empty stack!"};
-                    // theoretically, this ^^^ cannot occur, assuming correctness of parser implementation
-                    uint16_t state_after_pop = stack.back().state;
-
-                    const ParsingTableEntry& goto_pte = PARSING_TABLE[state_after_pop][prod.LHS];
-                    if(goto_pte.act != ParsingTableEntry::Action::GOTO) throw std::runtime_error{"ERROR: NOT GOTO entry found!"};
-                    // theoretically, this ^^^ cannot occur, assuming correctness of parser implementation
-
-                    stack.push_back({goto_pte.target_state, {{}, std::move(new_node)}});
-                    break;
-                }
-                case ParsingTableEntry::Action::ACCEPT:
-                    return std::move(stack.back().data.node);
-                default:
-                    throw std::runtime_error{"ERROR: Default - NO valid parse possible."};
+void TreeActions::reduce(uint16_t production_id, std::span<SemanticValue> RHS, SemanticValue& result) {
+    const Production& prod = PRODUCTIONS[production_id];
+    ASTNode* new_node = nullptr;
+    switch (production_id) {
+        case start_BoFproceduresEoF: {
+            auto program = node_cast<ProgramNode>(RHS[1]);
+            std::ranges::reverse(program->struct_defs);
+            std::ranges::reverse(program->global_vars);
+            std::ranges::reverse(program->procedures);
+            new_node = program;
+            break;
+        }
+        // procedures is right-recursive, so the program's lists are built back to front and reversed once at start
+        case procedures_dclSEMIprocedures: {
+            auto program = node_cast<ProgramNode>(RHS.back());
+            auto var_init = ast.make<VarInitNode>(node_cast<DeclarationNode>(RHS.front()));
+            program->global_vars.push_back(var_init);
+            var_init->parent = program;
+            var_init->dcl->parent = var_init;
+            new_node = program;
+            break;
+        }
+        case procedures_dclBECOMESexpr1SEMIprocedures: {
+            auto program = node_cast<ProgramNode>(RHS.back());
+            auto init = ast.make<VarInitNode>(node_cast<DeclarationNode>(RHS.front()), node_cast<ExprNode>(RHS[2]));
+            init->dcl->parent = init;
+            init->val->parent = init;
+            init->parent = program;
+            program->global_vars.push_back(init);
+            new_node = program;
+            break;
+        }
+        case procedures_structdefprocedures: {
+            auto sd = node_cast<StructDefNode>(RHS.front());
+            auto program = node_cast<ProgramNode>(RHS.back());
+            program->struct_defs.push_back(sd);
+            sd->parent = program;
+            new_node = program;
+            break;
+        }
+        case structdef_STRUCTIDLCURLYdclsRCURLYSEMI: {
+            auto dcls = node_cast<DeclarationsNode>(RHS[3]);
+            std::ranges::reverse(dcls->declarations);
+            auto sd = ast.make<StructDefNode>(RHS[1].token.symbol, types.struct_type(RHS[1].token.symbol), dcls);
+            sd->fields->parent = sd;
+            new_node = sd;
+            break;
+        }
+        case procedures_procedureprocedures: {
+            auto program = node_cast<ProgramNode>(RHS.back());
+            program->procedures.push_back(node_cast<ProcedureNode>(RHS[0]));
+            program->procedures.back()->parent = program;
+            new_node = program;
+            break;
+        }
+        case procedure_IDCOLONLPARENparamsRPARENARROWtypeLCURLYstatementsRCURLY:
+        case procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY: {
+            const Symbol id = RHS[0].token.symbol;
+            auto params = node_cast<DeclarationsNode>(RHS[3]);
+            std::ranges::reverse(params->declarations);
+            auto block = node_cast<BlockNode>(RHS[8]);
+            ProcedureNode* proc;
+            if (production_id == procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY) {
+                proc = ast.make<ProcedureNode>(&ast, id, TYPE_VOID, params, block);
+            }
+            else {
+                auto type = node_cast<TypeNode>(RHS[6]);
+                proc = ast.make<ProcedureNode>(&ast, id, type->type, params, block);
+            }
+            proc->params->parent = proc;
+            proc->block->parent = proc;
+            new_node = proc;
+            break;
+        }
+        case procedures_main: {
+            auto program = ast.make<ProgramNode>(&ast);
+            program->main = node_cast<MainNode>(RHS.front());
+            program->main->parent = program;
+            new_node = program;
+            break;
+        }
+        case main_MAINCOLONLPARENRPARENARROWINTLCURLYstatementsRCURLY: {
+            auto main = ast.make<MainNode>(&ast, node_cast<BlockNode>(RHS[7]));
+            main->block->parent = main;
+            new_node = main;
+            break;
+        }
+        case statements_statementsstatement: {
+            auto block = node_cast<BlockNode>(RHS.front());
+            block->statements.push_back(node_cast<StatementNode>(RHS.back()));
+            block->statements.back()->parent = block;
+            new_node = block;
+            break;
+        }
+        case args_expr1COMMAargs: { // built back to front, reversed by the call or print taking the list
+            auto arg_list = node_cast<ArgsNode>(RHS.back());
+            arg_list->args.push_back(node_cast<ExprNode>(RHS.front()));
+            arg_list->args.back()->parent = arg_list;
+            new_node = arg_list;
+            break;
+        }
+        case args_expr1: {
+            auto arg_list = ast.make<ArgsNode>(&ast);
+            arg_list->args.push_back(node_cast<ExprNode>(RHS.front()));
+            arg_list->args.back()->parent = arg_list;
+            new_node = arg_list;
+            break;
+        }
+        case paramlist_dclCOMMAparamlist:
+        case dcls_dclSEMIdcls: { // built back to front, reversed by the procedure or struct taking the list
+            auto dcl_list = node_cast<DeclarationsNode>(RHS.back());
+            dcl_list->declarations.push_back(node_cast<DeclarationNode>(RHS.front()));
+            dcl_list->declarations.back()->parent = dcl_list;
+            new_node = dcl_list;
+            break;
+        }
+        case dcl_typeID: {
+            new_node = ast.make<DeclarationNode>(node_cast<TypeNode>(RHS.front())->type, RHS.back().token.symbol);
+            break;
+        }
+        case type_INTstar:
+        case type_CHARstar:
+        case type_BOOLstar:
+        case type_STRUCTIDstar: {
+            const size_t stars = node_cast<StarNode>(RHS.back())->count;
+            new_node = ast.make<TypeNode>(make_type(types, RHS[RHS.size() - 2].token, stars));
+            break;
+        }
+        case star_ATstar: {
+            auto stars = node_cast<StarNode>(RHS.back());
+            stars->count++;
+            new_node = stars;
+            break;
+        }
+        case star_: {
+            new_node = ast.make<StarNode>();
+            break;
+        }
+        case paramlist_dcl:
+        case dcls_dclSEMI: {
+            auto dcl_list = ast.make<DeclarationsNode>(&ast);
+            dcl_list->declarations.push_back(node_cast<DeclarationNode>(RHS.front()));
+            dcl_list->declarations.back()->parent = dcl_list;
+            new_node = dcl_list;
+            break;
+        }
+        case statement_dclBECOMESexpr1SEMI: {
+            auto var_init = ast.make<VarInitNode>(node_cast<DeclarationNode>(RHS.front()), node_cast<ExprNode>(RHS[2]));
+            var_init->dcl->parent = var_init;
+            var_init->val->parent = var_init;
+            new_node = var_init;
+            break;
+        }
+        case statement_dclSEMI: {
+            new_node = node_cast<DeclarationNode>(RHS.front());
+            break;
+        }
+        case statement_expr1BECOMESexpr1SEMI: {
+            auto asst = ast.make<AssignmentNode>(node_cast<ExprNode>(RHS.front()), node_cast<ExprNode>(RHS[2]));
+            asst->LHS->parent = asst;
+            asst->RHS->parent = asst;
+            new_node = asst;
+            break;
+        }
+        case statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs:
+        case ifs_ELIFLPARENexpr1RPARENLCURLYstatementsRCURLYifs: {
+            auto ifn = node_cast<IfNode>(RHS.back());
+            ifn->clauses.push_back({node_cast<ExprNode>(RHS[2]), node_cast<BlockNode>(RHS[5])});
+            ifn->clauses.back().cond->parent = ifn;
+            ifn->clauses.back().block->parent = ifn;
+            // the clauses come in back to front; the IF is the last of them
+            if (production_id == statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs) {
+                std::ranges::reverse(ifn->clauses);
             }
+            new_node = ifn;
+            break;
+        }
+        case ifs_: {
+            new_node = ast.make<IfNode>(&ast);
+            break;
+        }
+        case ifs_ELSELCURLYstatementsRCURLY: {
+            auto ifn = ast.make<IfNode>(&ast);
+            ifn->clauses.push_back({nullptr, node_cast<BlockNode>(RHS[2])});
+            ifn->clauses.back().block->parent = ifn;
+            new_node = ifn;
+            break;
+        }
+        case statement_FORLPARENforprologueSEMIexpr1SEMIforepilogueRPARENLCURLYstatementsRCURLY: {
+            auto pro = node_cast<ForPrologueNode>(RHS[2]);
+            auto cond = node_cast<ExprNode>(RHS[4]);
+            auto epi = node_cast<StatementNode>(RHS[6]);
+            auto block = node_cast<BlockNode>(RHS[9]);
+            auto fn = ast.make<ForNode>(pro, cond, epi, block);
+            fn->prologue->parent = fn;
+            fn->cond->parent = fn;
+            fn->epilogue->parent = fn;
+            fn->block->parent = fn;
+            new_node = fn;
+            break;
+        }
+        case forprologue_dclBECOMESexpr1: {
+            auto dcl = node_cast<DeclarationNode>(RHS.front());
+            auto expr = node_cast<ExprNode>(RHS.back());
+            auto pro = ast.make<ForPrologueNode>(ast.make<VarInitNode>(dcl, expr));
+            pro->init->parent = pro;
+            pro->init->dcl->parent = pro->init;
+            pro->init->val->parent = pro->init;
+            new_node = pro;
+            break;
+        }
+        case forprologue_expr1BECOMESexpr1: {
+            auto L = node_cast<ExprNode>(RHS.front());
+            auto R = node_cast<ExprNode>(RHS.back());
+            auto pro = ast.make<ForPrologueNode>(ast.make<AssignmentNode>(L, R));
+            pro->asst->parent = pro;
+            pro->asst->LHS->parent = pro->asst;
+            pro->asst->RHS->parent = pro->asst;
+            new_node = pro;
+            break;
+        }
+        case forepilogue_expr1BECOMESexpr1: {
+            auto L = node_cast<ExprNode>(RHS.front());
+            auto R = node_cast<ExprNode>(RHS.back());
+            auto asst = ast.make<AssignmentNode>(L, R);
+            asst->LHS->parent = asst;
+            asst->RHS->parent = asst;
+            new_node = asst;
+            break;
+        }
+        case statement_BREAKSEMI: {
+            new_node = ast.make<BreakNode>();
+            break;
+        }
+        case statement_expr1SEMI: {
+            new_node = node_cast<ExprNode>(RHS.front());
+            break;
+        }
+        case statement_DELETEexpr1SEMI: {
+            auto del = ast.make<DeleteNode>(node_cast<ExprNode>(RHS[1]));
+            del->ptr->parent = del;
+            new_node = del;
+            break;
+        }
+        case statement_PRINTLPARENargsRPARENSEMI: {
+            auto args = node_cast<ArgsNode>(RHS[2]);
+            std::ranges::reverse(args->args);
+            auto print = ast.make<PrintNode>(args);
+            print->args->parent = print;
+            new_node = print;
+            break;
+        }
+        case statement_RETURNexpr1SEMI: {
+            auto ret = ast.make<ReturnNode>(node_cast<ExprNode>(RHS[1]));
+            ret->expr->parent = ret;
+            new_node = ret;
+            break;
+        }
+        case statement_RETURNSEMI: {
+            new_node = ast.make<ReturnNode>(nullptr);
+            break;
         }
-    } catch (std::exception& e) {
-        const Token& lookahead = stream.at(token_idx);
-        print_stream_line(stream, err, token_idx);
-        err << "Parser Error in Line " << lookahead.line_num << " : Column " << lookahead.col_num << '\n';
-        err << "Detected a Token w/ type: " << lookahead.type << " -> " << lookahead.lexeme << '\n';
-        err << e.what() << std::endl;
+        case statement_WHILELPARENexpr1RPARENLCURLYstatementsRCURLY: {
+            auto w = ast.make<WhileNode>(node_cast<ExprNode>(RHS[2]), node_cast<BlockNode>(RHS[5]));
+            w->condition->parent = w;
+            w->statements->parent = w;
+            new_node = w;
+            break;
+        }
+        case statements_: {
+            new_node = ast.make<BlockNode>(&ast);
+            break;
+        }
+        case params_: {
+            new_node = ast.make<DeclarationsNode>(&ast);
+            break;
+        }
+        case expr14_LPARENexpr1RPAREN: { // expr14 -> ( expr1 )
+            new_node = RHS[1].node;
+            break;
+        }
+        case expr14_ID: { // expr14 -> ID
+            new_node = ast.make<IDNode>(RHS.front().token.symbol);
+            break;
+        }
+        case expr14_TRUE: { // expr14 -> TRUE
+            new_node = ast.make<TrueNode>();
+            break;
+        }
+        case expr14_FALSE: { // expr14 -> FALSE
+            new_node = ast.make<FalseNode>();
+            break;
+        }
+        case expr14_NIL: { // expr14 -> NIL
+            new_node = ast.make<NilNode>();
+            break;
+        }
+        case expr14_NUM: { // expr14 -> NUM
+            new_node = ast.make<NumNode>(source.lexeme(RHS.front().token));
+            break;
+        }
+        case expr14_CHARLIT: { // expr14 -> CHARLIT
+            new_node = ast.make<CharNode>(source.lexeme(RHS.front().token));
+            break;
+        }
+        case expr1_expr1ORexpr2:
+        case expr2_expr2ANDexpr3:
+        case expr3_expr3BITORexpr4:
+        case expr4_expr4BITXORexpr5:
+        case expr5_expr5BITANDexpr6:
+        case expr6_expr6EQUALSexpr7:
+        case expr6_expr6NEQexpr7:
+        case expr7_expr7LTexpr8:
+        case expr7_expr7LEQexpr8:
+        case expr7_expr7GTexpr8:
+        case expr7_expr7GEQexpr8:
+        case expr8_expr8LSHIFTexpr9:
+        case expr8_expr8RSHIFTexpr9:
+        case expr9_expr9PLUSexpr10:
+        case expr9_expr9SUBexpr10:
+        case expr10_expr10MULTexpr11:
+        case expr10_expr10DIVexpr11:
+        case expr10_expr10MODexpr11:
+        case expr12_expr13EXPexpr12: {
+            // arg1 op arg2
+            auto expr = ast.make<BinaryExprNode>(prod.RHS.at(1), node_cast<ExprNode>(RHS.front()), node_cast<ExprNode>(RHS.back()));
+            expr->LHS->parent = expr;
+            expr->RHS->parent = expr;
+            new_node = expr;
+            break;
+        }
+        case expr13_expr13ARROWID:
+        case expr13_expr13DOTID: { // arg->ID, arg.ID
+            auto ref = ast.make<MemberAccessExprNode>(prod.RHS.at(1), node_cast<ExprNode>(RHS.front()), RHS.back().token.symbol);
+            ref->arg->parent = ref;
+            new_node = ref;
+            break;
+        }
+        case expr11_ATexpr11:
+        case expr11_ADDRexpr11:
+        case expr11_NOTexpr11:
+        case expr11_BITNOTexpr11:
+        case expr11_INCRexpr11:
+        case expr11_DECRexpr11:
+        case expr11_SUBexpr11:
+        case expr11_PLUSexpr11: { // op arg
+            auto un = ast.make<UnaryExprNode>(RHS.front().token.type, node_cast<ExprNode>(RHS.back()), false);
+            un->arg->parent = un;
+            new_node = un;
+            break;
+        }
+        case expr13_expr13INCR:
+        case expr13_expr13DECR: { // arg op
+            auto un = ast.make<UnaryExprNode>(RHS.back().token.type, node_cast<ExprNode>(RHS.front()), true);
+            un->arg->parent = un;
+            new_node = un;
+            break;
+        }
+        case expr14_READLPARENRPAREN: {
+            new_node = ast.make<ReadCallNode>();
+            break;
+        }
+        case expr14_IDLPARENargsRPAREN: {
+            auto args = node_cast<ArgsNode>(RHS[2]);
+            std::ranges::reverse(args->args);
+            auto call = ast.make<FunctionCallNode>(RHS.front().token.symbol, args);
+            call->args->parent = call;
+            new_node = call;
+            break;
+        }
+        case expr14_IDLPARENRPAREN: {
+            new_node = ast.make<FunctionCallNode>(RHS.front().token.symbol, nullptr);
+            break;
+        }
+        case expr14_NEWtypeLBRACKNUMRBRACK: {
+            const TypeId ptr_type = types.pointer_to(node_cast<TypeNode>(RHS[1])->type);
+            new_node = ast.make<AllocNode>(ptr_type, parse_int(source.lexeme(RHS[3].token)));
+            break;
+        }
+        default:
+            assert(!"Unknown production used to produce AST node");
+            // ^^^ this shouldn't be possible, theoretically...
     }
-    throw std::runtime_error{"ERROR: Out - NO valid parse possible."};
-    // theoretically, this ^^^ cannot occur, assuming correctness of LEXER implementation
+    result.node = new_node;
+}
+
+// Semantic actions that also resolve names and check types as they reduce (see ParserContext::parse_checked). The tree
+// is built by TreeActions; each declaration is then bound, each name looked up and each expression typed by TypeRules
+// at its own reduction. LR reduces a block's statements in source order, so a local is always bound before its uses.
+// What cannot be settled yet (a name not bound so far, i.e. a procedure or global declared further on, and a member
+// of a struct defined further on) goes on a fix-up list, finished when start is reduced: the node is then resolved
+// and typed, and its ancestors that were waiting on it after it.
+// Scopes are tracked on the value stack: a block's scope closes at the first reduction after its RCURLY is shifted,
+// a for's once the for statement has been reduced.
+struct FusedActions {
+    // An open scope, made by the LCURLY or FOR at values[base]
+    struct Scope {
+        size_t base;
+        ParserSymbol opener;
+    };
+    // An expression left untyped until the whole program is known, and where it appeared
+    struct FixUp {
+        ExprNode* node;
+        TypeContext context;
+    };
+    // A struct named in a type before any definition of it
+    struct StructUse {
+        Symbol name;
+        TypeContext context;
+    };
+
+    const std::vector<SemanticValue>& values;
+    TreeActions tree;
+    const Interner& symbols;
+    std::ostream& err;
+    TypeRules rules;
+    ScopedSymbolTable table;
+    std::vector<Scope> scopes;
+    std::vector<bool> struct_declared;                  // per Symbol
+    std::vector<SymbolTableEntry*> structs, procedures; // in source order; main is the last procedure
+    std::vector<SymbolTableEntry*> locals;              // params and locals of the procedure being parsed
+    uint32_t num_globals = 0;
+    uint32_t loop_depth = 0;                            // whiles and fors whose body is being parsed
+    bool in_struct = false;                             // reducing a struct's fields
+    std::vector<FixUp> fix_ups;
+    std::vector<StructUse> struct_uses;
+    bool ok = true;
+
+    FusedActions(const std::vector<SemanticValue>& values, const SourceBuffer& source, TypeTable& types, Arena& ast,
+                 const Interner& symbols, std::ostream& err)
+        : values{values}, tree{source, types, ast}, symbols{symbols}, err{err}, rules{types, symbols, err} {
+        table.open_scope(); // structs, globals and procedures
+    }
+
+    void reduce(uint16_t production_id, std::span<SemanticValue> RHS, SemanticValue& result);
+
+    void error(Symbol name, std::string_view problem);
+    void close_scopes();
+    void open_scope(ParserSymbol opener, size_t base);
+    void open_statements();
+    void use_type(TypeId type);
+    SymbolTableEntry* declare(SymbolTableEntry::Kind kind, Symbol name, TypeId type, uint32_t index, ASTNode* node);
+    void declare_local(SymbolTableEntry::Kind kind, DeclarationNode& d);
+    void declare_global(DeclarationNode& d);
+    void define_struct(StructDefNode& sd);
+    void define_procedure(ProcedureNode& proc);
+    void use(IDNode& a, SymbolTableEntry* entry);
+    void use(FunctionCallNode& a, SymbolTableEntry* entry);
+    void propagate(ExprNode* e);
+    void finish(ProgramNode& program);
+};
+
+void FusedActions::error(Symbol name, std::string_view problem) {
+    err << "Name Error in " << (rules.context.in_procedure ? "procedure " : "global scope");
+    if (rules.context.in_procedure) err << symbols.name(rules.context.procedure);
+    err << ": '" << symbols.name(name) << "' " << problem << '\n';
+    ok = false;
+}
+
+// Closes the scopes whose block or for the parse has moved past: a block once its RCURLY is on the stack, either
+// once its opener is no longer at base
+void FusedActions::close_scopes() {
+    while (!scopes.empty()) {
+        const Scope& s = scopes.back();
+        const bool open = values.size() > s.base && values[s.base].token.type == s.opener &&
+                          !(s.opener == LCURLY && values.size() > s.base + 2 && values[s.base + 2].token.type == RCURLY);
+        if (open) return;
+        table.close_scope();
+        scopes.pop_back();
+    }
+}
+
+void FusedActions::open_scope(ParserSymbol opener, size_t base) {
+    table.open_scope();
+    scopes.push_back({base, opener});
+}
+
+// statements -> ε, reduced just after the LCURLY of a block. A procedure's (or main's) body begins the procedure:
+// its parameters and the body's top-level statements share one scope. A loop's body is inside the loop until the
+// while or for statement is reduced.
+void FusedActions::open_statements() {
+    const size_t n = values.size();
+    if (values[n - 3].token.type != ARROW) {
+        // WHILE LPAREN expr1 RPAREN LCURLY, FOR LPAREN forprologue SEMI expr1 SEMI forepilogue RPAREN LCURLY
+        if (values[n - 5].token.type == WHILE || values[n - 9].token.type == FOR) loop_depth++;
+        open_scope(LCURLY, n - 1);
+        return;
+    }
+    const bool is_main = values[n - 7].token.type == MAIN;
+    const TypeId return_type = is_main ? TYPE_INT
+                             : values[n - 2].token.type == VOID ? TYPE_VOID
+                             : node_cast<TypeNode>(values[n - 2])->type;
+    rules.context = {true, is_main ? Symbol{SYM_MAIN} : values[n - 8].token.symbol, return_type};
+    locals.clear();
+    open_scope(LCURLY, n - 1);
+    if (is_main) return;
+    // the parameter list is still back to front
+    auto params = node_cast<DeclarationsNode>(values[n - 5]);
+    for (DeclarationNode* param : std::views::reverse(params->declarations)) {
+        declare_local(SymbolTableEntry::PARAM, *param);
+    }
+}
+
+// Struct names only ever appear inside types; one not defined so far is checked again at the end
+void FusedActions::use_type(TypeId type) {
+    const TypeInfo& base = tree.types[tree.types[type].base];
+    if (base.kind == TypeInfo::STRUCT && (base.name >= struct_declared.size() || !struct_declared[base.name])) {
+        struct_uses.push_back({base.name, rules.context});
+    }
+}
+
+SymbolTableEntry* FusedActions::declare(SymbolTableEntry::Kind kind, Symbol name, TypeId type, uint32_t index,
+                                        ASTNode* node) {
+    use_type(type);
+    SymbolTableEntry* entry = tree.ast.make<SymbolTableEntry>(kind, name, type, index, node);
+    if (!table.bind(entry)) error(name, "is already declared in this scope");
+    return entry;
+}
+
+void FusedActions::declare_local(SymbolTableEntry::Kind kind, DeclarationNode& d) {
+    d.entry = declare(kind, d.id, d.type, locals.size(), &d);
+    locals.push_back(d.entry);
+}
+
+// dcl -> type ID outside a procedure: a global, unless it is a struct's field or a parameter. A global is bound before
+// its initialiser is parsed, which may thus refer to it, as in resolve_names.
+void FusedActions::declare_global(DeclarationNode& d) {
+    const ParserSymbol below = values[values.size() - 3].token.type;
+    if (below == LCURLY) in_struct = true; // the first field
+    if (in_struct || below == LPAREN || below == COMMA) return;
+    d.entry = declare(SymbolTableEntry::GLOBAL, d.id, d.type, num_globals++, &d);
+}
+
+void FusedActions::define_struct(StructDefNode& sd) {
+    in_struct = false;
+    if (sd.id >= struct_declared.size()) struct_declared.resize(sd.id + 1, false);
+    if (struct_declared[sd.id]) error(sd.id, "is already declared as a struct");
+    struct_declared[sd.id] = true;
+    structs.push_back(tree.ast.make<SymbolTableEntry>(SymbolTableEntry::STRUCT, sd.id, sd.type, 0, &sd));
+
+    table.open_scope();
+    uint32_t index = 0;
+    for (DeclarationNode* field : sd.fields->declarations) {
+        use_type(field->type);
+        field->entry = tree.ast.make<SymbolTableEntry>(SymbolTableEntry::FIELD, field->id, field->type, index++, field);
+        if (!table.bind(field->entry)) error(field->id, "is declared twice in one struct");
+    }
+    table.close_scope();
+    rules.define(sd);
+}
+
+// Once its body has been reduced (and its scope closed), a procedure is bound in the global scope
+void FusedActions::define_procedure(ProcedureNode& proc) {
+    proc.symbol_table.assign(locals.begin(), locals.end());
+    rules.context = {};
+    procedures.push_back(declare(SymbolTableEntry::PROCEDURE, proc.id, proc.return_type, procedures.size(), &proc));
+}
+
+// Resolves a to entry, the binding its name had where it appeared (nullptr if none), and types it
+void FusedActions::use(IDNode& a, SymbolTableEntry* entry) {
+    if (!entry) error(a.name, "is not declared");
+    else if (entry->kind == SymbolTableEntry::PROCEDURE) error(a.name, "is a procedure, not a variable");
+    else a.entry = entry;
+    rules.type(a);
+}
+
+void FusedActions::use(FunctionCallNode& a, SymbolTableEntry* entry) {
+    if (!entry) error(a.id, "is not declared");
+    else if (entry->kind != SymbolTableEntry::PROCEDURE) error(a.id, "is not a procedure");
+    else a.callee = entry;
+    rules.type(a);
+}
+
+// e has just been typed at the end of the parse: types the ancestors that were waiting on it, up to the statement,
+// which checks it
+void FusedActions::propagate(ExprNode* e) {
+    while (e->type != NO_TYPE_ID) {
+        ASTNode* parent = e->parent;
+        if (isa<ArgsNode>(*parent)) parent = parent->parent; // a call's or a print's
+        auto up = ast_dyn_cast<ExprNode>(parent);
+        if (!up) {
+            rules.check(*parent, *e);
+            return;
+        }
+        rules.type(*up);
+        e = up;
+    }
+}
+
+void FusedActions::finish(ProgramNode& program) {
+    program.symbol_table.assign(structs.begin(), structs.end());
+    for (VarInitNode* gv : program.global_vars) program.symbol_table.push_back(gv->dcl->entry);
+    program.symbol_table.insert(program.symbol_table.end(), procedures.begin(), procedures.end());
+
+    // Only the global scope is open now, so a name still unbound is either declared there or not at all
+    for (const FixUp& f : fix_ups) {
+        rules.context = f.context;
+        if (auto id = ast_dyn_cast<IDNode>(f.node)) use(*id, table.lookup(id->name));
+        else if (auto call = ast_dyn_cast<FunctionCallNode>(f.node)) use(*call, table.lookup(call->id));
+        else rules.type(*f.node);
+        propagate(f.node);
+    }
+    for (const StructUse& u : struct_uses) {
+        if (u.name >= struct_declared.size() || !struct_declared[u.name]) {
+            rules.context = u.context;
+            error(u.name, "is not declared as a struct");
+        }
+    }
+    rules.context = {};
+}
+
+void FusedActions::reduce(uint16_t production_id, std::span<SemanticValue> RHS, SemanticValue& result) {
+    close_scopes();
+    tree.reduce(production_id, RHS, result);
+    switch (production_id) {
+        case start_BoFproceduresEoF:
+            finish(*ast_cast<ProgramNode>(result.node));
+            break;
+        case procedures_dclBECOMESexpr1SEMIprocedures: {
+            VarInitNode& init = *ast_cast<ProgramNode>(result.node)->global_vars.back();
+            rules.check(init, *init.val);
+            break;
+        }
+        case structdef_STRUCTIDLCURLYdclsRCURLYSEMI:
+            define_struct(*ast_cast<StructDefNode>(result.node));
+            break;
+        case procedure_IDCOLONLPARENparamsRPARENARROWtypeLCURLYstatementsRCURLY:
+        case procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY:
+        case main_MAINCOLONLPARENRPARENARROWINTLCURLYstatementsRCURLY:
+            define_procedure(*ast_cast<ProcedureNode>(result.node));
+            break;
+        case statements_:
+            open_statements();
+            break;
+        case dcl_typeID:
+            if (!rules.context.in_procedure) declare_global(*ast_cast<DeclarationNode>(result.node));
+            break;
+        case statement_dclSEMI:
+            declare_local(SymbolTableEntry::LOCAL, *ast_cast<DeclarationNode>(result.node));
+            break;
+        case statement_dclBECOMESexpr1SEMI: { // the initialiser cannot see the variable it initialises
+            auto init = ast_cast<VarInitNode>(result.node);
+            declare_local(SymbolTableEntry::LOCAL, *init->dcl);
+            rules.check(*init, *init->val);
+            break;
+        }
+        case forprologue_dclBECOMESexpr1: { // FOR LPAREN dcl BECOMES expr1: the variable is visible to the end of the for
+            VarInitNode& init = *ast_cast<ForPrologueNode>(result.node)->init;
+            open_scope(FOR, values.size() - 5);
+            declare_local(SymbolTableEntry::LOCAL, *init.dcl);
+            rules.check(init, *init.val);
+            break;
+        }
+        case forprologue_expr1BECOMESexpr1: {
+            AssignmentNode& asst = *ast_cast<ForPrologueNode>(result.node)->asst;
+            rules.check(asst, *asst.RHS);
+            break;
+        }
+        case statement_expr1BECOMESexpr1SEMI:
+        case forepilogue_expr1BECOMESexpr1: {
+            auto asst = ast_cast<AssignmentNode>(result.node);
+            rules.check(*asst, *asst->RHS);
+            break;
+        }
+        case statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs:
+        case ifs_ELIFLPARENexpr1RPARENLCURLYstatementsRCURLYifs:
+            rules.check(*result.node, *node_cast<ExprNode>(RHS[2]));
+            break;
+        case statement_WHILELPARENexpr1RPARENLCURLYstatementsRCURLY:
+            loop_depth--;
+            rules.check(*result.node, *node_cast<ExprNode>(RHS[2]));
+            break;
+        case statement_FORLPARENforprologueSEMIexpr1SEMIforepilogueRPARENLCURLYstatementsRCURLY:
+            loop_depth--;
+            rules.check(*result.node, *node_cast<ExprNode>(RHS[4]));
+            break;
+        case statement_BREAKSEMI:
+            if (loop_depth > 0) break;
+            err << "Scope Error in procedure " << symbols.name(rules.context.procedure) << ": break outside a loop\n";
+            ok = false;
+            break;
+        case statement_DELETEexpr1SEMI:
+            rules.check(*result.node, *node_cast<ExprNode>(RHS[1]));
+            break;
+        case statement_PRINTLPARENargsRPARENSEMI: {
+            auto print = ast_cast<PrintNode>(result.node);
+            for (ExprNode* arg : print->args->args) rules.check(*print, *arg);
+            break;
+        }
+        case statement_RETURNexpr1SEMI:
+        case statement_RETURNSEMI:
+            rules.check(*ast_cast<ReturnNode>(result.node));
+            break;
+        case expr14_ID: {
+            auto id = ast_cast<IDNode>(result.node);
+            if (SymbolTableEntry* entry = table.lookup(id->name)) use(*id, entry);
+            else fix_ups.push_back({id, rules.context});
+            break;
+        }
+        case expr14_IDLPARENargsRPAREN:
+        case expr14_IDLPARENRPAREN: {
+            auto call = ast_cast<FunctionCallNode>(result.node);
+            if (SymbolTableEntry* entry = table.lookup(call->id)) use(*call, entry);
+            else fix_ups.push_back({call, rules.context});
+            break;
+        }
+        case expr13_expr13ARROWID:
+        case expr13_expr13DOTID: {
+            auto member = ast_cast<MemberAccessExprNode>(result.node);
+            rules.type(*member);
+            if (member->type == NO_TYPE_ID && member->arg->type != NO_TYPE_ID) fix_ups.push_back({member, rules.context});
+            break;
+        }
+        case expr14_NEWtypeLBRACKNUMRBRACK:
+            use_type(ast_cast<AllocNode>(result.node)->ptr_type);
+            rules.type(*ast_cast<ExprNode>(result.node));
+            break;
+        default:
+            // the operators and read() are typed from their operands; typing again an expression that passes through
+            // still untyped (in parentheses, or as a statement) changes nothing
+            if (auto e = ast_dyn_cast<ExprNode>(result.node); e && e->type == NO_TYPE_ID) rules.type(*e);
+    }
+}
+
+// Semantic actions building the flat AST. A value is a node id, or the list being reduced for the list
+// nonterminals; type and star carry no node, but the TypeId or the '@' count in their token's symbol. The nodes
+// record types by their spelling.
+struct FlatActions {
+    const SourceBuffer& source;
+    TypeTable& types;
+    FlatBuilder build;
+
+    void reduce(uint16_t production_id, std::span<SemanticValue> RHS, SemanticValue& result);
+};
+
+// The source span covered by some consecutive RHS values
+Token span_of(std::span<const SemanticValue> part) {
+    const Token& last = part.back().token;
+    return {part.front().token.type, part.front().token.offset, last.offset + last.length - part.front().token.offset};
+}
+
+void FlatActions::reduce(uint16_t production_id, std::span<SemanticValue> RHS, SemanticValue& result) {
+    const Production& prod = PRODUCTIONS[production_id];
+    const Token& span = result.token;
+    switch (production_id) {
+        case start_BoFproceduresEoF: {
+            result.index = build.close({.kind = Flat::PROGRAM}, RHS[1].token, RHS[1].index);
+            break;
+        }
+        case procedures_dclSEMIprocedures: {
+            const NodeId init = build.add({.kind = Flat::VAR_INIT}, span_of(RHS.first(2)), {RHS[0].index});
+            result.index = build.prepend(RHS.back().index, init);
+            break;
+        }
+        case procedures_dclBECOMESexpr1SEMIprocedures: {
+            const NodeId init = build.add({.kind = Flat::VAR_INIT}, span_of(RHS.first(4)), {RHS[0].index, RHS[2].index});
+            result.index = build.prepend(RHS.back().index, init);
+            break;
+        }
+        case procedures_structdefprocedures:
+        case procedures_procedureprocedures: {
+            result.index = build.prepend(RHS.back().index, RHS.front().index);
+            break;
+        }
+        case structdef_STRUCTIDLCURLYdclsRCURLYSEMI: {
+            const NodeId fields = build.close({.kind = Flat::DECLS}, RHS[3].token, RHS[3].index);
+            result.index = build.add({.kind = Flat::STRUCT_DEF, .payload = RHS[1].token.symbol}, span, {fields});
+            break;
+        }
+        case procedure_IDCOLONLPARENparamsRPARENARROWtypeLCURLYstatementsRCURLY:
+        case procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY: {
+            const NodeId params = build.close({.kind = Flat::DECLS}, RHS[3].token, RHS[3].index);
+            const NodeId block = build.close({.kind = Flat::BLOCK}, RHS[8].token, RHS[8].index, true);
+            const Symbol type = (production_id == procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY)
+                              ? Symbol{SYM_VOID} : types.spelling(RHS[6].token.symbol);
+            result.index = build.add({.kind = Flat::PROCEDURE, .type = type, .payload = RHS[0].token.symbol}, span, {params, block});
+            break;
+        }
+        case procedures_main: {
+            result.index = build.prepend(NO_LIST, RHS.front().index);
+            break;
+        }
+        case main_MAINCOLONLPARENRPARENARROWINTLCURLYstatementsRCURLY: {
+            const NodeId block = build.close({.kind = Flat::BLOCK}, RHS[7].token, RHS[7].index, true);
+            result.index = build.add({.kind = Flat::MAIN, .type = SYM_INT, .payload = SYM_MAIN}, span, {block});
+            break;
+        }
+        case statements_statementsstatement: { // built back to front, reversed when the block closes
+            result.index = build.prepend(RHS.front().index, RHS.back().index);
+            break;
+        }
+        case args_expr1COMMAargs:
+        case paramlist_dclCOMMAparamlist:
+        case dcls_dclSEMIdcls: {
+            result.index = build.prepend(RHS.back().index, RHS.front().index);
+            break;
+        }
+        case args_expr1:
+        case paramlist_dcl:
+        case dcls_dclSEMI: {
+            result.index = build.prepend(NO_LIST, RHS.front().index);
+            break;
+        }
+        case dcl_typeID: {
+            const Symbol type = types.spelling(RHS.front().token.symbol);
+            result.index = build.add({.kind = Flat::DECLARATION, .type = type, .payload = RHS.back().token.symbol}, span);
+            break;
+        }
+        case type_INTstar:
+        case type_CHARstar:
+        case type_BOOLstar:
+        case type_STRUCTIDstar: {
+            result.token.symbol = make_type(types, RHS[RHS.size() - 2].token, RHS.back().token.symbol);
+            break;
+        }
+        case star_ATstar: {
+            result.token.symbol = RHS.back().token.symbol + 1;
+            break;
+        }
+        case star_: {
+            result.token.symbol = 0;
+            break;
+        }
+        case statement_dclBECOMESexpr1SEMI: {
+            result.index = build.add({.kind = Flat::VAR_INIT}, span, {RHS[0].index, RHS[2].index});
+            break;
+        }
+        case statement_expr1BECOMESexpr1SEMI:
+        case forepilogue_expr1BECOMESexpr1: {
+            result.index = build.add({.kind = Flat::ASSIGNMENT}, span, {RHS[0].index, RHS[2].index});
+            break;
+        }
+        case statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs:
+        case ifs_ELIFLPARENexpr1RPARENLCURLYstatementsRCURLYifs: {
+            const NodeId block = build.close({.kind = Flat::BLOCK}, RHS[5].token, RHS[5].index, true);
+            const uint32_t clauses = build.prepend(build.prepend(RHS.back().index, block), RHS[2].index);
+            result.index = (production_id == statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs)
+                         ? build.close({.kind = Flat::IF}, span, clauses) : clauses;
+            break;
+        }
+        case ifs_:
+        case statements_:
+        case params_: {
+            result.index = NO_LIST;
+            break;
+        }
+        case ifs_ELSELCURLYstatementsRCURLY: {
+            const NodeId block = build.close({.kind = Flat::BLOCK}, RHS[2].token, RHS[2].index, true);
+            result.index = build.prepend(build.prepend(NO_LIST, block), NO_NODE);
+            break;
+        }
+        case statement_FORLPARENforprologueSEMIexpr1SEMIforepilogueRPARENLCURLYstatementsRCURLY: {
+            const NodeId block = build.close({.kind = Flat::BLOCK}, RHS[9].token, RHS[9].index, true);
+            result.index = build.add({.kind = Flat::FOR}, span, {RHS[2].index, RHS[4].index, RHS[6].index, block});
+            break;
+        }
+        case forprologue_dclBECOMESexpr1: {
+            const NodeId init = build.add({.kind = Flat::VAR_INIT}, span, {RHS[0].index, RHS[2].index});
+            result.index = build.add({.kind = Flat::FOR_PROLOGUE}, span, {init});
+            break;
+        }
+        case forprologue_expr1BECOMESexpr1: {
+            const NodeId asst = build.add({.kind = Flat::ASSIGNMENT}, span, {RHS[0].index, RHS[2].index});
+            result.index = build.add({.kind = Flat::FOR_PROLOGUE}, span, {asst});
+            break;
+        }
+        case statement_BREAKSEMI: {
+            result.index = build.add({.kind = Flat::BREAK}, span);
+            break;
+        }
+        case statement_DELETEexpr1SEMI: {
+            result.index = build.add({.kind = Flat::DELETE}, span, {RHS[1].index});
+            break;
+        }
+        case statement_PRINTLPARENargsRPARENSEMI: {
+            const NodeId args = build.close({.kind = Flat::ARGS}, RHS[2].token, RHS[2].index);
+            result.index = build.add({.kind = Flat::PRINT}, span, {args});
+            break;
+        }
+        case statement_RETURNexpr1SEMI: {
+            result.index = build.add({.kind = Flat::RETURN}, span, {RHS[1].index});
+            break;
+        }
+        case statement_RETURNSEMI: {
+            result.index = build.add({.kind = Flat::RETURN}, span);
+            break;
+        }
+        case statement_WHILELPARENexpr1RPARENLCURLYstatementsRCURLY: {
+            const NodeId block = build.close({.kind = Flat::BLOCK}, RHS[5].token, RHS[5].index, true);
+            result.index = build.add({.kind = Flat::WHILE}, span, {RHS[2].index, block});
+            break;
+        }
+        case statement_dclSEMI:
+        case statement_expr1SEMI: {
+            result.index = RHS.front().index;
+            break;
+        }
+        case expr14_LPARENexpr1RPAREN: {
+            result.index = RHS[1].index;
+            break;
+        }
+        case expr14_ID: {
+            result.index = build.add({.kind = Flat::ID, .payload = RHS.front().token.symbol}, span);
+            break;
+        }
+        case expr14_TRUE: {
+            result.index = build.add({.kind = Flat::TRUE, .type = SYM_BOOL, .payload = 1}, span);
+            break;
+        }
+        case expr14_FALSE: {
+            result.index = build.add({.kind = Flat::FALSE, .type = SYM_BOOL}, span);
+            break;
+        }
+        case expr14_NIL: {
+            result.index = build.add({.kind = Flat::NIL}, span);
+            break;
+        }
+        case expr14_NUM: {
+            const auto val = static_cast<uint32_t>(parse_int(source.lexeme(RHS.front().token)));
+            result.index = build.add({.kind = Flat::NUM, .type = SYM_INT, .payload = val}, span);
+            break;
+        }
+        case expr14_CHARLIT: {
+            const auto val = static_cast<unsigned char>(parse_char(source.lexeme(RHS.front().token)));
+            result.index = build.add({.kind = Flat::CHARLIT, .type = SYM_CHAR, .payload = val}, span);
+            break;
+        }
+        case expr1_expr1ORexpr2:
+        case expr2_expr2ANDexpr3:
+        case expr3_expr3BITORexpr4:
+        case expr4_expr4BITXORexpr5:
+        case expr5_expr5BITANDexpr6:
+        case expr6_expr6EQUALSexpr7:
+        case expr6_expr6NEQexpr7:
+        case expr7_expr7LTexpr8:
+        case expr7_expr7LEQexpr8:
+        case expr7_expr7GTexpr8:
+        case expr7_expr7GEQexpr8:
+        case expr8_expr8LSHIFTexpr9:
+        case expr8_expr8RSHIFTexpr9:
+        case expr9_expr9PLUSexpr10:
+        case expr9_expr9SUBexpr10:
+        case expr10_expr10MULTexpr11:
+        case expr10_expr10DIVexpr11:
+        case expr10_expr10MODexpr11:
+        case expr12_expr13EXPexpr12: {
+            result.index = build.add({.kind = Flat::BINARY, .op = prod.RHS[1]}, span, {RHS.front().index, RHS.back().index});
+            break;
+        }
+        case expr13_expr13ARROWID:
+        case expr13_expr13DOTID: {
+            result.index = build.add({.kind = Flat::MEMBER, .op = prod.RHS[1], .payload = RHS.back().token.symbol}, span, {RHS.front().index});
+            break;
+        }
+        case expr11_ATexpr11:
+        case expr11_ADDRexpr11:
+        case expr11_NOTexpr11:
+        case expr11_BITNOTexpr11:
+        case expr11_INCRexpr11:
+        case expr11_DECRexpr11:
+        case expr11_SUBexpr11:
+        case expr11_PLUSexpr11: {
+            result.index = build.add({.kind = Flat::UNARY, .op = RHS.front().token.type}, span, {RHS.back().index});
+            break;
+        }
+        case expr13_expr13INCR:
+        case expr13_expr13DECR: {
+            result.index = build.add({.kind = Flat::POSTFIX, .op = RHS.back().token.type}, span, {RHS.front().index});
+            break;
+        }
+        case expr14_READLPARENRPAREN: {
+            result.index = build.add({.kind = Flat::READ, .payload = SYM_READ}, span);
+            break;
+        }
+        case expr14_IDLPARENargsRPAREN: {
+            const NodeId args = build.close({.kind = Flat::ARGS}, RHS[2].token, RHS[2].index);
+            result.index = build.add({.kind = Flat::CALL, .payload = RHS.front().token.symbol}, span, {args});
+            break;
+        }
+        case expr14_IDLPARENRPAREN: {
+            result.index = build.add({.kind = Flat::CALL, .payload = RHS.front().token.symbol}, span);
+            break;
+        }
+        case expr14_NEWtypeLBRACKNUMRBRACK: {
+            const Symbol ptr_type = types.spelling(types.pointer_to(RHS[1].token.symbol));
+            const auto size = static_cast<uint32_t>(parse_int(source.lexeme(RHS[3].token)));
+            result.index = build.add({.kind = Flat::ALLOC, .type = ptr_type, .payload = size}, span);
+            break;
+        }
+        default:
+            assert(!"Unknown production used to produce flat AST node");
+    }
+}
+
+void report_syntax_error(const TokenSource& tokens, const Token& lookahead, const SourceBuffer& source, std::ostream& err) {
+    const SourceLocation loc = source.location(lookahead.offset);
+    print_stream_line(source, loc, err);
+    err << "Parser Error in Line " << loc.line << " : Column " << loc.col << '\n';
+    err << "Detected a Token w/ type: " << lookahead.type << " -> " << source.lexeme(lookahead) << '\n';
+    print_recent_tokens(tokens, source, err);
+    err << "ERROR: NO valid parse possible." << std::endl;
+}
+
+#ifdef XERLANG_DIRECT_PARSER
+
+// Directly-coded driver: every LALR state is a block of generated code (parser_direct.inc) that switches on the
+// lookahead and jumps straight to the next state's block, so there is no table lookup and each state's branch
+// gets its own predictor history.
+template <class Actions>
+bool ParserContext::drive(TokenSource& tokens, const SourceBuffer& source, std::ostream& err, Actions& actions) {
+    states.clear();
+    values.clear();
+    states.push_back(0);
+    values.push_back({});
+    Token lookahead = tokens.next();
+    if (tokens.failed()) return false; // the token source hit a lexer error, which it has already reported
+
+#define XERLANG_SHIFT(target) {                                   \
+        states.push_back(target);                                 \
+        values.push_back({.token = lookahead, .node = nullptr});  \
+        lookahead = tokens.next();                                \
+        if (tokens.failed()) return false;                        \
+        goto state_##target;                                      \
+    }
+#define XERLANG_REDUCE(production, lhs) {                         \
+        reduce(production, actions);                              \
+        goto goto_##lhs;                                          \
+    }
+#define XERLANG_GOTO(target) {                                    \
+        states.push_back(target);                                 \
+        goto state_##target;                                      \
+    }
+#define XERLANG_ACCEPT() return true
+#define XERLANG_ERROR() {                                         \
+        report_syntax_error(tokens, lookahead, source, err);      \
+        return false;                                             \
+    }
+
+#include "parser_direct.inc"
+
+#undef XERLANG_SHIFT
+#undef XERLANG_REDUCE
+#undef XERLANG_GOTO
+#undef XERLANG_ACCEPT
+#undef XERLANG_ERROR
+}
+
+#else
+
+template <class Actions>
+bool ParserContext::drive(TokenSource& tokens, const SourceBuffer& source, std::ostream& err, Actions& actions) {
+    states.clear();
+    values.clear();
+    states.push_back(0);
+    values.push_back({});
+    Token lookahead = tokens.next();
+
+    while (!tokens.failed()) {
+        const ParsingTableEntry pte = action(states.back(), lookahead.type);
+
+        switch (pte.act) {
+            case ParsingTableEntry::Action::SHIFT:
+                states.push_back(pte.target_state);
+                values.push_back({.token = lookahead, .node = nullptr});
+                lookahead = tokens.next();
+                break;
+            case ParsingTableEntry::Action::REDUCE: {
+                reduce(pte.production_id, actions);
+                const ParserSymbol lhs = PRODUCTIONS[pte.production_id].LHS;
+                states.push_back(goto_state(states.back(), lhs));
+                break;
+            }
+            case ParsingTableEntry::Action::ACCEPT:
+                return true;
+            default:
+                report_syntax_error(tokens, lookahead, source, err);
+                return false;
+        }
+    }
+    return false; // the token source hit a lexer error, which it has already reported
+}
+
+#endif // XERLANG_DIRECT_PARSER
+
+ASTNode* ParserContext::parse(TokenSource& tokens, const SourceBuffer& source, TypeTable& types, Arena& ast, std::ostream& err) {
+    TreeActions actions{source, types, ast};
+    return drive(tokens, source, err, actions) ? values.back().node : nullptr;
+}
+
+ASTNode* ParserContext::parse_checked(TokenSource& tokens, const SourceBuffer& source, const Interner& symbols,
+                                      TypeTable& types, Arena& ast, std::ostream& err) {
+    FusedActions actions{values, source, types, ast, symbols, err};
+    if (!drive(tokens, source, err, actions)) return nullptr;
+    return actions.ok && actions.rules.ok ? values.back().node : nullptr;
+}
+
+bool ParserContext::parse_flat(TokenSource& tokens, const SourceBuffer& source, TypeTable& types, FlatAST& out, std::ostream& err) {
+    FlatActions actions{source, types, FlatBuilder{out}};
+    if (!drive(tokens, source, err, actions)) return false;
+    actions.build.finish(values.back().index);
+    return true;
+}
+
+ASTNode* parse(TokenSource& tokens, const SourceBuffer& source, TypeTable& types, Arena& ast, std::ostream& err) {
+    ParserContext ctx;
+    return ctx.parse(tokens, source, types, ast, err);
 }
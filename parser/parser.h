@@ -1,12 +1,60 @@
 #ifndef PARSER_H
 #define PARSER_H
 
+#include <cstdint>
+#include <iosfwd>
 #include <vector>
-#include <memory>
+#include "util/arena.h"
+#include "util/interner.h"
+#include "util/source.h"
+#include "util/type_table.h"
 #include "util/types.h"
+#include "scanner/token_source.h"
 
-std::unique_ptr<ASTNode> parse(const std::vector<Token>& stream, std::ostream& err);
+// Initial capacity of the LALR stacks; they grow as needed and keep their storage across parses
+#define INITIAL_PARSE_STACK 256
 
-void print_AST(const std::unique_ptr<ASTNode>& root, size_t depth, std::ostream& os);
+struct SemanticValue;
+struct FlatAST;
+
+// Reusable state for the LALR driver. The state and value stacks live here rather than in globals, so each thread
+// can parse with its own context, and reusing a context avoids allocating the stacks again.
+class ParserContext {
+    std::vector<uint16_t> states;
+    std::vector<SemanticValue> values;
+
+    // Runs the LALR automaton over tokens, calling actions to build each reduction's value; true on accept, with
+    // the result on top of the value stack
+    template <class Actions>
+    bool drive(TokenSource& tokens, const SourceBuffer& source, std::ostream& err, Actions& actions);
+
+    // Runs production_id's semantic action on the top of the value stack, replaces its RHS values with the result
+    // and pops the RHS states; the caller pushes the GOTO state
+    template <class Actions>
+    void reduce(uint16_t production_id, Actions& actions);
+
+public:
+    ParserContext();
+    ~ParserContext();
+
+    // Parses the tokens pulled one lookahead at a time from tokens, allocating the AST in ast and the types it names
+    // in types; the tree lives as long as the arena. Returns nullptr on failure, after reporting syntax errors (with
+    // the most recent tokens for context) to err; a stream that failed() was already reported.
+    ASTNode* parse(TokenSource& tokens, const SourceBuffer& source, TypeTable& types, Arena& ast, std::ostream& err);
+
+    // As parse(), but also resolves names and checks types in the reduce actions, leaving the tree as resolve_names
+    // and check_types would, without walking it again. Returns nullptr if there were syntax, name or type errors.
+    ASTNode* parse_checked(TokenSource& tokens, const SourceBuffer& source, const Interner& symbols, TypeTable& types,
+                           Arena& ast, std::ostream& err);
+
+    // As parse(), but builds the flat, index-based form of the AST (flat_ast.h) into out. It is syntax only: the
+    // procedures have no SYMBOL_TABLEs and the IDs no types, which flatten_ast of the checked tree provides.
+    bool parse_flat(TokenSource& tokens, const SourceBuffer& source, TypeTable& types, FlatAST& out, std::ostream& err);
+};
+
+// One-off parse with a fresh ParserContext
+ASTNode* parse(TokenSource& tokens, const SourceBuffer& source, TypeTable& types, Arena& ast, std::ostream& err);
+
+void print_AST(const ASTNode* root, size_t depth, std::ostream& os);
 
 #endif //PARSER_H
@@ -1,500 +0,0 @@
-#ifndef PARSER_CONSTANTS_H
-#define PARSER_CONSTANTS_H
-
-#define NUM_STATES 235
-#define NUM_PRODUCTIONS 101
-
-// Lookahead Table generated with help from: https://mdaines.github.io/grammophone/#/
-
-using namespace Parser;
-
-struct ParsingTableEntry {
-    enum class Action : uint8_t { NIL, SHIFT, REDUCE, GOTO, ACCEPT };
-
-    Action act = Action::NIL;
-    union {
-        uint16_t target_state = 0;
-        uint16_t production_id;
-    };
-};
-
-consteval ParsingTableEntry s(uint16_t n) {
-    ParsingTableEntry pte;
-    pte.act = ParsingTableEntry::Action::SHIFT;
-    pte.target_state = n;
-    return pte;
-}
-
-consteval ParsingTableEntry r(uint16_t n) {
-    ParsingTableEntry pte;
-    pte.act = ParsingTableEntry::Action::REDUCE;
-    pte.production_id = n;
-    return pte;
-}
-
-consteval ParsingTableEntry g(uint16_t n) {
-    ParsingTableEntry pte;
-    pte.act = ParsingTableEntry::Action::GOTO;
-    pte.target_state = n;
-    return pte;
-}
-
-consteval ParsingTableEntry a() {
-    ParsingTableEntry pte;
-    pte.act = ParsingTableEntry::Action::ACCEPT;
-    pte.target_state = 0;
-    return pte;
-}
-
-consteval ParsingTableEntry n() {
-    ParsingTableEntry pte;
-    pte.act = ParsingTableEntry::Action::NIL;
-    pte.target_state = 0;
-    return pte;
-}
-
-inline constexpr std::array<std::array<ParsingTableEntry, ParserSymbol::NUM_SYMBOLS>, NUM_STATES> PARSING_TABLE = {{
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(2),n(),g(1),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),a()},
-    {s(11),n(),n(),s(12),s(13),s(14),s(9),n(),n(),n(),n(),n(),n(),s(10),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(3),g(6),g(7),g(8),n(),n(),n(),n(),g(4),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(5),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(15),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(16),n(),n(),n(),n(),n(),s(17),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {s(11),n(),n(),s(12),s(13),s(14),s(9),n(),n(),n(),n(),n(),n(),s(10),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(18),g(6),g(7),g(8),n(),n(),n(),n(),g(4),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(5),n()},
-    {s(11),n(),n(),s(12),s(13),s(14),s(9),n(),n(),n(),n(),n(),n(),s(10),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(19),g(6),g(7),g(8),n(),n(),n(),n(),g(4),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(5),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(5),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(20),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(21),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(22),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(23),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(24),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(26),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(27),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(0)},
-    {s(11),n(),n(),s(12),s(13),s(14),s(9),n(),n(),n(),n(),n(),n(),s(10),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(28),g(6),g(7),g(8),n(),n(),n(),n(),g(4),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(5),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(29),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(3),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(4),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(16),r(16),n(),n(),r(16),n(),n(),r(16),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(60),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(61),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(62),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(63),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(40),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(40),n(),n(),r(40),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(64),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(41),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(41),n(),n(),r(41),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(42),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(42),n(),n(),r(42),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(1),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(65),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(47),r(47),n(),n(),r(47),n(),n(),r(47),n(),r(47),s(67),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(49),r(49),n(),n(),r(49),n(),n(),r(49),n(),r(49),r(49),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(68),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(51),r(51),n(),n(),r(51),n(),n(),r(51),n(),r(51),r(51),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(51),s(69),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(53),r(53),n(),n(),r(53),n(),n(),r(53),n(),r(53),r(53),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(53),r(53),s(70),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(55),r(55),n(),n(),r(55),n(),n(),r(55),n(),r(55),r(55),n(),n(),n(),n(),s(71),s(72),n(),n(),n(),n(),n(),n(),n(),n(),r(55),r(55),r(55),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(58),r(58),n(),n(),r(58),n(),n(),r(58),n(),r(58),r(58),s(76),s(75),s(74),s(73),r(58),r(58),n(),n(),n(),n(),n(),n(),n(),n(),r(58),r(58),r(58),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(63),r(63),n(),n(),r(63),n(),n(),r(63),n(),r(63),r(63),r(63),r(63),r(63),r(63),r(63),r(63),n(),n(),n(),n(),n(),s(77),s(78),n(),r(63),r(63),r(63),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(66),r(66),n(),n(),r(66),n(),n(),r(66),n(),r(66),r(66),r(66),r(66),r(66),r(66),r(66),r(66),s(79),s(80),n(),n(),n(),r(66),r(66),n(),r(66),r(66),r(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(69),r(69),n(),n(),r(69),n(),n(),r(69),n(),r(69),r(69),r(69),r(69),r(69),r(69),r(69),r(69),r(69),r(69),s(81),s(82),s(83),r(69),r(69),n(),r(69),r(69),r(69),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(73),r(73),n(),n(),r(73),n(),n(),r(73),n(),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),r(73),n(),r(73),r(73),r(73),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(84),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(85),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(86),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(87),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(88),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(89),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(90),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(91),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(82),r(82),n(),n(),r(82),n(),n(),r(82),n(),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),r(82),n(),r(82),r(82),r(82),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(84),r(84),n(),n(),r(84),n(),n(),r(84),n(),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),r(84),s(92),r(84),r(84),r(84),n(),n(),n(),s(93),s(94),s(95),s(96),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(89),r(89),n(),n(),r(89),n(),n(),r(89),n(),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),r(89),n(),n(),n(),r(89),r(89),r(89),r(89),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(97),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(98),r(91),r(91),n(),n(),r(91),n(),n(),r(91),n(),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),r(91),n(),n(),n(),r(91),r(91),r(91),r(91),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(92),r(92),n(),n(),r(92),n(),n(),r(92),n(),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),r(92),n(),n(),n(),r(92),r(92),r(92),r(92),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(93),r(93),n(),n(),r(93),n(),n(),r(93),n(),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),r(93),n(),n(),n(),r(93),r(93),r(93),r(93),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(94),r(94),n(),n(),r(94),n(),n(),r(94),n(),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),r(94),n(),n(),n(),r(94),r(94),r(94),r(94),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(95),r(95),n(),n(),r(95),n(),n(),r(95),n(),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),r(95),n(),n(),n(),r(95),r(95),r(95),r(95),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(96),r(96),n(),n(),r(96),n(),n(),r(96),n(),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),r(96),n(),n(),n(),r(96),r(96),r(96),r(96),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(99),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(12),s(13),s(14),s(101),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(100),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(12),s(13),s(14),s(101),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),g(102),g(103),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(43),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(43),n(),n(),r(43),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(12),s(13),s(14),s(101),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(10),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),g(104),g(105),n(),g(106),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(107),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(45),n(),n(),r(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {s(11),n(),n(),s(12),s(13),s(14),s(9),n(),n(),n(),n(),n(),n(),s(10),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(108),g(6),g(7),g(8),n(),n(),n(),n(),g(4),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(5),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(109),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(110),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(111),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(112),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(113),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(114),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(115),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(116),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(117),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(118),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(119),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(120),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(121),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(122),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(123),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(124),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(125),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(126),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(74),r(74),n(),n(),r(74),n(),n(),r(74),n(),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),r(74),n(),r(74),r(74),r(74),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(75),r(75),n(),n(),r(75),n(),n(),r(75),n(),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),r(75),n(),r(75),r(75),r(75),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(76),r(76),n(),n(),r(76),n(),n(),r(76),n(),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),r(76),n(),r(76),r(76),r(76),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(77),r(77),n(),n(),r(77),n(),n(),r(77),n(),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),r(77),n(),r(77),r(77),r(77),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(78),r(78),n(),n(),r(78),n(),n(),r(78),n(),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),r(78),n(),r(78),r(78),r(78),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(79),r(79),n(),n(),r(79),n(),n(),r(79),n(),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),r(79),n(),r(79),r(79),r(79),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(80),r(80),n(),n(),r(80),n(),n(),r(80),n(),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),r(80),n(),r(80),r(80),r(80),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(81),r(81),n(),n(),r(81),n(),n(),r(81),n(),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),r(81),n(),r(81),r(81),r(81),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(127),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(85),r(85),n(),n(),r(85),n(),n(),r(85),n(),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),r(85),n(),n(),n(),r(85),r(85),r(85),r(85),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(86),r(86),n(),n(),r(86),n(),n(),r(86),n(),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),r(86),n(),n(),n(),r(86),r(86),r(86),r(86),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(128),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(129),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(130),n(),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),s(132),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(133),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),g(131),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(134),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(135),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(136),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(137),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(138),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(139),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(11),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(12),n(),n(),n(),s(140),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(141),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(2),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(46),r(46),n(),n(),r(46),n(),n(),r(46),n(),r(46),s(67),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(48),r(48),n(),n(),r(48),n(),n(),r(48),n(),r(48),r(48),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(68),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(50),r(50),n(),n(),r(50),n(),n(),r(50),n(),r(50),r(50),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(50),s(69),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(52),r(52),n(),n(),r(52),n(),n(),r(52),n(),r(52),r(52),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(52),r(52),s(70),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(54),r(54),n(),n(),r(54),n(),n(),r(54),n(),r(54),r(54),n(),n(),n(),n(),s(71),s(72),n(),n(),n(),n(),n(),n(),n(),n(),r(54),r(54),r(54),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(56),r(56),n(),n(),r(56),n(),n(),r(56),n(),r(56),r(56),s(76),s(75),s(74),s(73),r(56),r(56),n(),n(),n(),n(),n(),n(),n(),n(),r(56),r(56),r(56),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(57),r(57),n(),n(),r(57),n(),n(),r(57),n(),r(57),r(57),s(76),s(75),s(74),s(73),r(57),r(57),n(),n(),n(),n(),n(),n(),n(),n(),r(57),r(57),r(57),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(59),r(59),n(),n(),r(59),n(),n(),r(59),n(),r(59),r(59),r(59),r(59),r(59),r(59),r(59),r(59),n(),n(),n(),n(),n(),s(77),s(78),n(),r(59),r(59),r(59),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(60),r(60),n(),n(),r(60),n(),n(),r(60),n(),r(60),r(60),r(60),r(60),r(60),r(60),r(60),r(60),n(),n(),n(),n(),n(),s(77),s(78),n(),r(60),r(60),r(60),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(61),r(61),n(),n(),r(61),n(),n(),r(61),n(),r(61),r(61),r(61),r(61),r(61),r(61),r(61),r(61),n(),n(),n(),n(),n(),s(77),s(78),n(),r(61),r(61),r(61),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(62),r(62),n(),n(),r(62),n(),n(),r(62),n(),r(62),r(62),r(62),r(62),r(62),r(62),r(62),r(62),n(),n(),n(),n(),n(),s(77),s(78),n(),r(62),r(62),r(62),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(64),r(64),n(),n(),r(64),n(),n(),r(64),n(),r(64),r(64),r(64),r(64),r(64),r(64),r(64),r(64),s(79),s(80),n(),n(),n(),r(64),r(64),n(),r(64),r(64),r(64),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(65),r(65),n(),n(),r(65),n(),n(),r(65),n(),r(65),r(65),r(65),r(65),r(65),r(65),r(65),r(65),s(79),s(80),n(),n(),n(),r(65),r(65),n(),r(65),r(65),r(65),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(67),r(67),n(),n(),r(67),n(),n(),r(67),n(),r(67),r(67),r(67),r(67),r(67),r(67),r(67),r(67),r(67),r(67),s(81),s(82),s(83),r(67),r(67),n(),r(67),r(67),r(67),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(68),r(68),n(),n(),r(68),n(),n(),r(68),n(),r(68),r(68),r(68),r(68),r(68),r(68),r(68),r(68),r(68),r(68),s(81),s(82),s(83),r(68),r(68),n(),r(68),r(68),r(68),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(70),r(70),n(),n(),r(70),n(),n(),r(70),n(),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),r(70),n(),r(70),r(70),r(70),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(71),r(71),n(),n(),r(71),n(),n(),r(71),n(),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),r(71),n(),r(71),r(71),r(71),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(72),r(72),n(),n(),r(72),n(),n(),r(72),n(),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),r(72),n(),r(72),r(72),r(72),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(83),r(83),n(),n(),r(83),n(),n(),r(83),n(),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),r(83),n(),r(83),r(83),r(83),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(87),r(87),n(),n(),r(87),n(),n(),r(87),n(),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),r(87),n(),n(),n(),r(87),r(87),r(87),r(87),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(88),r(88),n(),n(),r(88),n(),n(),r(88),n(),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),r(88),n(),n(),n(),r(88),r(88),r(88),r(88),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(90),r(90),n(),n(),r(90),n(),n(),r(90),n(),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),r(90),n(),n(),n(),r(90),r(90),r(90),r(90),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(142),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(99),r(99),n(),n(),r(99),n(),n(),r(99),n(),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),r(99),n(),n(),n(),r(99),r(99),r(99),r(99),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(38),n(),n(),n(),s(143),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(97),r(97),n(),n(),r(97),n(),n(),r(97),n(),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),r(97),n(),n(),n(),r(97),r(97),r(97),r(97),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(144),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(44),n(),n(),r(44),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(61),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(145),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(12),s(13),s(14),s(101),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(14),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),g(146),g(103),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(147),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(12),s(13),s(14),s(101),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),g(148),n(),g(106),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(149),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(98),r(98),n(),n(),r(98),n(),n(),r(98),n(),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),r(98),n(),n(),n(),r(98),r(98),r(98),r(98),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(133),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),g(150),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(151),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {r(9),n(),n(),r(9),r(9),r(9),r(9),n(),n(),n(),n(),n(),n(),r(9),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(15),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),s(12),s(13),s(14),s(101),s(153),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(152),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(13),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(154),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(39),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(100),r(100),n(),n(),r(100),n(),n(),r(100),n(),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),r(100),n(),n(),n(),r(100),r(100),r(100),r(100),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(155),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(156),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(157),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(158),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(159),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(160),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(171),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(172),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(8),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(17),r(17),r(17),r(17),r(17),r(17),n(),r(17),r(17),r(17),r(17),r(17),r(17),r(17),r(17),n(),n(),r(17),r(17),r(17),r(17),r(17),n(),r(17),n(),n(),n(),r(17),n(),n(),n(),n(),r(17),n(),n(),n(),n(),n(),n(),n(),n(),r(17),r(17),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(17),r(17),r(17),r(17),r(17),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(173),n(),n(),n(),n(),n(),s(174),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(176),n(),n(),n(),n(),n(),s(175),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(177),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(178),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(179),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(180),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(181),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(182),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),s(184),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(183),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {r(6),n(),n(),r(6),r(6),r(6),r(6),n(),n(),n(),n(),n(),n(),r(6),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {r(7),n(),n(),r(7),r(7),r(7),r(7),n(),n(),n(),n(),n(),n(),r(7),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(19),r(19),r(19),r(19),r(19),r(19),n(),r(19),r(19),r(19),r(19),r(19),r(19),r(19),r(19),n(),n(),r(19),r(19),r(19),r(19),r(19),n(),r(19),n(),n(),n(),r(19),n(),n(),n(),n(),r(19),n(),n(),n(),n(),n(),n(),n(),n(),r(19),r(19),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(19),r(19),r(19),r(19),r(19),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(185),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(186),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),r(26),r(26),r(26),r(26),r(26),r(26),n(),r(26),r(26),r(26),r(26),r(26),r(26),r(26),r(26),n(),n(),r(26),r(26),r(26),r(26),r(26),n(),r(26),n(),n(),n(),r(26),n(),n(),n(),n(),r(26),n(),n(),n(),n(),n(),n(),n(),n(),r(26),r(26),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(26),r(26),r(26),r(26),r(26),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(187),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(188),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(190),n(),n(),n(),g(189),n(),g(191),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),r(25),r(25),r(25),r(25),r(25),r(25),n(),r(25),r(25),r(25),r(25),r(25),r(25),r(25),r(25),n(),n(),r(25),r(25),r(25),r(25),r(25),n(),r(25),n(),n(),n(),r(25),n(),n(),n(),n(),r(25),n(),n(),n(),n(),n(),n(),n(),n(),r(25),r(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(25),r(25),r(25),r(25),r(25),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(192),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(133),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),g(193),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(194),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(30),r(30),r(30),r(30),r(30),r(30),n(),r(30),r(30),r(30),r(30),r(30),r(30),r(30),r(30),n(),n(),r(30),r(30),r(30),r(30),r(30),n(),r(30),n(),n(),n(),r(30),n(),n(),n(),n(),r(30),n(),n(),n(),n(),n(),n(),n(),n(),r(30),r(30),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(30),r(30),r(30),r(30),r(30),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(195),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(196),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(197),n(),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(198),n(),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(199),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(200),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(201),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(27),r(27),r(27),r(27),r(27),r(27),n(),r(27),r(27),r(27),r(27),r(27),r(27),r(27),r(27),n(),n(),r(27),r(27),r(27),r(27),r(27),n(),r(27),n(),n(),n(),r(27),n(),n(),n(),n(),r(27),n(),n(),n(),n(),n(),n(),n(),n(),r(27),r(27),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(27),r(27),r(27),r(27),r(27),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(202),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(29),r(29),r(29),r(29),r(29),r(29),n(),r(29),r(29),r(29),r(29),r(29),r(29),r(29),r(29),n(),n(),r(29),r(29),r(29),r(29),r(29),n(),r(29),n(),n(),n(),r(29),n(),n(),n(),n(),r(29),n(),n(),n(),n(),n(),n(),n(),n(),r(29),r(29),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(29),r(29),r(29),r(29),r(29),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(20),r(20),r(20),r(20),r(20),r(20),n(),r(20),r(20),r(20),r(20),r(20),r(20),r(20),r(20),n(),n(),r(20),r(20),r(20),r(20),r(20),n(),r(20),n(),n(),n(),r(20),n(),n(),n(),n(),r(20),n(),n(),n(),n(),n(),n(),n(),n(),r(20),r(20),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(20),r(20),r(20),r(20),r(20),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(21),r(21),r(21),r(21),r(21),r(21),n(),r(21),r(21),r(21),r(21),r(21),r(21),r(21),r(21),n(),n(),r(21),r(21),r(21),r(21),r(21),n(),r(21),n(),n(),n(),r(21),n(),n(),n(),n(),r(21),n(),n(),n(),n(),n(),n(),n(),n(),r(21),r(21),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(21),r(21),r(21),r(21),r(21),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(203),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(204),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(205),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(206),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(207),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(208),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(209),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(210),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(211),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(34),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(35),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(28),r(28),r(28),r(28),r(28),r(28),n(),r(28),r(28),r(28),r(28),r(28),r(28),r(28),r(28),n(),n(),r(28),r(28),r(28),r(28),r(28),n(),r(28),n(),n(),n(),r(28),n(),n(),n(),n(),r(28),n(),n(),n(),n(),n(),n(),n(),n(),r(28),r(28),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(28),r(28),r(28),r(28),r(28),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(212),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(213),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(214),g(215),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),r(31),r(31),r(31),r(31),r(31),r(31),n(),r(31),r(31),r(31),r(31),r(31),r(31),r(31),r(31),s(217),s(218),r(31),r(31),r(31),r(31),r(31),n(),r(31),n(),n(),n(),r(31),n(),n(),n(),n(),r(31),n(),n(),n(),n(),n(),n(),n(),n(),r(31),r(31),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(31),r(31),r(31),r(31),r(31),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(216),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(23),r(23),r(23),r(23),r(23),r(23),n(),r(23),r(23),r(23),r(23),r(23),r(23),r(23),r(23),n(),n(),r(23),r(23),r(23),r(23),r(23),n(),r(23),n(),n(),n(),r(23),n(),n(),n(),n(),r(23),n(),n(),n(),n(),n(),n(),n(),n(),r(23),r(23),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(23),r(23),r(23),r(23),r(23),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(219),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(37),n(),n(),n(),n(),n(),n(),s(220),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(22),r(22),r(22),r(22),r(22),r(22),n(),r(22),r(22),r(22),r(22),r(22),r(22),r(22),r(22),n(),n(),r(22),r(22),r(22),r(22),r(22),n(),r(22),n(),n(),n(),r(22),n(),n(),n(),n(),r(22),n(),n(),n(),n(),n(),n(),n(),n(),r(22),r(22),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(22),r(22),r(22),r(22),r(22),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(221),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(222),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(223),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(224),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),n(),n(),n(),n(),n(),n(),s(53),s(54),s(55),s(56),s(57),s(52),n(),n(),n(),n(),n(),n(),n(),n(),s(59),n(),s(51),n(),n(),n(),n(),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(225),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(226),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(227),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(36),n(),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(228),n(),n(),n(),n(),n(),n(),n(),n(),s(66),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(229),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(230),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(231),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(33),r(33),r(33),r(33),r(33),r(33),n(),r(33),r(33),r(33),r(33),r(33),r(33),r(33),r(33),n(),n(),r(33),r(33),r(33),r(33),r(33),n(),r(33),n(),n(),n(),r(33),n(),n(),n(),n(),r(33),n(),n(),n(),n(),n(),n(),n(),n(),r(33),r(33),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(33),r(33),r(33),r(33),r(33),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(24),r(24),r(24),r(24),r(24),r(24),n(),r(24),r(24),r(24),r(24),r(24),r(24),r(24),r(24),n(),n(),r(24),r(24),r(24),r(24),r(24),n(),r(24),n(),n(),n(),r(24),n(),n(),n(),n(),r(24),n(),n(),n(),n(),n(),n(),n(),n(),r(24),r(24),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(24),r(24),r(24),r(24),r(24),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(18),r(18),r(18),r(18),r(18),r(18),n(),r(18),r(18),r(18),r(18),r(18),r(18),r(18),r(18),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),r(18),n(),n(),n(),r(18),n(),n(),n(),n(),r(18),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(18),r(18),r(18),r(18),r(18),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(232),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),s(58),s(169),s(12),s(13),s(14),s(101),n(),s(53),s(54),s(55),s(56),s(57),s(52),s(170),s(164),n(),n(),s(166),s(165),s(167),s(168),s(59),n(),s(51),n(),n(),n(),s(233),n(),n(),n(),n(),s(42),n(),n(),n(),n(),n(),n(),n(),n(),s(47),s(46),n(),n(),n(),n(),n(),n(),n(),n(),n(),s(43),s(40),s(41),s(44),s(45),n(),n(),n(),n(),n(),n(),n(),n(),g(8),n(),n(),n(),n(),g(162),n(),g(161),n(),n(),n(),g(163),g(30),g(31),g(32),g(33),g(34),g(35),g(36),g(37),g(38),g(39),g(48),g(49),g(50),n(),n(),n()},
-    {n(),r(31),r(31),r(31),r(31),r(31),r(31),n(),r(31),r(31),r(31),r(31),r(31),r(31),r(31),r(31),s(217),s(218),r(31),r(31),r(31),r(31),r(31),n(),r(31),n(),n(),n(),r(31),n(),n(),n(),n(),r(31),n(),n(),n(),n(),n(),n(),n(),n(),r(31),r(31),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(31),r(31),r(31),r(31),r(31),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),g(234),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-    {n(),r(32),r(32),r(32),r(32),r(32),r(32),n(),r(32),r(32),r(32),r(32),r(32),r(32),r(32),r(32),n(),n(),r(32),r(32),r(32),r(32),r(32),n(),r(32),n(),n(),n(),r(32),n(),n(),n(),n(),r(32),n(),n(),n(),n(),n(),n(),n(),n(),r(32),r(32),n(),n(),n(),n(),n(),n(),n(),n(),n(),r(32),r(32),r(32),r(32),r(32),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n(),n()},
-}};
-
-#define start_BoFproceduresEoF 0
-#define procedures_dclSEMIprocedures 1
-#define procedures_dclBECOMESexpr1SEMIprocedures 2
-#define procedures_structdefprocedures 3
-#define procedures_procedureprocedures 4
-#define procedures_main 5
-#define procedure_IDCOLONLPARENparamsRPARENARROWtypeLCURLYstatementsRCURLY 6
-#define procedure_IDCOLONLPARENparamsRPARENARROWVOIDLCURLYstatementsRCURLY 7
-#define main_MAINCOLONLPARENRPARENARROWINTLCURLYstatementsRCURLY 8
-#define structdef_STRUCTIDLCURLYdclsRCURLYSEMI 9
-#define params_ 10
-#define params_paramlist 11
-#define paramlist_dcl 12
-#define paramlist_dclCOMMAparamlist 13
-#define dcls_dclSEMI 14
-#define dcls_dclSEMIdcls 15
-#define dcl_typeID 16
-#define statements_statementsstatement 17
-#define statements_ 18
-#define statement_dclSEMI 19
-#define statement_dclBECOMESexpr1SEMI 20
-#define statement_expr1BECOMESexpr1SEMI 21
-#define statement_IFLPARENexpr1RPARENLCURLYstatementsRCURLYifs 22
-#define statement_WHILELPARENexpr1RPARENLCURLYstatementsRCURLY 23
-#define statement_FORLPARENforprologueSEMIexpr1SEMIforepilogueRPARENLCURLYstatementsRCURLY 24
-#define statement_BREAKSEMI 25
-#define statement_expr1SEMI 26
-#define statement_DELETEexpr1SEMI 27
-#define statement_PRINTLPARENargsRPARENSEMI 28
-#define statement_RETURNexpr1SEMI 29
-#define statement_RETURNSEMI 30
-#define ifs_ 31
-#define ifs_ELIFLPARENexpr1RPARENLCURLYstatementsRCURLYifs 32
-#define ifs_ELSELCURLYstatementsRCURLY 33
-#define forprologue_dclBECOMESexpr1 34
-#define forprologue_expr1BECOMESexpr1 35
-#define forepilogue_expr1BECOMESexpr1 36
-#define forepilogue_expr1 37
-#define args_expr1 38
-#define args_expr1COMMAargs 39
-#define type_INTstar 40
-#define type_CHARstar 41
-#define type_BOOLstar 42
-#define type_STRUCTIDstar 43
-#define star_ 44
-#define star_ATstar 45
-#define expr1_expr1ORexpr2 46
-#define expr1_expr2 47
-#define expr2_expr2ANDexpr3 48
-#define expr2_expr3 49
-#define expr3_expr3BITORexpr4 50
-#define expr3_expr4 51
-#define expr4_expr4BITXORexpr5 52
-#define expr4_expr5 53
-#define expr5_expr5BITANDexpr6 54
-#define expr5_expr6 55
-#define expr6_expr6EQUALSexpr7 56
-#define expr6_expr6NEQexpr7 57
-#define expr6_expr7 58
-#define expr7_expr7LTexpr8 59
-#define expr7_expr7LEQexpr8 60
-#define expr7_expr7GTexpr8 61
-#define expr7_expr7GEQexpr8 62
-#define expr7_expr8 63
-#define expr8_expr8LSHIFTexpr9 64
-#define expr8_expr8RSHIFTexpr9 65
-#define expr8_expr9 66
-#define expr9_expr9PLUSexpr10 67
-#define expr9_expr9SUBexpr10 68
-#define expr9_expr10 69
-#define expr10_expr10MULTexpr11 70
-#define expr10_expr10DIVexpr11 71
-#define expr10_expr10MODexpr11 72
-#define expr10_expr11 73
-#define expr11_ATexpr11 74
-#define expr11_ADDRexpr11 75
-#define expr11_NOTexpr11 76
-#define expr11_BITNOTexpr11 77
-#define expr11_INCRexpr11 78
-#define expr11_DECRexpr11 79
-#define expr11_SUBexpr11 80
-#define expr11_PLUSexpr11 81
-#define expr11_expr12 82
-#define expr12_expr13EXPexpr12 83
-#define expr12_expr13 84
-#define expr13_expr13INCR 85
-#define expr13_expr13DECR 86
-#define expr13_expr13ARROWID 87
-#define expr13_expr13DOTID 88
-#define expr13_expr14 89
-#define expr14_LPARENexpr1RPAREN 90
-#define expr14_ID 91
-#define expr14_TRUE 92
-#define expr14_FALSE 93
-#define expr14_NIL 94
-#define expr14_NUM 95
-#define expr14_CHARLIT 96
-#define expr14_READLPARENRPAREN 97
-#define expr14_IDLPARENargsRPAREN 98
-#define expr14_IDLPARENRPAREN 99
-#define expr14_NEWtypeLBRACKNUMRBRACK 100
-
-inline constexpr std::array<const Production, NUM_PRODUCTIONS> PRODUCTIONS{{
-    {ParserSymbol::start, 3, {ParserSymbol::BoF,ParserSymbol::procedures,ParserSymbol::EoF,}},
-    {ParserSymbol::procedures, 3, {ParserSymbol::dcl,ParserSymbol::SEMI,ParserSymbol::procedures,}},
-    {ParserSymbol::procedures, 5, {ParserSymbol::dcl,ParserSymbol::BECOMES,ParserSymbol::expr1,ParserSymbol::SEMI,ParserSymbol::procedures,}},
-    {ParserSymbol::procedures, 2, {ParserSymbol::structdef,ParserSymbol::procedures,}},
-    {ParserSymbol::procedures, 2, {ParserSymbol::procedure,ParserSymbol::procedures,}},
-    {ParserSymbol::procedures, 1, {ParserSymbol::main,}},
-    {ParserSymbol::procedure, 10, {ParserSymbol::ID,ParserSymbol::COLON,ParserSymbol::LPAREN,ParserSymbol::params,ParserSymbol::RPAREN,ParserSymbol::ARROW,ParserSymbol::type,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,}},
-    {ParserSymbol::procedure, 10, {ParserSymbol::ID,ParserSymbol::COLON,ParserSymbol::LPAREN,ParserSymbol::params,ParserSymbol::RPAREN,ParserSymbol::ARROW,ParserSymbol::VOID,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,}},
-    {ParserSymbol::main, 9, {ParserSymbol::MAIN,ParserSymbol::COLON,ParserSymbol::LPAREN,ParserSymbol::RPAREN,ParserSymbol::ARROW,ParserSymbol::INT,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,}},
-    {ParserSymbol::structdef, 6, {ParserSymbol::STRUCT,ParserSymbol::ID,ParserSymbol::LCURLY,ParserSymbol::dcls,ParserSymbol::RCURLY,ParserSymbol::SEMI,}},
-    {ParserSymbol::params, 0, {}},
-    {ParserSymbol::params, 1, {ParserSymbol::paramlist,}},
-    {ParserSymbol::paramlist, 1, {ParserSymbol::dcl,}},
-    {ParserSymbol::paramlist, 3, {ParserSymbol::dcl,ParserSymbol::COMMA,ParserSymbol::paramlist,}},
-    {ParserSymbol::dcls, 2, {ParserSymbol::dcl,ParserSymbol::SEMI,}},
-    {ParserSymbol::dcls, 3, {ParserSymbol::dcl,ParserSymbol::SEMI,ParserSymbol::dcls,}},
-    {ParserSymbol::dcl, 2, {ParserSymbol::type,ParserSymbol::ID,}},
-    {ParserSymbol::statements, 2, {ParserSymbol::statements,ParserSymbol::statement,}},
-    {ParserSymbol::statements, 0, {}},
-    {ParserSymbol::statement, 2, {ParserSymbol::dcl,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 4, {ParserSymbol::dcl,ParserSymbol::BECOMES,ParserSymbol::expr1,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 4, {ParserSymbol::expr1,ParserSymbol::BECOMES,ParserSymbol::expr1,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 8, {ParserSymbol::IF,ParserSymbol::LPAREN,ParserSymbol::expr1,ParserSymbol::RPAREN,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,ParserSymbol::ifs,}},
-    {ParserSymbol::statement, 7, {ParserSymbol::WHILE,ParserSymbol::LPAREN,ParserSymbol::expr1,ParserSymbol::RPAREN,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,}},
-    {ParserSymbol::statement, 11, {ParserSymbol::FOR,ParserSymbol::LPAREN,ParserSymbol::forprologue,ParserSymbol::SEMI,ParserSymbol::expr1,ParserSymbol::SEMI,ParserSymbol::forepilogue,ParserSymbol::RPAREN,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,}},
-    {ParserSymbol::statement, 2, {ParserSymbol::BREAK,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 2, {ParserSymbol::expr1,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 3, {ParserSymbol::DELETE,ParserSymbol::expr1,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 5, {ParserSymbol::PRINT,ParserSymbol::LPAREN,ParserSymbol::args,ParserSymbol::RPAREN,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 3, {ParserSymbol::RETURN,ParserSymbol::expr1,ParserSymbol::SEMI,}},
-    {ParserSymbol::statement, 2, {ParserSymbol::RETURN,ParserSymbol::SEMI,}},
-    {ParserSymbol::ifs, 0, {}},
-    {ParserSymbol::ifs, 8, {ParserSymbol::ELIF,ParserSymbol::LPAREN,ParserSymbol::expr1,ParserSymbol::RPAREN,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,ParserSymbol::ifs,}},
-    {ParserSymbol::ifs, 4, {ParserSymbol::ELSE,ParserSymbol::LCURLY,ParserSymbol::statements,ParserSymbol::RCURLY,}},
-    {ParserSymbol::forprologue, 3, {ParserSymbol::dcl,ParserSymbol::BECOMES,ParserSymbol::expr1,}},
-    {ParserSymbol::forprologue, 3, {ParserSymbol::expr1,ParserSymbol::BECOMES,ParserSymbol::expr1,}},
-    {ParserSymbol::forepilogue, 3, {ParserSymbol::expr1,ParserSymbol::BECOMES,ParserSymbol::expr1,}},
-    {ParserSymbol::forepilogue, 1, {ParserSymbol::expr1,}},
-    {ParserSymbol::args, 1, {ParserSymbol::expr1,}},
-    {ParserSymbol::args, 3, {ParserSymbol::expr1,ParserSymbol::COMMA,ParserSymbol::args,}},
-    {ParserSymbol::type, 2, {ParserSymbol::INT,ParserSymbol::star,}},
-    {ParserSymbol::type, 2, {ParserSymbol::CHAR,ParserSymbol::star,}},
-    {ParserSymbol::type, 2, {ParserSymbol::BOOL,ParserSymbol::star,}},
-    {ParserSymbol::type, 3, {ParserSymbol::STRUCT,ParserSymbol::ID,ParserSymbol::star,}},
-    {ParserSymbol::star, 0, {}},
-    {ParserSymbol::star, 2, {ParserSymbol::AT,ParserSymbol::star,}},
-    {ParserSymbol::expr1, 3, {ParserSymbol::expr1,ParserSymbol::OR,ParserSymbol::expr2,}},
-    {ParserSymbol::expr1, 1, {ParserSymbol::expr2,}},
-    {ParserSymbol::expr2, 3, {ParserSymbol::expr2,ParserSymbol::AND,ParserSymbol::expr3,}},
-    {ParserSymbol::expr2, 1, {ParserSymbol::expr3,}},
-    {ParserSymbol::expr3, 3, {ParserSymbol::expr3,ParserSymbol::BITOR,ParserSymbol::expr4,}},
-    {ParserSymbol::expr3, 1, {ParserSymbol::expr4,}},
-    {ParserSymbol::expr4, 3, {ParserSymbol::expr4,ParserSymbol::BITXOR,ParserSymbol::expr5,}},
-    {ParserSymbol::expr4, 1, {ParserSymbol::expr5,}},
-    {ParserSymbol::expr5, 3, {ParserSymbol::expr5,ParserSymbol::BITAND,ParserSymbol::expr6,}},
-    {ParserSymbol::expr5, 1, {ParserSymbol::expr6,}},
-    {ParserSymbol::expr6, 3, {ParserSymbol::expr6,ParserSymbol::EQUALS,ParserSymbol::expr7,}},
-    {ParserSymbol::expr6, 3, {ParserSymbol::expr6,ParserSymbol::NEQ,ParserSymbol::expr7,}},
-    {ParserSymbol::expr6, 1, {ParserSymbol::expr7,}},
-    {ParserSymbol::expr7, 3, {ParserSymbol::expr7,ParserSymbol::LT,ParserSymbol::expr8,}},
-    {ParserSymbol::expr7, 3, {ParserSymbol::expr7,ParserSymbol::LEQ,ParserSymbol::expr8,}},
-    {ParserSymbol::expr7, 3, {ParserSymbol::expr7,ParserSymbol::GT,ParserSymbol::expr8,}},
-    {ParserSymbol::expr7, 3, {ParserSymbol::expr7,ParserSymbol::GEQ,ParserSymbol::expr8,}},
-    {ParserSymbol::expr7, 1, {ParserSymbol::expr8,}},
-    {ParserSymbol::expr8, 3, {ParserSymbol::expr8,ParserSymbol::LSHIFT,ParserSymbol::expr9,}},
-    {ParserSymbol::expr8, 3, {ParserSymbol::expr8,ParserSymbol::RSHIFT,ParserSymbol::expr9,}},
-    {ParserSymbol::expr8, 1, {ParserSymbol::expr9,}},
-    {ParserSymbol::expr9, 3, {ParserSymbol::expr9,ParserSymbol::PLUS,ParserSymbol::expr10,}},
-    {ParserSymbol::expr9, 3, {ParserSymbol::expr9,ParserSymbol::SUB,ParserSymbol::expr10,}},
-    {ParserSymbol::expr9, 1, {ParserSymbol::expr10,}},
-    {ParserSymbol::expr10, 3, {ParserSymbol::expr10,ParserSymbol::MULT,ParserSymbol::expr11,}},
-    {ParserSymbol::expr10, 3, {ParserSymbol::expr10,ParserSymbol::DIV,ParserSymbol::expr11,}},
-    {ParserSymbol::expr10, 3, {ParserSymbol::expr10,ParserSymbol::MOD,ParserSymbol::expr11,}},
-    {ParserSymbol::expr10, 1, {ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::AT,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::ADDR,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::NOT,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::BITNOT,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::INCR,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::DECR,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::SUB,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 2, {ParserSymbol::PLUS,ParserSymbol::expr11,}},
-    {ParserSymbol::expr11, 1, {ParserSymbol::expr12,}},
-    {ParserSymbol::expr12, 3, {ParserSymbol::expr13,ParserSymbol::EXP,ParserSymbol::expr12,}},
-    {ParserSymbol::expr12, 1, {ParserSymbol::expr13,}},
-    {ParserSymbol::expr13, 2, {ParserSymbol::expr13,ParserSymbol::INCR,}},
-    {ParserSymbol::expr13, 2, {ParserSymbol::expr13,ParserSymbol::DECR,}},
-    {ParserSymbol::expr13, 3, {ParserSymbol::expr13,ParserSymbol::ARROW,ParserSymbol::ID,}},
-    {ParserSymbol::expr13, 3, {ParserSymbol::expr13,ParserSymbol::DOT,ParserSymbol::ID,}},
-    {ParserSymbol::expr13, 1, {ParserSymbol::expr14,}},
-    {ParserSymbol::expr14, 3, {ParserSymbol::LPAREN,ParserSymbol::expr1,ParserSymbol::RPAREN,}},
-    {ParserSymbol::expr14, 1, {ParserSymbol::ID,}},
-    {ParserSymbol::expr14, 1, {ParserSymbol::TRUE,}},
-    {ParserSymbol::expr14, 1, {ParserSymbol::FALSE,}},
-    {ParserSymbol::expr14, 1, {ParserSymbol::NIL,}},
-    {ParserSymbol::expr14, 1, {ParserSymbol::NUM,}},
-    {ParserSymbol::expr14, 1, {ParserSymbol::CHARLIT,}},
-    {ParserSymbol::expr14, 3, {ParserSymbol::READ,ParserSymbol::LPAREN,ParserSymbol::RPAREN,}},
-    {ParserSymbol::expr14, 4, {ParserSymbol::ID,ParserSymbol::LPAREN,ParserSymbol::args,ParserSymbol::RPAREN,}},
-    {ParserSymbol::expr14, 3, {ParserSymbol::ID,ParserSymbol::LPAREN,ParserSymbol::RPAREN,}},
-    {ParserSymbol::expr14, 5, {ParserSymbol::NEW,ParserSymbol::type,ParserSymbol::LBRACK,ParserSymbol::NUM,ParserSymbol::RBRACK,}},
-}};
-
-#endif // PARSER_CONSTANTS_H
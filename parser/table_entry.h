@@ -0,0 +1,85 @@
+#ifndef XERLANG_TABLE_ENTRY_H
+#define XERLANG_TABLE_ENTRY_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "util/types.h"
+
+// One cell of the dense LALR(1) table in the generated parser_constants.h
+struct ParsingTableEntry {
+    enum class Action : uint8_t { NIL, SHIFT, REDUCE, GOTO, ACCEPT };
+
+    Action act = Action::NIL;
+    union {
+        uint16_t target_state = 0;
+        uint16_t production_id;
+    };
+};
+
+consteval ParsingTableEntry s(uint16_t n) {
+    ParsingTableEntry pte;
+    pte.act = ParsingTableEntry::Action::SHIFT;
+    pte.target_state = n;
+    return pte;
+}
+
+consteval ParsingTableEntry r(uint16_t n) {
+    ParsingTableEntry pte;
+    pte.act = ParsingTableEntry::Action::REDUCE;
+    pte.production_id = n;
+    return pte;
+}
+
+consteval ParsingTableEntry g(uint16_t n) {
+    ParsingTableEntry pte;
+    pte.act = ParsingTableEntry::Action::GOTO;
+    pte.target_state = n;
+    return pte;
+}
+
+consteval ParsingTableEntry a() {
+    ParsingTableEntry pte;
+    pte.act = ParsingTableEntry::Action::ACCEPT;
+    pte.target_state = 0;
+    return pte;
+}
+
+consteval ParsingTableEntry n() {
+    ParsingTableEntry pte;
+    pte.act = ParsingTableEntry::Action::NIL;
+    pte.target_state = 0;
+    return pte;
+}
+
+// Packed ACTION entry: 0 is error, 1..NUM_STATES is shift to state-1, REDUCE_BIT | p reduces by production p
+#define ACTION_ERROR uint16_t{0}
+#define ACTION_ACCEPT uint16_t{0xFFFF}
+#define REDUCE_BIT uint16_t{0x8000}
+#define EMPTY_ACTION_CHECK uint16_t{0xFFFF}
+#define EMPTY_GOTO_CHECK uint8_t{0xFF}
+
+constexpr uint16_t pack_action(const ParsingTableEntry& pte) {
+    switch (pte.act) {
+        case ParsingTableEntry::Action::SHIFT: return pte.target_state + 1;
+        case ParsingTableEntry::Action::REDUCE: return REDUCE_BIT | pte.production_id;
+        case ParsingTableEntry::Action::ACCEPT: return ACTION_ACCEPT;
+        default: return ACTION_ERROR;
+    }
+}
+
+// The compressed table in the generated parser_constants.h; parser/parse_table.h describes the layout
+template <size_t NumStates, size_t ActionSlots, size_t GotoSlots>
+struct CompressedParseTable {
+    std::array<uint8_t, Parser::ParserSymbol::NUM_SYMBOLS> action_column;
+    std::array<uint16_t, NumStates> default_action;
+    std::array<uint16_t, NumStates> action_base;
+    std::array<uint16_t, ActionSlots> action;
+    std::array<uint16_t, ActionSlots> action_check;
+    std::array<uint16_t, Parser::ParserSymbol::NUM_SYMBOLS> goto_default;
+    std::array<uint16_t, Parser::ParserSymbol::NUM_SYMBOLS> goto_base;
+    std::array<uint16_t, GotoSlots> goto_target;
+    std::array<uint8_t, GotoSlots> goto_check;
+};
+
+#endif //XERLANG_TABLE_ENTRY_H
@@ -1 +1,492 @@
-#include "scanner.h"#include <array>#include <iostream>#include <sstream>#include <unordered_map>#include <limits>#define MAX_ERROR_LEN 5using namespace Scanner;inline bool is_accepting_state(Scanner::ScannerDFAState state) {    return state != START && state != APOS && state != APOSLASH && state != NOT_CHARLIT;}std::ostream& operator<<(std::ostream& os, Scanner::ScannerDFAState state) {    switch (state) {        case MAIN: os << "MAIN"; break;        case READ: os << "READ"; break;        case PRINT: os << "PRINT"; break;        case INT: os << "INT"; break;        case CHAR: os << "CHAR"; break;        case BOOL: os << "BOOL"; break;        case VOID: os << "VOID"; break;        case TRUE: os << "TRUE"; break;        case FALSE: os << "FALSE"; break;        case NIL: os << "NIL"; break;        case NUM: os << "NUM"; break;        case CHARLIT: os << "CHARLIT"; break;        case ID: os << "ID"; break;        case RETURN: os << "RETURN"; break;        case IF: os << "IF"; break;        case ELIF: os << "ELIF"; break;        case ELSE: os << "ELSE"; break;        case FOR: os << "FOR"; break;        case WHILE: os << "WHILE"; break;        case BREAK: os << "BREAK"; break;        case DELETE: os << "DELETE"; break;        case NEW: os << "NEW"; break;        case COLON: os << "COLON"; break;        case LPAREN: os << "LPAREN"; break;        case RPAREN: os << "RPAREN"; break;        case SEMI: os << "SEMI"; break;        case LCURLY: os << "LCURLY"; break;        case RCURLY: os << "RCURLY"; break;        case COMMA: os << "COMMA"; break;        case LBRACK: os << "LBRACK"; break;        case RBRACK: os << "RBRACK"; break;        case BECOMES: os << "BECOMES"; break;        case NOT: os << "NOT"; break;        case OR: os << "OR"; break;        case AND: os << "AND"; break;        case GEQ: os << "GEQ"; break;        case GT: os << "GT"; break;        case LEQ: os << "LEQ"; break;        case LT: os << "LT"; break;        case EQUALS: os << "EQUALS"; break;        case NEQ: os << "NEQ"; break;        case PLUS: os << "PLUS"; break;        case SUB: os << "SUB"; break;        case MULT: os << "MULT"; break;        case AT: os << "AT"; break;        case ADDR: os << "ADDR"; break;        case DIV: os << "DIV"; break;        case MOD: os << "MOD"; break;        case LSHIFT: os << "LSHIFT"; break;        case RSHIFT: os << "RSHIFT"; break;        case EXP: os << "EXP"; break;        case BITOR: os << "BITOR"; break;        case BITXOR: os << "BITXOR"; break;        case BITAND: os << "BITAND"; break;        case BITNOT: os << "BITNOT"; break;        case INCR: os << "INCR"; break;        case DECR: os << "DECR"; break;        case ARROW: os << "ARROW"; break;        case DOT: os << "DOT"; break;        case STRUCT: os << "STRUCT"; break;        case START: os << "START"; break;        case APOS: os << "APOS"; break;        case NOT_CHARLIT: os << "NOT_CHARLIT"; break;        default: os << "NONE"; break;    }    return os;}using Transitions = std::array<std::array<ScannerDFAState, 128>, NUM_STATES>;consteval Transitions buildTransitions() {    Transitions t{};    for (auto& row : t) row.fill(ERROR);    char c;    for (c = 'a'; c <= 'z'; c++) {        t[START][c] = ID;        t[ID][c] = ID;    }    for (c = 'A'; c <= 'Z'; c++) {        t[START][c] = ID;        t[ID][c] = ID;    }    t[START]['_'] = t[ID]['_'] = ID;    for (c = '0'; c <= '9'; c++) {        t[START][c] = NUM;        t[ID][c] = ID;        t[NUM][c] = NUM;    }    t[START][':'] = COLON;    t[START]['('] = LPAREN;    t[START][')'] = RPAREN;    t[START][';'] = SEMI;    t[START]['{'] = LCURLY;    t[START]['}'] = RCURLY;    t[START][','] = COMMA;    t[START]['['] = LBRACK;    t[START][']'] = RBRACK;    t[START]['='] = BECOMES;    t[BECOMES]['='] = EQUALS;    t[START]['!'] = NOT;    t[NOT]['='] = NEQ;    t[START]['~'] = BITNOT;    t[START]['|'] = BITOR;    t[BITOR]['|'] = OR;    t[START]['&'] = BITAND;    t[BITAND]['&'] = AND;    t[START]['>'] = GT;    t[GT]['='] = GEQ;    t[GT]['>'] = RSHIFT;    t[START]['<'] = LT;    t[LT]['='] = LEQ;    t[LT]['<'] = LSHIFT;    t[START]['+'] = PLUS;    t[PLUS]['+'] = INCR;    t[START]['*'] = MULT;    t[START]['@'] = AT;    t[START]['$'] = ADDR;    t[START]['/'] = DIV;    t[START]['%'] = MOD;    t[START]['^'] = BITXOR;    t[BITXOR]['^'] = EXP;    t[START]['.'] = DOT;    t[START]['-'] = SUB;    t[SUB]['-'] = DECR;    t[SUB]['>'] = ARROW;    t[NOT_CHARLIT]['\''] = CHARLIT;    t[START]['\''] = APOS;    for (c = ' '; c <= '~'; c++) t[APOS][c] = NOT_CHARLIT;    t[APOSLASH]['\\'] = NOT_CHARLIT;    t[APOSLASH]['\"'] = NOT_CHARLIT;    t[APOSLASH]['\''] = NOT_CHARLIT;    t[APOSLASH]['\?'] = NOT_CHARLIT;    t[APOS]['\\'] = APOSLASH;    t[APOS]['\"'] = ERROR;    t[APOS]['\''] = ERROR;    t[APOS]['\?'] = ERROR;    t[APOSLASH]['n'] = NOT_CHARLIT;    t[APOSLASH]['t'] = NOT_CHARLIT;    t[APOSLASH]['r'] = NOT_CHARLIT;    t[APOSLASH]['b'] = NOT_CHARLIT;    t[APOSLASH]['a'] = NOT_CHARLIT;    t[APOSLASH]['0'] = NOT_CHARLIT;    t[APOSLASH]['f'] = NOT_CHARLIT;    t[APOSLASH]['v'] = NOT_CHARLIT;    return t;}constexpr Transitions transitions = buildTransitions();const std::unordered_map<std::string_view, ScannerDFAState> KEYWORDS = {    {"main", MAIN}, {"read", READ}, {"print", PRINT}, {"int", INT}, {"char", CHAR}, {"bool", BOOL}, {"struct", STRUCT}, {"void", VOID},    {"true", TRUE}, {"false", FALSE}, {"NULL", NIL},    {"return", RETURN}, {"if", IF}, {"elif", ELIF}, {"else", ELSE}, {"for", FOR}, {"while", WHILE}, {"break", BREAK},    {"delete", DELETE}, {"new", NEW},};void detect_num_error(const std::string& lexeme) {    const long long val = std::strtoll(lexeme.c_str(), nullptr, 10);    if (val > INT32_MAX || val < INT32_MIN) throw std::exception{};    if (lexeme.at(0) == '0' && lexeme.length() > 1) throw std::exception{};}void scan(std::istream& is, std::ostream& os, std::vector<Token>& stream, std::ostream& err = std::cerr) {    ScannerDFAState state = START;    std::string lexeme;    char c;    size_t line_num = 1;    size_t col_num = 0;    try{        while (is.get(c)) {            if (c == '#' || c == '\n') { // COMMENT -> skip line!                if (c == '#') is.ignore(std::numeric_limits<std::streamsize>::max(), '\n');                line_num++;                col_num = 0;                continue;            }            if (transitions[state][c] == ERROR && state == START) { // INVALID TOKEN START!                if(c == ' ' || c == '\n' || c == '\t' || c == '\v' || c == '\r') continue;                throw std::exception{};            }            else if (transitions[state][c] == ERROR) { // NEW TOKEN!                is.putback(c);                if (state == ID && KEYWORDS.contains(lexeme)) state = KEYWORDS.at(lexeme);                else if (state == NUM) detect_num_error(lexeme);                os << state  << " : " << lexeme << std::endl;                stream.push_back(Token{std::move(lexeme), static_cast<Parser::ParserSymbol>(state), line_num, col_num});                lexeme.clear();                state = START;            }            else if (transitions[state][c] != ERROR) { // REGULAR TRANSITION!                lexeme += c;                state = transitions[state][c];            }            col_num++;        }    } catch (std::exception& e) {        const size_t left_err_len = (col_num < MAX_ERROR_LEN) ? col_num : MAX_ERROR_LEN;        int i;        for (i = 0; i <= left_err_len; i++) is.unget();        for (i = 0; i <= left_err_len; i++) {            is.get(c);            err << c;        }        for (i = 0; i < MAX_ERROR_LEN; i++) {            is.get(c);            if (c == '\n' || c == '\r') break;            err << c;        }        err << '\n';        for (i = 0; i < left_err_len; i++) err << ' ';        err << "^~~~ Lexer ERROR in Line " << line_num << " : Column " << col_num << std::endl;        stream.push_back(Token{{}, Parser::ParserSymbol::DOLLAR});        return;    }    if (!lexeme.empty() && is_accepting_state(state)) { // Leftovers!        if (state == ID && KEYWORDS.contains(lexeme)) state = KEYWORDS.at(lexeme);        else if (state == NUM) detect_num_error(lexeme);        os << state  << " : " << lexeme << std::endl;        stream.push_back(Token{std::move(lexeme), static_cast<Parser::ParserSymbol>(state), line_num, col_num});    }}
\ No newline at end of file
+#include "scanner.h"
+#include "simd.h"
+#include <array>
+#include <cstdint>
+#include <algorithm>
+#include <iostream>
+#include <thread>
+#include <string_view>
+#include <limits>
+
+#define MAX_ERROR_LEN 5
+
+using namespace Scanner;
+
+constexpr bool is_accepting_state(Scanner::ScannerDFAState state) {
+    return state != START && state != APOS && state != APOSLASH && state != NOT_CHARLIT && state != ERROR;
+}
+
+std::ostream& operator<<(std::ostream& os, Scanner::ScannerDFAState state) {
+    switch (state) {
+        case MAIN: os << "MAIN"; break;
+        case READ: os << "READ"; break;
+        case PRINT: os << "PRINT"; break;
+        case INT: os << "INT"; break;
+        case CHAR: os << "CHAR"; break;
+        case BOOL: os << "BOOL"; break;
+        case VOID: os << "VOID"; break;
+        case TRUE: os << "TRUE"; break;
+        case FALSE: os << "FALSE"; break;
+        case NIL: os << "NIL"; break;
+        case NUM: os << "NUM"; break;
+        case CHARLIT: os << "CHARLIT"; break;
+        case ID: os << "ID"; break;
+        case RETURN: os << "RETURN"; break;
+        case IF: os << "IF"; break;
+        case ELIF: os << "ELIF"; break;
+        case ELSE: os << "ELSE"; break;
+        case FOR: os << "FOR"; break;
+        case WHILE: os << "WHILE"; break;
+        case BREAK: os << "BREAK"; break;
+        case DELETE: os << "DELETE"; break;
+        case NEW: os << "NEW"; break;
+        case COLON: os << "COLON"; break;
+        case LPAREN: os << "LPAREN"; break;
+        case RPAREN: os << "RPAREN"; break;
+        case SEMI: os << "SEMI"; break;
+        case LCURLY: os << "LCURLY"; break;
+        case RCURLY: os << "RCURLY"; break;
+        case COMMA: os << "COMMA"; break;
+        case LBRACK: os << "LBRACK"; break;
+        case RBRACK: os << "RBRACK"; break;
+        case BECOMES: os << "BECOMES"; break;
+        case NOT: os << "NOT"; break;
+        case OR: os << "OR"; break;
+        case AND: os << "AND"; break;
+        case GEQ: os << "GEQ"; break;
+        case GT: os << "GT"; break;
+        case LEQ: os << "LEQ"; break;
+        case LT: os << "LT"; break;
+        case EQUALS: os << "EQUALS"; break;
+        case NEQ: os << "NEQ"; break;
+        case PLUS: os << "PLUS"; break;
+        case SUB: os << "SUB"; break;
+        case MULT: os << "MULT"; break;
+        case AT: os << "AT"; break;
+        case ADDR: os << "ADDR"; break;
+        case DIV: os << "DIV"; break;
+        case MOD: os << "MOD"; break;
+        case LSHIFT: os << "LSHIFT"; break;
+        case RSHIFT: os << "RSHIFT"; break;
+        case EXP: os << "EXP"; break;
+        case BITOR: os << "BITOR"; break;
+        case BITXOR: os << "BITXOR"; break;
+        case BITAND: os << "BITAND"; break;
+        case BITNOT: os << "BITNOT"; break;
+        case INCR: os << "INCR"; break;
+        case DECR: os << "DECR"; break;
+        case ARROW: os << "ARROW"; break;
+        case DOT: os << "DOT"; break;
+        case STRUCT: os << "STRUCT"; break;
+        case START: os << "START"; break;
+        case APOS: os << "APOS"; break;
+        case APOSLASH: os << "APOSLASH"; break;
+        case NOT_CHARLIT: os << "NOT_CHARLIT"; break;
+        default: os << "NONE"; break;
+    }
+    return os;
+}
+
+//// Transition Table
+
+// The DFA is built in two steps at compile time:
+//   1. a full state x byte table, where keywords are spelled out as a trie of extra states hanging off START
+//      (every trie state accepts as ID, the last letter lands on the keyword's own ScannerDFAState);
+//   2. bytes whose columns are identical in every row are merged into one byte class.
+// The scanner then only ever does next[state][byte_class[c]], and keywords fall out of the same walk.
+
+struct Keyword {
+    std::string_view spelling;
+    ScannerDFAState state;
+};
+
+inline constexpr std::array<Keyword, 20> KEYWORDS{{
+    {"main", MAIN}, {"read", READ}, {"print", PRINT}, {"int", INT}, {"char", CHAR}, {"bool", BOOL},
+    {"struct", STRUCT}, {"void", VOID}, {"true", TRUE}, {"false", FALSE}, {"NULL", NIL},
+    {"return", RETURN}, {"if", IF}, {"elif", ELIF}, {"else", ELSE}, {"for", FOR}, {"while", WHILE},
+    {"break", BREAK}, {"delete", DELETE}, {"new", NEW},
+}};
+
+#define MAX_DFA_STATES 256
+
+using DFAState = uint8_t;
+
+struct FullTable {
+    std::array<std::array<DFAState, 256>, MAX_DFA_STATES> next{};
+    std::array<DFAState, MAX_DFA_STATES> accept{};
+    size_t num_states = NUM_STATES;
+};
+
+constexpr bool is_id_char(unsigned char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+consteval FullTable build_full_table() {
+    FullTable ft{};
+    for (auto& row : ft.next) row.fill(ERROR);
+    auto& t = ft.next;
+    int c;
+
+    for (c = 0; c < 256; c++) {
+        if (!is_id_char(c)) continue;
+        if (c < '0' || c > '9') t[START][c] = ID;
+        t[ID][c] = ID;
+    }
+    for (c = '0'; c <= '9'; c++) {
+        t[START][c] = NUM;
+        t[NUM][c] = NUM;
+    }
+    t[START][':'] = COLON;
+    t[START]['('] = LPAREN;
+    t[START][')'] = RPAREN;
+    t[START][';'] = SEMI;
+    t[START]['{'] = LCURLY;
+    t[START]['}'] = RCURLY;
+    t[START][','] = COMMA;
+    t[START]['['] = LBRACK;
+    t[START][']'] = RBRACK;
+    t[START]['='] = BECOMES;
+    t[BECOMES]['='] = EQUALS;
+    t[START]['!'] = NOT;
+    t[NOT]['='] = NEQ;
+    t[START]['~'] = BITNOT;
+    t[START]['|'] = BITOR;
+    t[BITOR]['|'] = OR;
+    t[START]['&'] = BITAND;
+    t[BITAND]['&'] = AND;
+    t[START]['>'] = GT;
+    t[GT]['='] = GEQ;
+    t[GT]['>'] = RSHIFT;
+    t[START]['<'] = LT;
+    t[LT]['='] = LEQ;
+    t[LT]['<'] = LSHIFT;
+    t[START]['+'] = PLUS;
+    t[PLUS]['+'] = INCR;
+    t[START]['*'] = MULT;
+    t[START]['@'] = AT;
+    t[START]['$'] = ADDR;
+    t[START]['/'] = DIV;
+    t[START]['%'] = MOD;
+    t[START]['^'] = BITXOR;
+    t[BITXOR]['^'] = EXP;
+    t[START]['.'] = DOT;
+    t[START]['-'] = SUB;
+    t[SUB]['-'] = DECR;
+    t[SUB]['>'] = ARROW;
+
+    t[START]['\''] = APOS;
+    for (c = ' '; c <= '~'; c++) t[APOS][c] = NOT_CHARLIT;
+    t[APOS]['\\'] = APOSLASH;
+    t[APOS]['\"'] = ERROR;
+    t[APOS]['\''] = ERROR;
+    t[APOS]['\?'] = ERROR;
+    for (const char e : {'\\', '\"', '\'', '\?', 'n', 't', 'r', 'b', 'a', '0', 'f', 'v'}) t[APOSLASH][e] = NOT_CHARLIT;
+    t[NOT_CHARLIT]['\''] = CHARLIT;
+
+    for (size_t s = 0; s < NUM_STATES; s++) ft.accept[s] = is_accepting_state(ScannerDFAState(s)) ? s : size_t{ERROR};
+
+    // Keyword trie: every proper prefix is a fresh state that behaves like ID; the full spelling ends in the
+    // keyword's own state, which also behaves like ID on any further identifier character.
+    for (const auto& [spelling, kw_state] : KEYWORDS) {
+        size_t state = START;
+        for (size_t i = 0; i < spelling.size(); i++) {
+            const unsigned char ch = spelling[i];
+            const bool last = i + 1 == spelling.size();
+            size_t next = t[state][ch];
+            if (last) {
+                const size_t like = (next >= NUM_STATES) ? next : size_t{ID}; // keep any longer keyword reachable
+                for (c = 0; c < 256; c++) t[kw_state][c] = t[like][c];
+                t[state][ch] = kw_state;
+                break;
+            }
+            if (next == ID || next == ERROR) {
+                next = ft.num_states++;
+                for (c = 0; c < 256; c++) t[next][c] = t[ID][c];
+                ft.accept[next] = ID;
+                t[state][ch] = next;
+            }
+            state = next;
+        }
+    }
+    return ft;
+}
+
+consteval size_t count_dfa_states() { return build_full_table().num_states; }
+
+inline constexpr size_t NUM_DFA_STATES = count_dfa_states();
+static_assert(NUM_DFA_STATES <= MAX_DFA_STATES, "scanner DFA no longer fits in a DFAState");
+
+struct ByteClasses {
+    std::array<uint8_t, 256> of{};
+    std::array<uint8_t, 256> representative{};
+    size_t count = 0;
+};
+
+consteval ByteClasses build_byte_classes() {
+    const FullTable ft = build_full_table();
+    ByteClasses bc{};
+    for (size_t c = 0; c < 256; c++) {
+        size_t k;
+        for (k = 0; k < bc.count; k++) {
+            const size_t rep = bc.representative[k];
+            bool same = true;
+            for (size_t s = 0; s < NUM_DFA_STATES && same; s++) same = ft.next[s][c] == ft.next[s][rep];
+            if (same) break;
+        }
+        if (k == bc.count) bc.representative[bc.count++] = c;
+        bc.of[c] = k;
+    }
+    return bc;
+}
+
+inline constexpr ByteClasses BYTE_CLASSES = build_byte_classes();
+inline constexpr size_t NUM_BYTE_CLASSES = BYTE_CLASSES.count;
+
+struct DFA {
+    std::array<uint8_t, 256> byte_class;
+    std::array<std::array<DFAState, NUM_BYTE_CLASSES>, NUM_DFA_STATES> next;
+    std::array<DFAState, NUM_DFA_STATES> accept;
+};
+
+consteval DFA build_dfa() {
+    const FullTable ft = build_full_table();
+    DFA dfa{};
+    dfa.byte_class = BYTE_CLASSES.of;
+    for (size_t s = 0; s < NUM_DFA_STATES; s++) {
+        for (size_t k = 0; k < NUM_BYTE_CLASSES; k++) dfa.next[s][k] = ft.next[s][BYTE_CLASSES.representative[k]];
+        dfa.accept[s] = ft.accept[s];
+    }
+    return dfa;
+}
+
+inline constexpr DFA TRANSITIONS = build_dfa();
+
+//// Scanning
+
+bool detect_num_error(std::string_view lexeme) {
+    if (lexeme.front() == '0' && lexeme.length() > 1) return true;
+    long long val = 0;
+    for (const char c : lexeme) {
+        val = val * 10 + (c - '0');
+        if (val > INT32_MAX) return true;
+    }
+    return false;
+}
+
+void print_lexer_error(const SourceBuffer& source, size_t pos, std::ostream& err) {
+    const std::string_view src = source.text();
+    const auto [line_num, col_num] = source.location(pos);
+    const size_t left_err_len = std::min<size_t>(col_num - 1, MAX_ERROR_LEN);
+    size_t i = pos - left_err_len;
+    for (; i <= pos && i < src.size(); i++) err << src[i];
+    for (size_t n = 0; n < MAX_ERROR_LEN && i < src.size() && src[i] != '\n' && src[i] != '\r'; n++, i++) err << src[i];
+    err << '\n';
+    for (i = 0; i < left_err_len; i++) err << ' ';
+    err << "^~~~ Lexer ERROR in Line " << line_num << " : Column " << col_num << std::endl;
+}
+
+// Lexes the next token of src[pos, end), skipping any whitespace and comments before it, and advances pos past it.
+// Returns LEX_TOKEN with tok filled in (symbol left 0), LEX_END if only trivia remained, or LEX_ERROR with
+// error_pos set to the offset to report. Without Bulk, whitespace and identifiers go a byte at a time through the DFA
+// as they did before the kernels (BYTE_AT_A_TIME_KERNELS).
+enum LexResult { LEX_TOKEN, LEX_END, LEX_ERROR };
+
+template <bool Bulk>
+[[gnu::always_inline]] inline LexResult lex_one(std::string_view src, size_t& pos, size_t end, Token& tok,
+                                                size_t& error_pos) {
+    const ScanKernels& kernels = *active_scan_kernels;
+    const char* const base = src.data();
+    const char* const stop = base + end;
+
+    while (pos < end) {
+        const unsigned char c = src[pos];
+        if (c == ' ' || c == '\n' || c == '\t' || c == '\v' || c == '\r' || c == '\f') { // WHITESPACE
+            if constexpr (Bulk) pos = skip_run(base + pos + 1, stop, IS_WHITESPACE, kernels.skip_whitespace) - base;
+            else pos++;
+            continue;
+        }
+        if (c == '#') { // COMMENT -> skip line!
+            pos = skip_comment(base + pos, stop) - base;
+            continue;
+        }
+
+        // Maximal munch: walk the table until the next byte has no transition.
+        // Once a lexeme is a plain ID (not a keyword prefix) only [A-Za-z0-9_] can extend it, so jump the run.
+        const size_t token_begin = pos;
+        DFAState state = START;
+        while (pos < end) {
+            const DFAState next = TRANSITIONS.next[state][TRANSITIONS.byte_class[static_cast<unsigned char>(src[pos])]];
+            if (next == ERROR) break;
+            state = next;
+            pos++;
+            if (Bulk && state == ID) {
+                pos = skip_run(base + pos, stop, IS_ID_CHAR, kernels.skip_id_chars) - base;
+                break;
+            }
+        }
+
+        const auto kind = static_cast<ScannerDFAState>(TRANSITIONS.accept[state]);
+        if (kind == ERROR) {
+            error_pos = (pos < end) ? pos : token_begin;
+            return LEX_ERROR;
+        }
+        if (kind == NUM && detect_num_error(src.substr(token_begin, pos - token_begin))) {
+            error_pos = token_begin;
+            return LEX_ERROR;
+        }
+        tok = Token{static_cast<Parser::ParserSymbol>(kind), uint32_t(token_begin), uint32_t(pos - token_begin)};
+        return LEX_TOKEN;
+    }
+    return LEX_END;
+}
+
+// Scans src[begin, end) and appends its tokens (with absolute offsets) to stream, interning IDs if symbols is set.
+// Returns the offset to report for the first lexer error, or SCAN_OK.
+template <bool Bulk>
+size_t scan_range(std::string_view src, size_t begin, size_t end, std::vector<Token>& stream, Interner* symbols) {
+    size_t pos = begin;
+    size_t error_pos = SCAN_OK;
+    Token tok{};
+    LexResult res;
+    while ((res = lex_one<Bulk>(src, pos, end, tok, error_pos)) == LEX_TOKEN) {
+        if (tok.type == Parser::ParserSymbol::ID && symbols) tok.symbol = symbols->intern(src.substr(tok.offset, tok.length));
+        stream.push_back(tok);
+    }
+    return res == LEX_ERROR ? error_pos : SCAN_OK;
+}
+
+size_t scan_range(std::string_view src, size_t begin, size_t end, std::vector<Token>& stream, Interner* symbols) {
+    return active_scan_kernels->skip_whitespace ? scan_range<true>(src, begin, end, stream, symbols)
+                                                : scan_range<false>(src, begin, end, stream, symbols);
+}
+
+// No token, comment or character literal can contain a newline, so the DFA is back in START at the first byte of
+// every line. Chunks that start right after a '\n' can therefore be lexed independently and simply concatenated;
+// the only re-synchronisation needed is moving each cut forward to the next newline.
+bool scan_parallel(std::string_view src, std::vector<Token>& stream, size_t num_chunks, size_t& error_pos) {
+    std::vector<size_t> cuts{0};
+    for (size_t i = 1; i < num_chunks; i++) {
+        const size_t target = std::max(src.size() * i / num_chunks, cuts.back());
+        const size_t nl = src.find('\n', target);
+        if (nl == std::string_view::npos) break;
+        if (nl + 1 > cuts.back()) cuts.push_back(nl + 1);
+    }
+    cuts.push_back(src.size());
+
+    const size_t chunks = cuts.size() - 1;
+    std::vector<std::vector<Token>> parts(chunks);
+    std::vector<size_t> errors(chunks, SCAN_OK);
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(chunks - 1);
+        for (size_t i = 1; i < chunks; i++) {
+            workers.emplace_back([&, i] {
+                parts[i].reserve((cuts[i + 1] - cuts[i]) / 4);
+                errors[i] = scan_range(src, cuts[i], cuts[i + 1], parts[i], nullptr);
+            });
+        }
+        errors[0] = scan_range(src, cuts[0], cuts[1], stream, nullptr);
+    } // join
+
+    // Stitch in source order, stopping at the first chunk that hit an error exactly like a sequential scan would
+    if (errors[0] != SCAN_OK) {
+        error_pos = errors[0];
+        return false;
+    }
+    size_t total = stream.size();
+    for (const auto& part : parts) total += part.size();
+    stream.reserve(total);
+    for (size_t i = 1; i < chunks; i++) {
+        stream.insert(stream.end(), parts[i].begin(), parts[i].end());
+        if (errors[i] != SCAN_OK) {
+            error_pos = errors[i];
+            return false;
+        }
+    }
+    return true;
+}
+
+bool scan_tokens(const SourceBuffer& source, Interner& symbols, std::vector<Token>& stream, std::ostream& err,
+                 size_t num_threads, size_t min_chunk_bytes) {
+    const std::string_view src = source.text();
+    if (num_threads == 0) {
+        num_threads = (src.size() < PARALLEL_SCAN_MIN_BYTES) ? 1 : std::max(1u, std::thread::hardware_concurrency());
+    }
+    const size_t num_chunks = std::max<size_t>(1, std::min(num_threads, src.size() / min_chunk_bytes));
+
+    size_t error_pos = SCAN_OK;
+    bool ok;
+    if (num_chunks == 1) {
+        error_pos = scan_range(src, 0, src.size(), stream, &symbols);
+        ok = error_pos == SCAN_OK;
+    }
+    else {
+        // Interning is sequential so symbol ids come out in the same first-seen order as a single-threaded scan
+        const size_t first = stream.size();
+        ok = scan_parallel(src, stream, num_chunks, error_pos);
+        for (size_t i = first; i < stream.size(); i++) {
+            if (stream[i].type == Parser::ParserSymbol::ID) stream[i].symbol = symbols.intern(source.lexeme(stream[i]));
+        }
+    }
+
+    if (!ok) {
+        print_lexer_error(source, error_pos, err);
+        stream.push_back(Token{Parser::ParserSymbol::DOLLAR});
+    }
+    return ok;
+}
+
+void print_tokens(const SourceBuffer& source, std::span<const Token> stream, std::ostream& os) {
+    for (const Token& t : stream) {
+        if (t.type == Parser::ParserSymbol::DOLLAR) break;
+        os << static_cast<ScannerDFAState>(t.type) << " : " << source.lexeme(t) << '\n';
+    }
+    os.flush();
+}
+
+void scan(const SourceBuffer& source, Interner& symbols, std::ostream& os, std::vector<Token>& stream, std::ostream& err) {
+    const size_t first = stream.size();
+    scan_tokens(source, symbols, stream, err);
+    print_tokens(source, std::span{stream}.subspan(first), os);
+}
+
+//// Lexer
+
+Lexer::Lexer(const SourceBuffer& source, Interner& symbols, std::ostream& err, std::ostream* listing)
+    : source{source}, symbols{symbols}, err{err}, listing{listing} {}
+
+Token Lexer::produce() {
+    const std::string_view src = source.text();
+    const auto eof = static_cast<uint32_t>(src.size());
+    switch (phase) {
+        case Phase::BEGIN:
+            phase = Phase::BODY;
+            return Token{Parser::ParserSymbol::BoF};
+        case Phase::BODY: {
+            Token tok{};
+            size_t error_pos = SCAN_OK;
+            const LexResult res = active_scan_kernels->skip_whitespace ? lex_one<true>(src, pos, src.size(), tok, error_pos)
+                                                                       : lex_one<false>(src, pos, src.size(), tok, error_pos);
+            switch (res) {
+                case LEX_TOKEN:
+                    if (tok.type == Parser::ParserSymbol::ID) tok.symbol = symbols.intern(source.lexeme(tok));
+                    if (listing) *listing << static_cast<ScannerDFAState>(tok.type) << " : " << source.lexeme(tok) << '\n';
+                    return tok;
+                case LEX_ERROR:
+                    print_lexer_error(source, error_pos, err);
+                    error = true;
+                    phase = Phase::DONE;
+                    if (listing) listing->flush();
+                    return Token{Parser::ParserSymbol::DOLLAR, uint32_t(error_pos)};
+                case LEX_END:
+                    phase = Phase::DONE;
+                    if (listing) listing->flush();
+                    return Token{Parser::ParserSymbol::EoF, eof};
+            }
+            break;
+        }
+        case Phase::DONE:
+            break;
+    }
+    return Token{Parser::ParserSymbol::DOLLAR, eof};
+}
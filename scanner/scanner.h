@@ -1,10 +1,54 @@
 #ifndef SCANNER_H
 #define SCANNER_H
 
-#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <span>
 #include <vector>
+#include "../util/interner.h"
+#include "../util/source.h"
 #include "../util/types.h"
+#include "token_source.h"
 
-void scan(std::istream& is, std::ostream& os, std::vector<Token>& stream, std::ostream& err);
+#define SCAN_OK std::numeric_limits<size_t>::max()
+
+// Inputs below PARALLEL_SCAN_MIN_BYTES are always lexed on the calling thread;
+// larger ones are split into newline-aligned chunks of at least MIN_SCAN_CHUNK_BYTES.
+#define PARALLEL_SCAN_MIN_BYTES (size_t{8} << 20)
+#define MIN_SCAN_CHUNK_BYTES (size_t{1} << 20)
+
+// Appends the tokens of source to stream and interns every ID into symbols (ids in first-seen order).
+// On a lexer error, reports it to err, appends a DOLLAR token and returns false.
+// num_threads == 0 picks a thread count from the input size and the hardware; min_chunk_bytes is only lowered by
+// tests, to scan small inputs in several chunks.
+bool scan_tokens(const SourceBuffer& source, Interner& symbols, std::vector<Token>& stream, std::ostream& err,
+                 size_t num_threads = 0, size_t min_chunk_bytes = MIN_SCAN_CHUNK_BYTES);
+
+// Writes the "KIND : lexeme" listing of stream (up to any error sentinel) to os.
+void print_tokens(const SourceBuffer& source, std::span<const Token> stream, std::ostream& os);
+
+// scan_tokens() followed by print_tokens() of the new tokens.
+void scan(const SourceBuffer& source, Interner& symbols, std::ostream& os, std::vector<Token>& stream, std::ostream& err);
+
+// Streaming scanner: lexes one token per next() call, so the parser drives the scan and no token vector is built.
+// IDs are interned as they are produced; if listing is set, every token is also written to it as "KIND : lexeme".
+class Lexer : public TokenSource {
+    enum class Phase : uint8_t { BEGIN, BODY, DONE };
+
+    const SourceBuffer& source;
+    Interner& symbols;
+    std::ostream& err;
+    std::ostream* listing;
+    size_t pos = 0;
+    Phase phase = Phase::BEGIN;
+
+protected:
+    Token produce() override;
+
+public:
+    Lexer(const SourceBuffer& source, Interner& symbols, std::ostream& err, std::ostream* listing = nullptr);
+};
 
 #endif //SCANNER_H
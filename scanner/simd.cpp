@@ -0,0 +1,108 @@
+#include "simd.h"
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define XERLANG_X86 1
+#endif
+
+//// Scalar
+
+const char* skip_whitespace_scalar(const char* p, const char* end) {
+    while (p < end && IS_WHITESPACE[static_cast<unsigned char>(*p)]) p++;
+    return p;
+}
+
+const char* skip_id_chars_scalar(const char* p, const char* end) {
+    while (p < end && IS_ID_CHAR[static_cast<unsigned char>(*p)]) p++;
+    return p;
+}
+
+const ScanKernels SCALAR_KERNELS{"scalar", skip_whitespace_scalar, skip_id_chars_scalar};
+
+const ScanKernels BYTE_AT_A_TIME_KERNELS{"baseline", nullptr, nullptr};
+
+#ifdef XERLANG_X86
+
+//// SSE2 (baseline on x86-64)
+
+// Bytes >= 0x80 are negative as signed chars, so they fall outside every range compare below.
+
+inline __m128i whitespace_mask_sse2(__m128i v) {
+    const __m128i sp = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+    const __m128i ctl = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)),
+                                      _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1))); // \t \n \v \f \r
+    return _mm_or_si128(sp, ctl);
+}
+
+inline __m128i id_mask_sse2(__m128i v) {
+    const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                        _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+    const __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+    return _mm_or_si128(_mm_or_si128(alpha, digit), under);
+}
+
+template <__m128i (*Mask)(__m128i), const std::array<bool, 256>& Class>
+const char* skip_run_sse2(const char* p, const char* end) {
+    while (end - p >= 16) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const uint32_t hits = _mm_movemask_epi8(Mask(v));
+        if (hits != 0xFFFF) return p + __builtin_ctz(~hits);
+        p += 16;
+    }
+    while (p < end && Class[static_cast<unsigned char>(*p)]) p++;
+    return p;
+}
+
+const ScanKernels SSE2_KERNELS{"sse2", skip_run_sse2<whitespace_mask_sse2, IS_WHITESPACE>,
+                               skip_run_sse2<id_mask_sse2, IS_ID_CHAR>};
+
+//// AVX2
+
+__attribute__((target("avx2"))) inline __m256i whitespace_mask_avx2(__m256i v) {
+    const __m256i sp = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+    const __m256i ctl = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('\t' - 1)),
+                                         _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), v));
+    return _mm256_or_si256(sp, ctl);
+}
+
+__attribute__((target("avx2"))) inline __m256i id_mask_avx2(__m256i v) {
+    const __m256i lower = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+    const __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('0' - 1)),
+                                           _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), v));
+    const __m256i under = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+    return _mm256_or_si256(_mm256_or_si256(alpha, digit), under);
+}
+
+template <__m256i (*Mask)(__m256i), __m128i (*HalfMask)(__m128i), const std::array<bool, 256>& Class>
+__attribute__((target("avx2"))) const char* skip_run_avx2(const char* p, const char* end) {
+    while (end - p >= 32) {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        const uint32_t hits = _mm256_movemask_epi8(Mask(v));
+        if (hits != 0xFFFFFFFF) return p + __builtin_ctz(~hits);
+        p += 32;
+    }
+    return skip_run_sse2<HalfMask, Class>(p, end);
+}
+
+const ScanKernels AVX2_KERNELS{"avx2", skip_run_avx2<whitespace_mask_avx2, whitespace_mask_sse2, IS_WHITESPACE>,
+                               skip_run_avx2<id_mask_avx2, id_mask_sse2, IS_ID_CHAR>};
+
+#endif // XERLANG_X86
+
+std::vector<const ScanKernels*> supported_scan_kernels() {
+    std::vector<const ScanKernels*> supported = {&SCALAR_KERNELS};
+#ifdef XERLANG_X86
+    if (__builtin_cpu_supports("sse2")) supported.push_back(&SSE2_KERNELS);
+    if (__builtin_cpu_supports("avx2")) supported.push_back(&AVX2_KERNELS);
+#endif
+    return supported;
+}
+
+const ScanKernels* active_scan_kernels = &SCALAR_KERNELS;
@@ -0,0 +1,61 @@
+#ifndef XERLANG_SIMD_H
+#define XERLANG_SIMD_H
+
+#include <array>
+#include <cstring>
+#include <vector>
+
+// Bulk-skipping kernels for the scanner's hot runs. Each returns the first position in [p, end) that is not
+// part of the run (or end). The DFA only has to run at token boundaries; everything in between is consumed
+// 16/32 bytes at a time where the CPU allows it. Null kernels (BYTE_AT_A_TIME_KERNELS) turn bulk skipping off.
+struct ScanKernels {
+    const char* name;
+    const char* (*skip_whitespace)(const char* p, const char* end); // ' ' \n \t \v \r \f
+    const char* (*skip_id_chars)(const char* p, const char* end);   // [A-Za-z0-9_]
+};
+
+extern const ScanKernels SCALAR_KERNELS;
+
+// The scanner as it was before the kernels, for the scanner benchmark's baseline; never active by default
+extern const ScanKernels BYTE_AT_A_TIME_KERNELS;
+
+consteval std::array<bool, 256> build_byte_set(bool whitespace) {
+    std::array<bool, 256> t{};
+    for (int c = 0; c < 256; c++) {
+        t[c] = whitespace ? (c == ' ' || c == '\n' || c == '\t' || c == '\v' || c == '\r' || c == '\f')
+                          : ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_');
+    }
+    return t;
+}
+
+inline constexpr std::array<bool, 256> IS_WHITESPACE = build_byte_set(true);
+inline constexpr std::array<bool, 256> IS_ID_CHAR = build_byte_set(false);
+
+#define SHORT_RUN_LEN 8
+
+// Most runs in real sources are a few bytes long (single spaces, short names), where a vector load costs more
+// than it saves; only runs that survive SHORT_RUN_LEN inline byte checks are handed to the kernel.
+inline const char* skip_run(const char* p, const char* end, const std::array<bool, 256>& set,
+                            const char* (*kernel)(const char*, const char*)) {
+    for (int i = 0; i < SHORT_RUN_LEN; i++, p++) {
+        if (p == end || !set[static_cast<unsigned char>(*p)]) return p;
+    }
+    return kernel(p, end);
+}
+
+// Every kernel set this CPU can run: scalar, then SSE2 and AVX2 where available
+std::vector<const ScanKernels*> supported_scan_kernels();
+
+// The kernels the scanner runs: scalar, unless use_scan_kernels() picked others (as the scanner benchmark does to time
+// each set on the same input). The vector kernels only pay off on runs well past SHORT_RUN_LEN; on ordinary code
+// (XerlangScannerBench on the generated inputs) they measure no faster than scalar, so they are not the default.
+extern const ScanKernels* active_scan_kernels;
+inline void use_scan_kernels(const ScanKernels& kernels) { active_scan_kernels = &kernels; }
+
+// '#' comments run to the end of the line; returns the position of the '\n' (or end).
+inline const char* skip_comment(const char* p, const char* end) {
+    const void* nl = std::memchr(p, '\n', end - p);
+    return nl ? static_cast<const char*>(nl) : end;
+}
+
+#endif // XERLANG_SIMD_H
@@ -0,0 +1,57 @@
+#ifndef XERLANG_TOKEN_SOURCE_H
+#define XERLANG_TOKEN_SOURCE_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+#include "../util/types.h"
+
+// Number of most recently pulled tokens kept around for diagnostics
+#define RECENT_TOKENS 8
+
+// Pull-based stream of tokens: BoF, the tokens of the source, EoF, then DOLLAR forever.
+// A stream that hits a lexer error reports it itself, sets failed() and ends with DOLLAR straight away.
+class TokenSource {
+    std::array<Token, RECENT_TOKENS> ring{};
+    size_t pulled = 0;
+
+protected:
+    bool error = false;
+
+    virtual Token produce() = 0;
+
+public:
+    virtual ~TokenSource() = default;
+
+    Token next() {
+        const Token t = produce();
+        ring[pulled++ % RECENT_TOKENS] = t;
+        return t;
+    }
+
+    [[nodiscard]] bool failed() const { return error; }
+
+    // Copies the last (up to RECENT_TOKENS) pulled tokens into out, oldest first; returns how many were copied
+    size_t recent(std::array<Token, RECENT_TOKENS>& out) const {
+        const size_t n = pulled < RECENT_TOKENS ? pulled : RECENT_TOKENS;
+        for (size_t i = 0; i < n; i++) out[i] = ring[(pulled - n + i) % RECENT_TOKENS];
+        return n;
+    }
+};
+
+// Replays an already materialised token vector (e.g. the output of a parallel scan_tokens())
+class VectorTokenSource : public TokenSource {
+    const std::vector<Token>& stream;
+    size_t idx = 0;
+
+protected:
+    Token produce() override {
+        if (idx < stream.size()) return stream[idx++];
+        return Token{Parser::ParserSymbol::DOLLAR, stream.empty() ? 0 : stream.back().offset};
+    }
+
+public:
+    explicit VectorTokenSource(const std::vector<Token>& stream, bool failed = false) : stream{stream} { error = failed; }
+};
+
+#endif //XERLANG_TOKEN_SOURCE_H
@@ -0,0 +1,123 @@
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "parser/ast.h"
+#include "parser/ast_file.h"
+#include "parser/flat_ast.h"
+#include "parser/parser.h"
+#include "scanner/scanner.h"
+#include "util/arena.h"
+#include "util/interner.h"
+#include "util/source.h"
+#include "util/type_table.h"
+#include "visitors/resolver.h"
+#include "visitors/type_checker.h"
+
+// XerlangASTFileCorrupt <source> <scratch>
+// Saves source's checked tree as an AST file at scratch and checks that it loads. Then, for each kind of index the
+// file holds, damages one entry in a copy and checks that loading the copy fails with the loader's error for it,
+// rather than reading outside the mapping later.
+
+// Writes source's AST file to path; false if source does not compile
+bool write_sample(const char* source_path, const std::string& path) {
+    const SourceBuffer source{source_path};
+    Interner symbols;
+    TypeTable types{symbols};
+    Arena ast;
+    Lexer tokens{source, symbols, std::cerr};
+    ASTNode* root = parse(tokens, source, types, ast, std::cerr);
+    if (!root) return false;
+    ProgramNode& program = *ast_cast<ProgramNode>(root);
+    if (!resolve_names(program, ast, symbols, types, std::cerr) || !check_types(program, types, symbols, std::cerr)) {
+        return false;
+    }
+    FlatAST flat;
+    flatten_ast(*root, types, flat);
+    write_ast_file(flat, symbols, path);
+    return true;
+}
+
+// Where each array of a loaded file starts, as a byte offset into the file
+struct Sections {
+    size_t child_list, payload, name_offsets;
+};
+
+Sections sections(const ASTFile& file) {
+    const FlatView& v = file.view();
+    // The header is followed by the kind array at the next 8-byte boundary (ast_file.h)
+    const auto at = [&](const void* p) {
+        return static_cast<const char*>(p) - reinterpret_cast<const char*>(v.kind.data()) +
+               ((sizeof(ASTFileHeader) + 7) & ~size_t{7});
+    };
+    const size_t payload = at(v.payload.data());
+    return {at(v.child_list.data()), payload, (payload + v.size() * sizeof(uint32_t) + 7) & ~size_t{7}};
+}
+
+bool rejects(const std::string& label, const std::string& path, std::vector<char> bytes, const std::string& expected,
+             const std::function<void(std::vector<char>&)>& damage) {
+    damage(bytes);
+    std::ofstream{path, std::ios::binary | std::ios::trunc}.write(bytes.data(), bytes.size());
+    try {
+        const ASTFile file{path};
+        std::cerr << "ERROR: a file with " << label << " loads" << std::endl;
+        return false;
+    } catch (std::runtime_error& e) {
+        if (std::string{e.what()}.find(expected) == std::string::npos) {
+            std::cerr << "ERROR: a file with " << label << " fails with \"" << e.what() << '"' << std::endl;
+            return false;
+        }
+        std::cout << label << ": " << e.what() << '\n';
+        return true;
+    }
+}
+
+void put(std::vector<char>& bytes, size_t at, uint32_t value) {
+    std::memcpy(bytes.data() + at, &value, sizeof(value));
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "usage: " << argv[0] << " <source> <scratch>" << std::endl;
+        return 2;
+    }
+    try {
+        const std::string path = argv[2];
+        if (!write_sample(argv[1], path)) return 1;
+        std::ifstream in{path, std::ios::binary};
+        const std::vector<char> bytes{std::istreambuf_iterator<char>{in}, {}};
+        in.close();
+
+        size_t nodes, symbols;
+        Sections at{};
+        {
+            const ASTFile file{path};
+            nodes = file.view().size();
+            symbols = file.num_symbols();
+            at = sections(file);
+        }
+
+        const std::string copy = path + ".corrupt";
+        bool ok = true;
+        ok &= rejects("a child past the last node", copy, bytes, "has a corrupt child index", [&](auto& b) {
+            put(b, at.child_list, uint32_t(nodes + 5));
+        });
+        ok &= rejects("a name past the last symbol", copy, bytes, "has a corrupt symbol index", [&](auto& b) {
+            for (size_t n = 0; n < nodes; n++) put(b, at.payload + n * sizeof(uint32_t), uint32_t(symbols));
+        });
+        ok &= rejects("a string past the name characters", copy, bytes, "has a corrupt string table", [&](auto& b) {
+            put(b, at.name_offsets + sizeof(uint32_t), 0xFFFFFF);
+        });
+        ok &= rejects("its last array cut short", copy, bytes, "is truncated or corrupt", [&](auto& b) {
+            b.resize(b.size() - 1);
+        });
+        return ok ? 0 : 1;
+    } catch (std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
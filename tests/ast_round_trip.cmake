@@ -0,0 +1,27 @@
+# cmake -DXERLANG=<Xerlang> -DINPUT=<source> -DAST=<file> -P ast_round_trip.cmake
+# Fails unless the default dump of INPUT's tree, the --flat dump of its flat form and the --load-ast dump of the AST
+# file --emit-ast writes for it are byte-identical. A source that does not compile has to fail the same way with
+# --flat and --emit-ast.
+execute_process(COMMAND ${XERLANG} ${INPUT} OUTPUT_VARIABLE tree_out RESULT_VARIABLE tree_result ERROR_VARIABLE err)
+execute_process(COMMAND ${XERLANG} --flat ${INPUT} OUTPUT_VARIABLE flat_out RESULT_VARIABLE flat_result
+                ERROR_VARIABLE err)
+execute_process(COMMAND ${XERLANG} --emit-ast ${AST} ${INPUT} RESULT_VARIABLE emit_result ERROR_VARIABLE err)
+if(NOT tree_result STREQUAL flat_result OR NOT tree_result STREQUAL emit_result)
+  message(FATAL_ERROR
+          "${INPUT}: dumping exited with ${tree_result}, --flat with ${flat_result}, --emit-ast with ${emit_result}")
+endif()
+if(NOT tree_result EQUAL 0)
+  return()
+endif()
+if(NOT flat_out STREQUAL tree_out)
+  message(FATAL_ERROR "${INPUT}: the --flat dump differs from the tree's")
+endif()
+
+execute_process(COMMAND ${XERLANG} --load-ast ${AST} OUTPUT_VARIABLE loaded_out RESULT_VARIABLE loaded_result
+                ERROR_VARIABLE err)
+if(NOT loaded_result EQUAL 0)
+  message(FATAL_ERROR "${AST}: --load-ast exited with ${loaded_result}\n${err}")
+endif()
+if(NOT loaded_out STREQUAL tree_out)
+  message(FATAL_ERROR "${INPUT}: the loaded AST file's dump differs from the tree's")
+endif()
@@ -0,0 +1,15 @@
+# cmake -DTABLE=<Xerlang> -DDIRECT=<XerlangDirect> -DINPUT=<source> -P drivers_agree.cmake
+# Fails unless both drivers print the same dump and diagnostics for INPUT, and exit the same way, with each set of
+# semantic actions: the tree's, the fused checks' and the flat AST's.
+foreach(flag "" --fused --flat-syntax)
+  foreach(driver TABLE DIRECT)
+    execute_process(COMMAND ${${driver}} ${flag} ${INPUT}
+                    OUTPUT_VARIABLE ${driver}_out ERROR_VARIABLE ${driver}_err RESULT_VARIABLE ${driver}_result)
+  endforeach()
+  if(NOT TABLE_result STREQUAL DIRECT_result)
+    message(FATAL_ERROR "'${flag}' ${INPUT}: table driver exited with ${TABLE_result}, direct with ${DIRECT_result}")
+  endif()
+  if(NOT TABLE_out STREQUAL DIRECT_out OR NOT TABLE_err STREQUAL DIRECT_err)
+    message(FATAL_ERROR "'${flag}' ${INPUT}: the table and direct drivers' output differs")
+  endif()
+endforeach()
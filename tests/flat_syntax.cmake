@@ -0,0 +1,23 @@
+# cmake -DXERLANG=<Xerlang> -DINPUT=<source> -P flat_syntax.cmake
+# Fails unless the flat AST the parser builds directly (--flat-syntax) dumps like the flattened checked tree (--flat)
+# with what only the semantic passes add masked out: the symbol tables' entries and the types printed after IDs. A
+# source that does not parse has to fail both ways.
+execute_process(COMMAND ${XERLANG} --flat-syntax ${INPUT} OUTPUT_VARIABLE syntax_out RESULT_VARIABLE syntax_result
+                ERROR_VARIABLE err)
+execute_process(COMMAND ${XERLANG} --flat ${INPUT} OUTPUT_VARIABLE flat_out RESULT_VARIABLE flat_result
+                ERROR_VARIABLE err)
+if(NOT syntax_result EQUAL 0)
+  if(flat_result EQUAL 0)
+    message(FATAL_ERROR "${INPUT}: --flat-syntax exited with ${syntax_result}, but --flat succeeded")
+  endif()
+  return()
+endif()
+if(NOT flat_result EQUAL 0)
+  return()
+endif()
+
+string(REGEX REPLACE "\n *> (param|local) [^\n]*" "" flat_out "${flat_out}")
+string(REGEX REPLACE "(↪ ID : [^ \n]+) : [^\n]*" "\\1" flat_out "${flat_out}")
+if(NOT syntax_out STREQUAL flat_out)
+  message(FATAL_ERROR "${INPUT}: the --flat-syntax dump differs from the --flat dump's syntax")
+endif()
@@ -0,0 +1,12 @@
+# cmake -DXERLANG=<Xerlang> -DFLAGS=<flags> -DINPUT=<source> -DEXPECTED=<file> -P ir_dump.cmake
+# Fails unless Xerlang with FLAGS (--ir and any options for it, space-separated) prints exactly what EXPECTED holds for
+# INPUT, and exits with 0.
+separate_arguments(flags UNIX_COMMAND "${FLAGS}")
+execute_process(COMMAND ${XERLANG} ${flags} ${INPUT} OUTPUT_VARIABLE out RESULT_VARIABLE result ERROR_VARIABLE err)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "'${FLAGS}' ${INPUT}: exited with ${result}\n${err}")
+endif()
+file(READ ${EXPECTED} expected)
+if(NOT out STREQUAL expected)
+  message(FATAL_ERROR "'${FLAGS}' ${INPUT} printed:\n${out}\ninstead of what ${EXPECTED} holds")
+endif()
@@ -0,0 +1,138 @@
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "ir/ir.h"
+#include "ir/mem2reg.h"
+#include "ir/verifier.h"
+#include "util/interner.h"
+#include "util/output.h"
+#include "util/type_table.h"
+
+// XerlangIRPasses
+// The IR passes on hand-built functions, without a source program to lower: the verifier has to reject each kind of
+// malformed IR with its diagnostic, and mem2reg has to turn a local read before anything is stored to it into zero.
+
+struct IRTest {
+    Interner symbols;
+    TypeTable types{symbols};
+    const TypeId int_pointer = types.pointer_to(TYPE_INT);
+
+    // A program whose main is made by build, its blocks linked
+    IRProgram program(const std::function<void(IRFunction&)>& build) {
+        IRProgram program;
+        program.init.blocks.resize(1);
+        program.init.add(0, {.op = IR_RETURN});
+        IRFunction& main = program.procedures.emplace_back();
+        main.name = SYM_MAIN;
+        main.return_type = TYPE_INT;
+        build(main);
+        link_blocks(main);
+        return program;
+    }
+
+    // Appends `ret 0` to block b of f
+    static void return_zero(IRFunction& f, BlockId b) {
+        const ValueId zero = f.add(b, {.op = IR_CONST, .type = TYPE_INT});
+        f.add(b, {.op = IR_RETURN, .args = {zero}});
+    }
+
+    bool rejects(const std::string& label, const std::string& expected, const std::function<void(IRFunction&)>& build) {
+        const IRProgram ir = program(build);
+        std::ostringstream err;
+        if (verify_ir(ir, types, symbols, err)) {
+            std::cerr << "ERROR: the verifier accepts " << label << std::endl;
+            return false;
+        }
+        if (err.str().find(expected) == std::string::npos) {
+            std::cerr << "ERROR: the verifier reports " << label << " as:\n" << err.str();
+            return false;
+        }
+        std::cout << label << ": " << err.str();
+        return true;
+    }
+
+    // main stores 7 to a local on one side of a branch and prints it after they join: mem2reg has to merge the 7 with
+    // the zero the local holds on the other side
+    bool promotes_unwritten_local() {
+        IRProgram ir = program([this](IRFunction& f) {
+            f.blocks.resize(4);
+            const ValueId local = f.add(0, {.op = IR_ALLOCA, .type = int_pointer});
+            const ValueId cond = f.add(0, {.op = IR_CONST, .type = TYPE_BOOL, .imm = 1});
+            f.add(0, {.op = IR_BRANCH, .args = {cond}, .targets = {1, 2}});
+            const ValueId seven = f.add(1, {.op = IR_CONST, .type = TYPE_INT, .imm = 7});
+            f.add(1, {.op = IR_STORE, .args = {seven, local}});
+            f.add(1, {.op = IR_JUMP, .targets = {3}});
+            f.add(2, {.op = IR_JUMP, .targets = {3}});
+            const ValueId read = f.add(3, {.op = IR_LOAD, .type = TYPE_INT, .args = {local}});
+            f.add(3, {.op = IR_PRINT, .args = {read}});
+            return_zero(f, 3);
+        });
+        std::ostringstream err;
+        if (!verify_ir(ir, types, symbols, err)) {
+            std::cerr << "ERROR: the verifier rejects the IR given to mem2reg:\n" << err.str();
+            return false;
+        }
+        promote_locals(ir, types);
+        if (!verify_ir(ir, types, symbols, err)) {
+            std::cerr << "ERROR: the verifier rejects what mem2reg left:\n" << err.str();
+            return false;
+        }
+
+        const IRFunction& f = ir.procedures.back();
+        const IRInstr& print = f.values[f.blocks[3].instrs[1]];
+        bool merged = print.op == IR_PRINT && f.values[print.args[0]].op == IR_PHI;
+        if (merged) {
+            const IRInstr& phi = f.values[print.args[0]];
+            for (size_t i = 0; i < phi.args.size(); i++) {
+                const IRInstr& in = f.values[phi.args[i]];
+                const int64_t expected = phi.targets[i] == 1 ? 7 : 0;
+                merged = merged && in.op == IR_CONST && in.type == TYPE_INT && in.imm == expected;
+            }
+        }
+        if (!merged) {
+            std::cerr << "ERROR: mem2reg does not merge the stored 7 with a zero:\n";
+            OutputBuffer out{std::cerr};
+            print_ir(ir, types, symbols, out);
+            out.flush();
+            return false;
+        }
+        std::cout << "a local read before anything is stored to it: promoted to a zero\n";
+        return true;
+    }
+};
+
+int main() {
+    IRTest test;
+    const TypeId int_pointer = test.int_pointer;
+
+    bool ok = test.promotes_unwritten_local();
+    ok &= test.rejects("a use before its definition", "uses %1 where it may not have been defined", [](IRFunction& f) {
+        f.blocks.resize(1);
+        f.add(0, {.op = IR_ADD, .type = TYPE_INT, .args = {1, 1}});
+        IRTest::return_zero(f, 0);
+    });
+    ok &= test.rejects("a block without a terminator", "b0 does not end with a terminator", [](IRFunction& f) {
+        f.blocks.resize(1);
+        f.add(0, {.op = IR_CONST, .type = TYPE_INT});
+    });
+    ok &= test.rejects("a PHI missing a predecessor", "does not have one operand per predecessor", [](IRFunction& f) {
+        f.blocks.resize(4);
+        const ValueId cond = f.add(0, {.op = IR_CONST, .type = TYPE_BOOL, .imm = 1});
+        f.add(0, {.op = IR_BRANCH, .args = {cond}, .targets = {1, 2}});
+        const ValueId one = f.add(1, {.op = IR_CONST, .type = TYPE_INT, .imm = 1});
+        f.add(1, {.op = IR_JUMP, .targets = {3}});
+        f.add(2, {.op = IR_JUMP, .targets = {3}});
+        const ValueId merged = f.add(3, {.op = IR_PHI, .type = TYPE_INT, .args = {one}, .targets = {1}});
+        f.add(3, {.op = IR_RETURN, .args = {merged}});
+    });
+    ok &= test.rejects("a store of the wrong type", "does not store a scalar through a pointer to its type",
+                       [int_pointer](IRFunction& f) {
+                           f.blocks.resize(1);
+                           const ValueId local = f.add(0, {.op = IR_ALLOCA, .type = int_pointer});
+                           const ValueId flag = f.add(0, {.op = IR_CONST, .type = TYPE_BOOL});
+                           f.add(0, {.op = IR_STORE, .args = {flag, local}});
+                           IRTest::return_zero(f, 0);
+                       });
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "scanner/scanner.h"
+#include "util/interner.h"
+#include "util/source.h"
+
+// XerlangParallelScan <source> <threads> <chunk_bytes>
+// Scans source on one thread and again in threads newline-aligned chunks of at least chunk_bytes, then scans it once
+// more both ways with an illegal byte near its end, so the error lands in the last chunk. Fails unless each pair
+// yields the same tokens, the same interned symbols and the same lexer error report.
+
+// What a scan reported, followed by its tokens with the ID symbols spelled out
+std::string scan_listing(const SourceBuffer& source, size_t num_threads, size_t chunk_bytes, bool& ok) {
+    Interner symbols;
+    std::vector<Token> stream;
+    std::ostringstream out;
+    ok = scan_tokens(source, symbols, stream, out, num_threads, chunk_bytes);
+    for (const Token& t : stream) {
+        out << static_cast<int>(t.type) << ' ' << t.offset << ' ' << t.length << ' ' << t.symbol;
+        if (t.type == Parser::ParserSymbol::ID) out << ' ' << symbols.name(t.symbol);
+        out << '\n';
+    }
+    return out.str();
+}
+
+bool same_scans(const std::string& label, const SourceBuffer& source, size_t num_threads, size_t chunk_bytes,
+                bool expect_ok) {
+    bool sequential_ok = false, parallel_ok = false;
+    const std::string sequential = scan_listing(source, 1, chunk_bytes, sequential_ok);
+    const std::string parallel = scan_listing(source, num_threads, chunk_bytes, parallel_ok);
+    if (sequential_ok != expect_ok) {
+        std::cerr << "ERROR: " << label << ": the sequential scan " << (expect_ok ? "failed" : "succeeded") << std::endl;
+        return false;
+    }
+    if (parallel_ok != sequential_ok || parallel != sequential) {
+        std::cerr << "ERROR: " << label << ": the scan in " << num_threads << " chunks differs from the sequential one"
+                  << std::endl;
+        return false;
+    }
+    std::cout << label << ": " << num_threads << " chunks agree\n";
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "usage: " << argv[0] << " <source> <threads> <chunk_bytes>" << std::endl;
+        return 2;
+    }
+    try {
+        std::ifstream in{argv[1], std::ios::binary};
+        std::string text{std::istreambuf_iterator<char>{in}, {}};
+        const size_t num_threads = std::stoul(argv[2]);
+        const size_t chunk_bytes = std::stoul(argv[3]);
+        if (text.size() < num_threads * chunk_bytes) {
+            std::cerr << "ERROR: " << argv[1] << " is too small for " << num_threads << " chunks" << std::endl;
+            return 1;
+        }
+        if (!same_scans(argv[1], SourceBuffer::from_string(text), num_threads, chunk_bytes, true)) return 1;
+
+        // '`' starts no token; put it at the start of a line in the last chunk
+        const size_t late = text.find('\n', text.size() - chunk_bytes / 2) + 1;
+        text.insert(late, "`");
+        return same_scans(std::string{argv[1]} + " with a late lexer error", SourceBuffer::from_string(text),
+                          num_threads, chunk_bytes, false)
+                   ? 0
+                   : 1;
+    } catch (std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "parser/parser.h"
+#include "scanner/scanner.h"
+#include "util/arena.h"
+#include "util/interner.h"
+#include "util/source.h"
+#include "util/type_table.h"
+
+// XerlangParseScaling <small> <large> <factor>
+// large is a generated program factor times the size of small. Fails unless parsing large takes less than twice
+// factor times as long as parsing small, the best of SCALING_RUNS parses each; a list built in quadratic time takes
+// about factor times longer still. Only the parse is timed: checking and dumping the tree are linear and would
+// hide it.
+#define SCALING_RUNS 3
+
+// Best time to parse path's tokens into a tree, in seconds; negative if it does not parse
+double parse_time(const char* path) {
+    const SourceBuffer source{path};
+    Interner symbols;
+    std::vector<Token> stream = {{Parser::ParserSymbol::BoF}};
+    if (!scan_tokens(source, symbols, stream, std::cerr)) return -1;
+    stream.push_back({Parser::ParserSymbol::EoF, static_cast<uint32_t>(source.text().size())});
+
+    ParserContext parser;
+    double best = 0;
+    for (int run = 0; run < SCALING_RUNS; run++) {
+        TypeTable types{symbols};
+        Arena ast;
+        VectorTokenSource tokens{stream};
+        const auto start = std::chrono::steady_clock::now();
+        if (!parser.parse(tokens, source, types, ast, std::cerr)) return -1;
+        const std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+        best = run == 0 ? took.count() : std::min(best, took.count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 4) {
+        std::cerr << "usage: " << argv[0] << " <small> <large> <factor>" << std::endl;
+        return 2;
+    }
+    try {
+        const double small = parse_time(argv[1]);
+        const double large = parse_time(argv[2]);
+        if (small < 0 || large < 0) return 1;
+        const double bound = 2 * std::stod(argv[3]) * small;
+        std::cout << argv[1] << ": " << small * 1e3 << " ms, " << argv[2] << ": " << large * 1e3 << " ms (bound "
+                  << bound * 1e3 << " ms)\n";
+        if (large > bound) {
+            std::cerr << "ERROR: parse time grows faster than linearly with the program's size" << std::endl;
+            return 1;
+        }
+    } catch (std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        return 1;
+    }
+}
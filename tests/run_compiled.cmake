@@ -0,0 +1,18 @@
+# cmake -DXERLANG=<Xerlang> -DINPUT=<source> -DEXE=<file> -DSTDIN=<text> -DEXPECTED=<file> -P run_compiled.cmake
+# Fails unless INPUT compiles to the executable EXE, and EXE, run with STDIN as its standard input, exits with 0
+# within the timeout after printing exactly what EXPECTED holds.
+execute_process(COMMAND ${XERLANG} -o ${EXE} ${INPUT} RESULT_VARIABLE build_result ERROR_VARIABLE err)
+if(NOT build_result EQUAL 0)
+  message(FATAL_ERROR "${INPUT}: -o exited with ${build_result}\n${err}")
+endif()
+
+file(WRITE ${EXE}.in "${STDIN}")
+execute_process(COMMAND ${EXE} INPUT_FILE ${EXE}.in OUTPUT_VARIABLE out RESULT_VARIABLE result ERROR_VARIABLE err
+                TIMEOUT 10)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "${EXE} with '${STDIN}' as input: exited with ${result}\n${err}")
+endif()
+file(READ ${EXPECTED} expected)
+if(NOT out STREQUAL expected)
+  message(FATAL_ERROR "${EXE} with '${STDIN}' as input printed:\n${out}\ninstead of:\n${expected}")
+endif()
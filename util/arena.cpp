@@ -0,0 +1,15 @@
+#include "arena.h"
+#include <algorithm>
+
+void* Arena::fresh_block(size_t bytes, size_t alignment) {
+    const size_t size = std::max(ARENA_BLOCK_BYTES, bytes + alignment);
+    blocks.push_back(std::make_unique_for_overwrite<std::byte[]>(size));
+    reserved += size;
+    limit = blocks.back().get() + size;
+
+    const auto p = reinterpret_cast<uintptr_t>(blocks.back().get());
+    const uintptr_t aligned = (p + alignment - 1) & ~uintptr_t(alignment - 1);
+    cursor = reinterpret_cast<std::byte*>(aligned + bytes);
+    used += bytes;
+    return reinterpret_cast<void*>(aligned);
+}
@@ -0,0 +1,56 @@
+#ifndef XERLANG_ARENA_H
+#define XERLANG_ARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Size of each block the arena carves allocations out of; larger requests get a block of their own
+#define ARENA_BLOCK_BYTES (size_t{256} << 10)
+
+// Per-compilation-unit bump allocator. Allocation is a pointer bump inside the current block, so objects sit
+// contiguously in creation order, and nothing is freed individually: the blocks are all released together when the
+// arena goes away. Objects made here are never destroyed, so anything they own must either be trivially
+// destructible or allocate from the arena as well (it is a std::pmr::memory_resource for that purpose).
+class Arena final : public std::pmr::memory_resource {
+    std::vector<std::unique_ptr<std::byte[]>> blocks;
+    std::byte* cursor = nullptr;
+    std::byte* limit = nullptr;
+    size_t used = 0;     // bytes handed out
+    size_t reserved = 0; // bytes in blocks
+
+    void* fresh_block(size_t bytes, size_t alignment);
+
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        const auto p = reinterpret_cast<uintptr_t>(cursor);
+        const uintptr_t aligned = (p + alignment - 1) & ~uintptr_t(alignment - 1);
+        if (cursor && aligned + bytes <= reinterpret_cast<uintptr_t>(limit)) {
+            cursor = reinterpret_cast<std::byte*>(aligned + bytes);
+            used += bytes;
+            return reinterpret_cast<void*>(aligned);
+        }
+        return fresh_block(bytes, alignment);
+    }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+public:
+    Arena() = default;
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    template <class T, class... Args>
+    T* make(Args&&... args) {
+        return ::new (do_allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    [[nodiscard]] size_t bytes_used() const { return used; }
+    [[nodiscard]] size_t bytes_reserved() const { return reserved; }
+};
+
+#endif // XERLANG_ARENA_H
@@ -0,0 +1,55 @@
+#include "interner.h"
+#include <algorithm>
+#include <cstring>
+
+#define INITIAL_SLOTS 1024
+#define BLOCK_BYTES (size_t{64} << 10)
+
+uint32_t hash_name(std::string_view name) {
+    uint32_t h = 2166136261u; // FNV-1a
+    for (const unsigned char c : name) h = (h ^ c) * 16777619u;
+    return h;
+}
+
+Interner::Interner() : slots(INITIAL_SLOTS, 0) {
+    for (const std::string_view name : {"main", "read", "int", "char", "bool", "void"}) intern(name);
+}
+
+Symbol Interner::intern(std::string_view name) {
+    const uint32_t h = hash_name(name);
+    const size_t mask = slots.size() - 1;
+    size_t i = h & mask;
+    for (; slots[i]; i = (i + 1) & mask) {
+        const Entry& e = entries[slots[i] - 1];
+        if (e.hash == h && e.name == name) return slots[i] - 1;
+    }
+
+    const auto sym = static_cast<Symbol>(entries.size());
+    entries.push_back({store(name), h});
+    slots[i] = sym + 1;
+    if (entries.size() * 2 > slots.size()) grow();
+    return sym;
+}
+
+std::string_view Interner::store(std::string_view name) {
+    if (block_used + name.size() > block_size) {
+        block_size = std::max(BLOCK_BYTES, name.size());
+        blocks.push_back(std::make_unique_for_overwrite<char[]>(block_size));
+        block_used = 0;
+    }
+    char* dst = blocks.back().get() + block_used;
+    std::memcpy(dst, name.data(), name.size());
+    block_used += name.size();
+    return {dst, name.size()};
+}
+
+void Interner::grow() {
+    std::vector<uint32_t> bigger(slots.size() * 2, 0);
+    const size_t mask = bigger.size() - 1;
+    for (Symbol sym = 0; sym < entries.size(); sym++) {
+        size_t i = entries[sym].hash & mask;
+        while (bigger[i]) i = (i + 1) & mask;
+        bigger[i] = sym + 1;
+    }
+    slots = std::move(bigger);
+}
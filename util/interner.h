@@ -0,0 +1,45 @@
+#ifndef XERLANG_INTERNER_H
+#define XERLANG_INTERNER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// Dense id of an interned name; ids are handed out in first-seen order starting at 0.
+using Symbol = uint32_t;
+
+// Names the compiler itself refers to are interned up front so they have fixed ids.
+enum WellKnownSymbol : Symbol {
+    SYM_MAIN, SYM_READ, SYM_INT, SYM_CHAR, SYM_BOOL, SYM_VOID,
+    NUM_WELL_KNOWN_SYMBOLS,
+};
+
+// Per-compilation string interner: every distinct identifier (and type spelling) is stored once, so names can be
+// compared and hashed as integers after scanning.
+class Interner {
+    struct Entry {
+        std::string_view name;
+        uint32_t hash;
+    };
+
+    std::vector<Entry> entries;
+    std::vector<uint32_t> slots; // open addressing, linear probing; 0 = empty, otherwise Symbol + 1
+    std::vector<std::unique_ptr<char[]>> blocks;
+    size_t block_used = 0;
+    size_t block_size = 0;
+
+public:
+    Interner();
+
+    Symbol intern(std::string_view name);
+    std::string_view name(Symbol sym) const { return entries[sym].name; }
+    size_t size() const { return entries.size(); }
+
+private:
+    std::string_view store(std::string_view name);
+    void grow();
+};
+
+#endif // XERLANG_INTERNER_H
@@ -0,0 +1,51 @@
+#include "output.h"
+#include <algorithm>
+#include <cerrno>
+#include <ostream>
+#include <unistd.h>
+
+OutputBuffer::OutputBuffer(std::ostream& os) : buffer{new char[OUTPUT_BUFFER_BYTES]}, os{&os} {}
+
+OutputBuffer::OutputBuffer(int fd) : buffer{new char[OUTPUT_BUFFER_BYTES]}, fd{fd} {}
+
+OutputBuffer::~OutputBuffer() {
+    flush();
+}
+
+void OutputBuffer::drain() {
+    emit(buffer.get(), used);
+    used = 0;
+}
+
+void OutputBuffer::emit(const char* data, size_t size) {
+    if (os) {
+        os->write(data, size);
+        ok = ok && os->good();
+        return;
+    }
+    while (ok && size > 0) {
+        const ssize_t n = ::write(fd, data, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            ok = false;
+            break;
+        }
+        data += n;
+        size -= n;
+    }
+}
+
+void OutputBuffer::spaces(size_t n) {
+    while (n > 0) {
+        if (used == OUTPUT_BUFFER_BYTES) drain();
+        const size_t run = std::min(n, OUTPUT_BUFFER_BYTES - used);
+        std::memset(buffer.get() + used, ' ', run);
+        used += run;
+        n -= run;
+    }
+}
+
+void OutputBuffer::flush() {
+    drain();
+    if (os) os->flush();
+}
@@ -0,0 +1,65 @@
+#ifndef XERLANG_OUTPUT_H
+#define XERLANG_OUTPUT_H
+
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <iosfwd>
+#include <memory>
+#include <string_view>
+
+// Size of the staging buffer; a single write larger than this bypasses it
+#define OUTPUT_BUFFER_BYTES (size_t{1} << 20)
+
+// Write-behind buffer for bulk text output such as AST dumps. Writes are appended to one large buffer that is handed to
+// the sink (an ostream or a file descriptor) only when it fills up or on flush(), so a write costs a memcpy rather than
+// a stream call. Flushes on destruction; after a failed write to a descriptor good() turns false and output is dropped.
+class OutputBuffer {
+    std::unique_ptr<char[]> buffer;
+    size_t used = 0;
+    std::ostream* os = nullptr;
+    int fd = -1;
+    bool ok = true;
+
+    void drain();
+    void emit(const char* data, size_t size);
+
+public:
+    explicit OutputBuffer(std::ostream& os);
+    explicit OutputBuffer(int fd);
+    OutputBuffer(const OutputBuffer&) = delete;
+    OutputBuffer& operator=(const OutputBuffer&) = delete;
+    ~OutputBuffer();
+
+    void put(char c) {
+        if (used == OUTPUT_BUFFER_BYTES) drain();
+        buffer[used++] = c;
+    }
+
+    void write(std::string_view s) {
+        if (s.size() > OUTPUT_BUFFER_BYTES - used) {
+            drain();
+            if (s.size() > OUTPUT_BUFFER_BYTES) return emit(s.data(), s.size());
+        }
+        std::memcpy(buffer.get() + used, s.data(), s.size());
+        used += s.size();
+    }
+
+    void spaces(size_t n);
+
+    template <std::integral T>
+    void number(T value) {
+        if (OUTPUT_BUFFER_BYTES - used < 24) drain();
+        used = std::to_chars(buffer.get() + used, buffer.get() + OUTPUT_BUFFER_BYTES, value).ptr - buffer.get();
+    }
+
+    OutputBuffer& operator<<(std::string_view s) { write(s); return *this; }
+    OutputBuffer& operator<<(char c) { put(c); return *this; }
+
+    // Hands everything buffered so far to the sink (and flushes an ostream sink)
+    void flush();
+    [[nodiscard]] bool good() const { return ok; }
+};
+
+#endif // XERLANG_OUTPUT_H
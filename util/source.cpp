@@ -0,0 +1,110 @@
+#include "source.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Token offsets and lengths are 32-bit
+#define MAX_SOURCE_BYTES size_t{UINT32_MAX}
+
+SourceBuffer::SourceBuffer(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) throw std::runtime_error{"ERROR: Cannot open source file " + path};
+
+    struct stat st{};
+    const bool regular = ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode);
+    if (regular && st.st_size > 0 && size_t(st.st_size) <= MAX_SOURCE_BYTES) {
+        void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            ::madvise(addr, st.st_size, MADV_SEQUENTIAL);
+            data = static_cast<const char*>(addr);
+            size = st.st_size;
+            mapped = true;
+        }
+    }
+    ::close(fd);
+    // A file too large is rejected before it is mapped: once the constructor throws, no destructor unmaps it
+    if (regular) check_size(st.st_size);
+    if (mapped) return;
+
+    // Not mappable (empty file, pipe, ...) -> fall back to one read into an owned copy
+    std::ifstream ifs{path, std::ios::binary};
+    owned.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+    data = owned.data();
+    size = owned.size();
+    check_size(size);
+}
+
+SourceBuffer SourceBuffer::from_string(std::string text) {
+    SourceBuffer sb;
+    sb.owned = std::move(text);
+    sb.data = sb.owned.data();
+    sb.size = sb.owned.size();
+    check_size(sb.size);
+    return sb;
+}
+
+SourceBuffer::SourceBuffer(SourceBuffer&& other) noexcept {
+    *this = std::move(other);
+}
+
+SourceBuffer& SourceBuffer::operator=(SourceBuffer&& other) noexcept {
+    if (this == &other) return *this;
+    release();
+    mapped = std::exchange(other.mapped, false);
+    size = std::exchange(other.size, 0);
+    const bool was_owned = !mapped;
+    owned = std::move(other.owned);
+    data = was_owned ? owned.data() : other.data;
+    other.data = nullptr;
+    line_starts = std::move(other.line_starts);
+    return *this;
+}
+
+SourceBuffer::~SourceBuffer() {
+    release();
+}
+
+void SourceBuffer::release() {
+    if (mapped) ::munmap(const_cast<char*>(data), size);
+    mapped = false;
+    data = nullptr;
+    size = 0;
+    owned.clear();
+    line_starts.clear();
+}
+
+void SourceBuffer::check_size(size_t bytes) {
+    if (bytes > MAX_SOURCE_BYTES) throw std::runtime_error{"ERROR: Source files larger than 4 GiB are not supported"};
+}
+
+void SourceBuffer::build_line_index() const {
+    line_starts.push_back(0);
+    const char* p = data;
+    const char* const end = data + size;
+    while ((p = static_cast<const char*>(std::memchr(p, '\n', end - p)))) {
+        line_starts.push_back(++p - data);
+    }
+}
+
+SourceLocation SourceBuffer::location(size_t offset) const {
+    if (line_starts.empty()) build_line_index();
+    const auto it = std::upper_bound(line_starts.begin(), line_starts.end(), offset);
+    const size_t line = it - line_starts.begin();
+    return {line, offset - line_starts[line - 1] + 1};
+}
+
+std::string_view SourceBuffer::line_text(size_t line) const {
+    if (line_starts.empty()) build_line_index();
+    if (line == 0 || line > line_starts.size()) return {};
+    const size_t begin = line_starts[line - 1];
+    size_t end = (line < line_starts.size()) ? line_starts[line] - 1 : size;
+    if (end > begin && data[end - 1] == '\r') end--;
+    return {data + begin, end - begin};
+}
@@ -0,0 +1,49 @@
+#ifndef XERLANG_SOURCE_H
+#define XERLANG_SOURCE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "types.h"
+
+struct SourceLocation {
+    size_t line; // 1-based
+    size_t col;  // 1-based
+};
+
+// Read-only view of one source file for the life of a compilation unit.
+// Regular files are mmap'd, anything else (pipes, in-memory text) is copied into an owned string.
+// Tokens are (offset, length) slices of text(), so the buffer must outlive every Token scanned from it.
+class SourceBuffer {
+    const char* data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    std::string owned;
+    mutable std::vector<uint32_t> line_starts; // built on the first location() query
+
+public:
+    explicit SourceBuffer(const std::string& path);
+    static SourceBuffer from_string(std::string text);
+
+    SourceBuffer(SourceBuffer&& other) noexcept;
+    SourceBuffer& operator=(SourceBuffer&& other) noexcept;
+    SourceBuffer(const SourceBuffer&) = delete;
+    SourceBuffer& operator=(const SourceBuffer&) = delete;
+    ~SourceBuffer();
+
+    std::string_view text() const { return {data, size}; }
+    std::string_view lexeme(const Token& t) const { return {data + t.offset, t.length}; }
+
+    // Line/column lookups are only needed for diagnostics, so the line index is computed lazily.
+    SourceLocation location(size_t offset) const;
+    std::string_view line_text(size_t line) const;
+
+private:
+    SourceBuffer() = default;
+    static void check_size(size_t bytes);
+    void build_line_index() const;
+    void release();
+};
+
+#endif // XERLANG_SOURCE_H
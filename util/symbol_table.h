@@ -0,0 +1,51 @@
+#ifndef XERLANG_SYMBOL_TABLE_H
+#define XERLANG_SYMBOL_TABLE_H
+
+#include <cstdint>
+#include <vector>
+#include "interner.h"
+#include "types.h"
+
+// Name -> innermost visible SymbolTableEntry, for a walk that opens and closes nested scopes. Symbols are already dense
+// ids, so the table is a flat array indexed by Symbol: a lookup is one load, with no hashing and no probing. Bindings
+// live on a stack; each one remembers the binding of the same name it shadows, and closing a scope pops its bindings
+// and restores those.
+class ScopedSymbolTable {
+    struct Binding {
+        SymbolTableEntry* entry;
+        uint32_t shadowed; // visible[name] before this binding
+        uint32_t scope;    // depth of the scope that made it
+    };
+
+    std::vector<uint32_t> visible; // per Symbol: index + 1 of its innermost binding, 0 if unbound
+    std::vector<Binding> bindings;
+    std::vector<uint32_t> scopes;  // bindings.size() when each open scope began
+
+public:
+    void open_scope() { scopes.push_back(bindings.size()); }
+
+    void close_scope() {
+        for (size_t b = bindings.size(); b > scopes.back(); b--) {
+            visible[bindings[b - 1].entry->name] = bindings[b - 1].shadowed;
+        }
+        bindings.resize(scopes.back());
+        scopes.pop_back();
+    }
+
+    // Binds entry->name in the innermost scope; false (and nothing bound) if the name is already declared there
+    bool bind(SymbolTableEntry* entry) {
+        if (entry->name >= visible.size()) visible.resize(entry->name + 1, 0);
+        const uint32_t current = visible[entry->name];
+        if (current && bindings[current - 1].scope == scopes.size()) return false;
+        bindings.push_back({entry, current, static_cast<uint32_t>(scopes.size())});
+        visible[entry->name] = bindings.size();
+        return true;
+    }
+
+    [[nodiscard]] SymbolTableEntry* lookup(Symbol name) const {
+        const uint32_t b = name < visible.size() ? visible[name] : 0;
+        return b ? bindings[b - 1].entry : nullptr;
+    }
+};
+
+#endif // XERLANG_SYMBOL_TABLE_H
@@ -0,0 +1,38 @@
+#include "type_table.h"
+#include <string>
+
+TypeTable::TypeTable(Interner& symbols) : symbols{symbols} {
+    const auto builtin = [this](Symbol name, uint32_t size) {
+        add({TypeInfo::BUILTIN, 0, size, size ? size : 1, NO_TYPE_ID, TypeId(types.size()), NO_TYPE_ID, name, name});
+    };
+    builtin(SYM_INT, INT_BYTES);
+    builtin(SYM_CHAR, CHAR_BYTES);
+    builtin(SYM_BOOL, BOOL_BYTES);
+    builtin(SYM_VOID, 0);
+    builtin(symbols.intern("NULL"), POINTER_BYTES);
+    builtin(symbols.intern("<error>"), 0);
+}
+
+TypeId TypeTable::add(const TypeInfo& info) {
+    types.push_back(info);
+    return static_cast<TypeId>(types.size() - 1);
+}
+
+TypeId TypeTable::struct_type(Symbol name) {
+    if (name >= structs.size()) structs.resize(name + 1, NO_TYPE_ID);
+    if (structs[name] == NO_TYPE_ID) {
+        structs[name] = add({TypeInfo::STRUCT, 0, 0, 1, NO_TYPE_ID, TypeId(types.size()), NO_TYPE_ID, name, name});
+    }
+    return structs[name];
+}
+
+TypeId TypeTable::pointer_to(TypeId t) {
+    if (types[t].pointer != NO_TYPE_ID) return types[t].pointer;
+    std::string spelling{symbols.name(types[t].spelling)};
+    spelling += '*';
+    const TypeInfo& to = types[t];
+    const TypeId p = add({TypeInfo::POINTER, to.depth + 1, POINTER_BYTES, POINTER_BYTES, t, to.base, NO_TYPE_ID,
+                          to.name, symbols.intern(spelling)});
+    types[t].pointer = p;
+    return p;
+}
@@ -0,0 +1,89 @@
+#ifndef XERLANG_TYPE_TABLE_H
+#define XERLANG_TYPE_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "interner.h"
+
+// Dense id of a canonical type. Every distinct type is made once, so two types are the same exactly when their ids
+// are equal.
+using TypeId = uint32_t;
+
+#define NO_TYPE_ID TypeId{0xFFFFFFFF}
+
+// Types the compiler itself refers to are made up front so they have fixed ids.
+enum BuiltinType : TypeId {
+    TYPE_INT, TYPE_CHAR, TYPE_BOOL, // the integral types, in this order
+    TYPE_VOID,
+    TYPE_NIL,   // the type of NULL, which converts to every pointer type
+    TYPE_ERROR, // given to an expression that failed to check, so that one mistake is reported once
+    NUM_BUILTIN_TYPES,
+};
+
+// Target sizes in bytes
+#define INT_BYTES 4
+#define CHAR_BYTES 1
+#define BOOL_BYTES 1
+#define POINTER_BYTES 8
+
+struct TypeInfo {
+    enum Kind : uint8_t { BUILTIN, STRUCT, POINTER };
+
+    Kind kind;
+    uint32_t depth;   // number of '@'s: 0 unless a POINTER
+    uint32_t size;    // bytes; 0 for void, and for a struct until it has been laid out
+    uint32_t align;
+    TypeId pointee;   // POINTER: the type pointed to; NO_TYPE_ID otherwise
+    TypeId base;      // the type below all the '@'s: the type itself unless a POINTER
+    TypeId pointer;   // the type of pointers to this one, once something has made it; NO_TYPE_ID until then
+    Symbol name;      // the keyword of a BUILTIN, the name of a STRUCT, the base's name for a POINTER
+    Symbol spelling;  // the whole type as the AST dumps print it, e.g. "int", "Data", "char**"
+};
+
+// Canonical type interner (hash-consing). A struct type is found through an array indexed by its name's Symbol and a
+// pointer type through a link from the type it points to, so making or finding a type is a couple of loads, with no
+// string built or compared; only a type's first construction interns its spelling. Queries such as pointee() and
+// size() read a single entry.
+class TypeTable {
+    Interner& symbols;
+    std::vector<TypeInfo> types;
+    std::vector<TypeId> structs; // per Symbol: the struct type of that name, NO_TYPE_ID if none yet
+
+    TypeId add(const TypeInfo& info);
+
+public:
+    explicit TypeTable(Interner& symbols);
+    TypeTable(const TypeTable&) = delete;
+    TypeTable& operator=(const TypeTable&) = delete;
+
+    // The type `struct name`, made on first use
+    TypeId struct_type(Symbol name);
+    // The type `t@`, made on first use
+    TypeId pointer_to(TypeId t);
+
+    // Records the size and alignment a layout pass computed for a struct type
+    void set_layout(TypeId t, uint32_t size, uint32_t align) {
+        types[t].size = size;
+        types[t].align = align;
+    }
+
+    [[nodiscard]] const TypeInfo& operator[](TypeId t) const { return types[t]; }
+    [[nodiscard]] size_t num_types() const { return types.size(); }
+
+    [[nodiscard]] TypeId pointee(TypeId t) const { return types[t].pointee; }
+    [[nodiscard]] uint32_t size(TypeId t) const { return types[t].size; }
+    [[nodiscard]] uint32_t align(TypeId t) const { return types[t].align; }
+    [[nodiscard]] Symbol spelling(TypeId t) const { return types[t].spelling; }
+
+    [[nodiscard]] static bool is_integral(TypeId t) { return t <= TYPE_BOOL; }
+    [[nodiscard]] bool is_pointer(TypeId t) const { return types[t].kind == TypeInfo::POINTER; }
+    [[nodiscard]] bool is_struct(TypeId t) const { return types[t].kind == TypeInfo::STRUCT; }
+};
+
+// x rounded up to a multiple of align, a power of two: where a field or stack slot of that alignment can start
+inline uint32_t round_up(uint32_t x, uint32_t align) {
+    return (x + align - 1) & ~(align - 1);
+}
+
+#endif // XERLANG_TYPE_TABLE_H
@@ -2,9 +2,13 @@
 #define TYPES_H
 
 #include <cstddef>
+#include <cstdint>
 #include <ostream>
+#include <string_view>
 #include <vector>
 #include <array>
+#include "interner.h"
+#include "type_table.h"
 
 #define MAX_RHS_LEN 11
 
@@ -54,15 +58,40 @@ namespace Parser {
     };
 }
 
+// Spelling of every ParserSymbol, as used in xer/grammar and in diagnostics
+inline constexpr std::array<std::string_view, Parser::ParserSymbol::NUM_SYMBOLS> PARSER_SYMBOL_NAMES{{
+    "MAIN", "READ", "PRINT", "INT", "CHAR", "BOOL", "STRUCT", "VOID",
+    "TRUE", "FALSE", "NIL", "NUM", "CHARLIT", "ID",
+    "RETURN", "IF", "ELIF", "ELSE", "FOR", "WHILE", "BREAK",
+    "DELETE", "NEW",
+    "COLON", "LPAREN", "RPAREN", "SEMI", "LCURLY", "RCURLY", "COMMA", "LBRACK", "RBRACK", "BECOMES",
+    "NOT", "OR", "AND", "GEQ", "GT", "LEQ", "LT", "EQUALS", "NEQ",
+    "PLUS", "SUB", "MULT", "DIV", "MOD", "LSHIFT", "RSHIFT", "EXP",
+    "BITOR", "BITXOR", "BITAND", "BITNOT",
+    "AT", "ADDR", "INCR", "DECR", "ARROW", "DOT",
+    "BoF", "EoF", "start",
+    "procedures", "procedure", "main",
+    "type", "star",
+    "params", "paramlist", "dcls", "dcl",
+    "statements", "statement", "ifs", "forprologue", "forepilogue",
+    "expr1", "expr2", "expr3", "expr4", "expr5", "expr6", "expr7", "expr8", "expr9", "expr10", "expr11", "expr12", "expr13", "expr14",
+    "args", "structdef",
+    "DOLLAR",
+}};
+
 std::ostream& operator<<(std::ostream& os, Parser::ParserSymbol state);
 
+// A slice [offset, offset + length) of the SourceBuffer it was scanned from.
+// Line and column are recovered on demand through SourceBuffer::location().
 typedef struct {
-    std::string lexeme;
     Parser::ParserSymbol type;
-    size_t line_num;
-    size_t col_num;
+    uint32_t offset = 0;
+    uint32_t length = 0;
+    uint32_t symbol = 0; // interned lexeme of ID tokens
 } Token;
 
+static_assert(sizeof(Token) <= 16);
+
 struct Production {
     Parser::ParserSymbol LHS;
     size_t len;
@@ -115,7 +144,8 @@ struct ASTNode {
 
     virtual ~ASTNode() = default;
 
-    virtual void accept(struct Visitor& v) = 0;
+    // Calls the Visitor overload for the node's concrete class (looked up by node_type, see DISPATCH_TABLE in ast.h)
+    void accept(struct Visitor& v);
 };
 
 // Analysis/Code Generation
@@ -154,8 +184,17 @@ struct Visitor {
     virtual void visit(struct ReadCallNode&) = 0;
 };
 
+// What a name is bound to. Name resolution (visitors/resolver.h) makes one entry per declaration in the AST's arena,
+// and resolved nodes point at it, so later passes never look a name up again.
 struct SymbolTableEntry {
-
+    enum Kind : uint8_t { GLOBAL, PARAM, LOCAL, FIELD, PROCEDURE, STRUCT };
+
+    Kind kind;
+    Symbol name;
+    TypeId type;    // declared type; the return type of a PROCEDURE; the struct type itself for a STRUCT
+    uint32_t index; // position among the program's globals, the procedure's params and locals or the struct's fields
+    ASTNode* node;  // the DeclarationNode, ProcedureNode or StructDefNode that introduced the name
+    uint32_t offset = 0; // a FIELD's byte offset in its struct, once lay_out_structs has run
 };
 
 #endif //TYPES_H
@@ -0,0 +1,630 @@
+#include "codegen.h"
+#include <cstdio>
+#include <cstring>
+#include <ostream>
+#include <spawn.h>
+#include <sys/wait.h>
+#include <vector>
+#include "runtime.h"
+
+extern char** environ;
+
+// Where a value lives: a variable, or disp(base) in memory whose address the code has just computed into base. disp
+// also selects a field of a struct variable.
+struct Place {
+    const SymbolTableEntry* var = nullptr;
+    int32_t disp = 0;
+    std::string_view base = "%rax";
+};
+
+// The registers expressions are computed in: a value is left in RAX, and a binary operator's right operand in RCX
+enum Reg { RAX, RCX };
+constexpr std::string_view REG64[] = {"%rax", "%rcx"};
+constexpr std::string_view REG32[] = {"%eax", "%ecx"};
+
+bool is_comparison(Parser::ParserSymbol op) {
+    return op == Parser::EQUALS || op == Parser::NEQ || op == Parser::LT || op == Parser::LEQ || op == Parser::GT ||
+           op == Parser::GEQ;
+}
+
+// The condition code under which l op r holds after cmp r, l
+std::string_view condition_code(Parser::ParserSymbol op, bool is_unsigned) {
+    switch (op) {
+        case Parser::EQUALS: return "e";
+        case Parser::NEQ: return "ne";
+        case Parser::LT: return is_unsigned ? "b" : "l";
+        case Parser::LEQ: return is_unsigned ? "be" : "le";
+        case Parser::GT: return is_unsigned ? "a" : "g";
+        default: return is_unsigned ? "ae" : "ge"; // GEQ
+    }
+}
+
+// The comparison that holds exactly when op does not
+Parser::ParserSymbol negated(Parser::ParserSymbol op) {
+    switch (op) {
+        case Parser::EQUALS: return Parser::NEQ;
+        case Parser::NEQ: return Parser::EQUALS;
+        case Parser::LT: return Parser::GEQ;
+        case Parser::LEQ: return Parser::GT;
+        case Parser::GT: return Parser::LEQ;
+        default: return Parser::LT; // GEQ
+    }
+}
+
+// Every expression leaves its value in %rax: an int sign-extended to 64 bits, a char or bool zero-extended, a pointer
+// as is, and a struct as its address, structs being copied rather than held in registers. Binary operators keep their
+// left operand on the stack while the right one is computed, unless the right one can be loaded straight into %rcx.
+// Nothing else lives in a register across a statement.
+// Procedures use a convention of their own: the caller pushes the arguments left to right, 8 bytes each or a struct's
+// bytes rounded up to 8, then, for a procedure returning a struct, the address of a temporary in its own frame for the
+// result, which the callee copies the struct into and returns. The callee addresses its parameters and locals from
+// %rbp, locals below it in a frame whose size is only known once the body (and the temporaries it needs) has been
+// generated, so the prologue refers to it by a symbol defined after the epilogue.
+struct CodeGen : public StaticVisitor<CodeGen> {
+    const TypeTable& types;
+    const Interner& symbols;
+    OutputBuffer& out;
+    const ProcedureNode* procedure = nullptr; // the one being generated; none while initializing the globals
+    std::vector<int32_t> frame;               // per index in procedure's symbol_table: the variable's offset from %rbp
+    uint32_t frame_bytes = 0;                 // reserved below %rbp so far
+    uint32_t labels = 0;
+    std::vector<uint32_t> loop_ends;          // of the enclosing loops, innermost last: where a break goes
+
+    CodeGen(const TypeTable& types, const Interner& symbols, OutputBuffer& out)
+        : types{types}, symbols{symbols}, out{out} {}
+
+    //// Emission
+
+    void emit(std::string_view instruction) { out << '\t' << instruction << '\n'; }
+
+    // op $value, operand
+    void emit(std::string_view op, int64_t value, std::string_view operand) {
+        out << '\t' << op << " $";
+        out.number(value);
+        out << ", " << operand << '\n';
+    }
+
+    void emit_label(uint32_t label) {
+        out << ".L";
+        out.number(label);
+        out << ":\n";
+    }
+
+    void jump(std::string_view op, uint32_t label) {
+        out << '\t' << op << " .L";
+        out.number(label);
+        out << '\n';
+    }
+
+    void place(const Place& p) {
+        if (!p.var) {
+            if (p.disp) out.number(p.disp);
+            out << '(' << p.base << ')';
+        }
+        else if (p.var->kind == SymbolTableEntry::GLOBAL) {
+            out << "g." << symbols.name(p.var->name);
+            if (p.disp) {
+                out << '+';
+                out.number(p.disp);
+            }
+            out << "(%rip)";
+        }
+        else {
+            out.number(frame[p.var->index] + p.disp);
+            out << "(%rbp)";
+        }
+    }
+
+    // Loads the t at p into reg; for a struct, its address
+    void load(TypeId t, const Place& p, Reg reg = RAX) {
+        const bool byte = t == TYPE_CHAR || t == TYPE_BOOL;
+        out << (types.is_struct(t) ? "\tleaq " : t == TYPE_INT ? "\tmovslq " : byte ? "\tmovzbl " : "\tmovq ");
+        place(p);
+        out << ", " << (byte ? REG32[reg] : REG64[reg]) << '\n';
+    }
+
+    // Stores %rax, a t, at p, which must not be based on %rax; a struct is copied from the address in %rax
+    void store(TypeId t, const Place& p) {
+        if (types.is_struct(t)) {
+            out << "\tleaq ";
+            place(p);
+            out << ", %rdi\n";
+            emit("movq %rax, %rsi");
+            copy(types.size(t));
+            return;
+        }
+        out << (t == TYPE_INT ? "\tmovl %eax, " : t == TYPE_CHAR || t == TYPE_BOOL ? "\tmovb %al, " : "\tmovq %rax, ");
+        place(p);
+        out << '\n';
+    }
+
+    // Copies size bytes from %rsi to %rdi
+    void copy(uint32_t size) {
+        emit("movl", size, "%ecx");
+        emit("rep movsb");
+    }
+
+    // Sets a variable to zero
+    void zero(const SymbolTableEntry& var) {
+        if (types.is_struct(var.type)) {
+            out << "\tleaq ";
+            place({&var});
+            out << ", %rdi\n";
+            emit("movl", types.size(var.type), "%ecx");
+            emit("xorl %eax, %eax");
+            emit("rep stosb");
+            return;
+        }
+        out << (var.type == TYPE_INT ? "\tmovl $0, " : var.type == TYPE_CHAR || var.type == TYPE_BOOL ? "\tmovb $0, " : "\tmovq $0, ");
+        place({&var});
+        out << '\n';
+    }
+
+    // Brings %rax, computed in 64 bits, back to the form of a t
+    void wrap(TypeId t) {
+        if (t == TYPE_INT) emit("movslq %eax, %rax");
+        else if (t == TYPE_CHAR) emit("movzbl %al, %eax");
+        else if (t == TYPE_BOOL) {
+            emit("testq %rax, %rax");
+            emit("setne %al");
+            emit("movzbl %al, %eax");
+        }
+    }
+
+    // Converts %rax from a from to a to, as the type checker allows; only narrowing to char or bool takes any code
+    void convert(TypeId from, TypeId to) {
+        if (from != to && (to == TYPE_CHAR || to == TYPE_BOOL)) wrap(to);
+    }
+
+    // Reserves a temporary for a t in the frame; its offset from %rbp
+    int32_t slot(TypeId t) {
+        frame_bytes = round_up(frame_bytes + types.size(t), types.align(t));
+        return -static_cast<int32_t>(frame_bytes);
+    }
+
+    //// Program Structure
+
+    void visit(ProgramNode& a) {
+        out << "\t.text\n\t.globl _start\n_start:\n";
+        emit("call xer_init_globals");
+        emit("call p.main");
+        emit("jmp xer_exit");
+
+        out << "xer_init_globals:\n";
+        const uint32_t size = prologue();
+        for (VarInitNode* gv : a.global_vars) {
+            if (gv->val) dispatch(*gv);
+        }
+        leave();
+        epilogue(size);
+
+        for (ProcedureNode* proc : a.procedures) dispatch(*proc);
+        dispatch(*a.main);
+
+        out << "\t.bss\n";
+        for (const VarInitNode* gv : a.global_vars) {
+            out << "\t.balign ";
+            out.number(types.align(gv->dcl->type));
+            out << "\ng." << symbols.name(gv->dcl->id) << ":\t.zero ";
+            out.number(types.size(gv->dcl->type));
+            out << '\n';
+        }
+    }
+
+    // Sets up a frame whose size is the symbol returned, to be defined by epilogue
+    uint32_t prologue() {
+        frame_bytes = 0;
+        const uint32_t size = labels++;
+        emit("pushq %rbp");
+        emit("movq %rsp, %rbp");
+        out << "\tsubq $.L";
+        out.number(size);
+        out << ", %rsp\n";
+        return size;
+    }
+
+    // After the return that ends the body
+    void epilogue(uint32_t size) {
+        out << "\t.set .L";
+        out.number(size);
+        out << ", ";
+        out.number(round_up(frame_bytes, 16));
+        out << '\n';
+    }
+
+    // Leaves the frame
+    void leave() {
+        emit("leave");
+        emit("ret");
+    }
+
+    void visit(ProcedureNode& a) {
+        procedure = &a;
+        out << "p." << symbols.name(a.id) << ":\n";
+        const uint32_t size = prologue();
+        frame.assign(a.symbol_table.size(), 0);
+        const size_t params = a.params ? a.params->declarations.size() : 0;
+        int32_t above = types.is_struct(a.return_type) ? 24 : 16; // past the saved %rbp, the return address and the result's address
+        for (size_t i = params; i-- > 0;) {
+            frame[i] = above;
+            above += static_cast<int32_t>(round_up(types.size(a.symbol_table[i]->type), 8));
+        }
+        for (size_t i = params; i < a.symbol_table.size(); i++) frame[i] = slot(a.symbol_table[i]->type);
+
+        dispatch(*a.block);
+        if (types.is_struct(a.return_type)) emit("movq 16(%rbp), %rax");
+        else emit("xorl %eax, %eax");
+        leave();
+        epilogue(size);
+        procedure = nullptr;
+    }
+
+    void visit(BlockNode& a) {
+        for (StatementNode* s : a.statements) dispatch(*s);
+    }
+
+    //// Statements
+
+    void visit(DeclarationNode& a) { zero(*a.entry); }
+    void visit(VarInitNode& a) {
+        if (!a.val) {
+            zero(*a.dcl->entry);
+            return;
+        }
+        dispatch(*a.val);
+        convert(a.val->type, a.dcl->type);
+        store(a.dcl->type, {a.dcl->entry});
+    }
+    void visit(AssignmentNode& a) {
+        Place p = address(*a.LHS);
+        if (!p.var) emit("pushq %rax");
+        dispatch(*a.RHS);
+        convert(a.RHS->type, a.LHS->type);
+        if (!p.var) {
+            emit("popq %rdi");
+            p.base = "%rdi";
+        }
+        store(a.LHS->type, p);
+    }
+    void visit(IfNode& a) {
+        const uint32_t end = labels++;
+        for (const IfNode::IfClause& clause : a.clauses) {
+            if (!clause.cond) {
+                dispatch(*clause.block);
+                break;
+            }
+            const uint32_t next = labels++;
+            branch_unless(*clause.cond, next);
+            dispatch(*clause.block);
+            jump("jmp", end);
+            emit_label(next);
+        }
+        emit_label(end);
+    }
+    void visit(WhileNode& a) {
+        const uint32_t top = labels++, end = labels++;
+        emit_label(top);
+        branch_unless(*a.condition, end);
+        loop_ends.push_back(end);
+        dispatch(*a.statements);
+        loop_ends.pop_back();
+        jump("jmp", top);
+        emit_label(end);
+    }
+    void visit(ForNode& a) {
+        dispatch(*a.prologue);
+        const uint32_t top = labels++, end = labels++;
+        emit_label(top);
+        branch_unless(*a.cond, end);
+        loop_ends.push_back(end);
+        dispatch(*a.block);
+        loop_ends.pop_back();
+        dispatch(*a.epilogue);
+        jump("jmp", top);
+        emit_label(end);
+    }
+    void visit(ForPrologueNode& a) {
+        if (a.init) dispatch(*a.init);
+        else dispatch(*a.asst);
+    }
+    void visit(BreakNode&) { jump("jmp", loop_ends.back()); } // resolve_names rejects a break outside a loop
+    void visit(ReturnNode& a) {
+        if (a.expr) {
+            dispatch(*a.expr);
+            convert(a.expr->type, procedure->return_type);
+            if (types.is_struct(procedure->return_type)) {
+                emit("movq 16(%rbp), %rdi");
+                emit("movq %rax, %rsi");
+                copy(types.size(procedure->return_type));
+                emit("movq 16(%rbp), %rax");
+            }
+        }
+        leave();
+    }
+    void visit(DeleteNode& a) {
+        dispatch(*a.ptr);
+        emit("call xer_free");
+    }
+    void visit(PrintNode& a) {
+        bool first = true;
+        for (ExprNode* arg : a.args->args) {
+            if (!first) emit("call xer_print_space");
+            first = false;
+            dispatch(*arg);
+            const TypeId t = arg->type;
+            emit(t == TYPE_INT    ? "call xer_print_int"
+                 : t == TYPE_CHAR ? "call xer_print_char"
+                 : t == TYPE_BOOL ? "call xer_print_bool"
+                                  : "call xer_print_pointer");
+        }
+        emit("call xer_print_newline");
+    }
+
+    // Jumps to label unless cond holds, comparing directly when cond is a comparison
+    void branch_unless(ExprNode& cond, uint32_t label) {
+        auto compare = ast_dyn_cast<BinaryExprNode>(&cond);
+        if (!compare || !is_comparison(compare->op)) {
+            dispatch(cond);
+            emit("testq %rax, %rax");
+            jump("je", label);
+            return;
+        }
+        operands(*compare);
+        emit("cmpq %rcx, %rax");
+        out << "\tj" << condition_code(negated(compare->op), is_unsigned(*compare));
+        out << " .L";
+        out.number(label);
+        out << '\n';
+    }
+
+    //// Expressions
+
+    // Where the variable, dereference or field e is, or for a struct value its address; takes code only for the
+    // parts that are not variables
+    Place address(ExprNode& e) {
+        if (auto id = ast_dyn_cast<IDNode>(&e)) return {id->entry};
+        if (auto member = ast_dyn_cast<MemberAccessExprNode>(&e)) {
+            Place p;
+            if (member->op == Parser::DOT) p = address(*member->arg);
+            else dispatch(*member->arg);
+            p.disp += static_cast<int32_t>(member->field->offset);
+            return p;
+        }
+        auto un = ast_dyn_cast<UnaryExprNode>(&e);
+        dispatch(un && un->op == Parser::AT ? *un->arg : e);
+        return {};
+    }
+
+    void visit(NumNode& a) {
+        if (a.val == 0) emit("xorl %eax, %eax");
+        else emit("movq", a.val, "%rax");
+    }
+    void visit(CharNode& a) { emit("movl", static_cast<unsigned char>(a.val), "%eax"); }
+    void visit(TrueNode&) { emit("movl $1, %eax"); }
+    void visit(FalseNode&) { emit("xorl %eax, %eax"); }
+    void visit(NilNode&) { emit("xorl %eax, %eax"); }
+    void visit(IDNode& a) { load(a.type, {a.entry}); }
+    void visit(MemberAccessExprNode& a) { load(a.type, address(a)); }
+
+    void visit(AllocNode& a) {
+        const int64_t bytes = int64_t{a.size} * types.size(types.pointee(a.ptr_type));
+        emit(bytes > INT32_MAX ? "movabsq" : "movq", bytes, "%rax");
+        emit("call xer_alloc");
+    }
+    void visit(ReadCallNode&) { emit("call xer_read"); }
+    void visit(FunctionCallNode& a) {
+        const ProcedureNode& callee = *ast_cast<ProcedureNode>(a.callee->node);
+        int64_t pushed = 0;
+        if (a.args) {
+            for (size_t i = 0; i < a.args->args.size(); i++) {
+                ExprNode& arg = *a.args->args[i];
+                const TypeId param = callee.params->declarations[i]->type;
+                dispatch(arg);
+                convert(arg.type, param);
+                if (!types.is_struct(param)) {
+                    emit("pushq %rax");
+                    pushed += 8;
+                    continue;
+                }
+                const uint32_t bytes = round_up(types.size(param), 8);
+                emit("subq", bytes, "%rsp");
+                emit("movq %rax, %rsi");
+                emit("movq %rsp, %rdi");
+                copy(types.size(param));
+                pushed += bytes;
+            }
+        }
+        if (types.is_struct(callee.return_type)) {
+            out << "\tleaq ";
+            out.number(slot(callee.return_type));
+            out << "(%rbp), %rax\n";
+            emit("pushq %rax");
+            pushed += 8;
+        }
+        out << "\tcall p." << symbols.name(a.id) << '\n';
+        if (pushed) emit("addq", pushed, "%rsp");
+    }
+
+    // Whether e's operands compare as addresses rather than as integers
+    bool is_unsigned(const BinaryExprNode& e) const {
+        return !TypeTable::is_integral(e.LHS->type) || !TypeTable::is_integral(e.RHS->type);
+    }
+
+    // Whether e can be loaded into %rcx without disturbing %rax
+    bool is_leaf(ExprNode& e) const {
+        if (isa<NumNode>(e) || isa<CharNode>(e) || isa<TrueNode>(e) || isa<FalseNode>(e) || isa<NilNode>(e)) return true;
+        return isa<IDNode>(e) && !types.is_struct(e.type);
+    }
+
+    // Computes e's left operand into %rax and its right one into %rcx
+    void operands(BinaryExprNode& e) {
+        dispatch(*e.LHS);
+        ExprNode& r = *e.RHS;
+        if (!is_leaf(r)) {
+            emit("pushq %rax");
+            dispatch(r);
+            emit("movq %rax, %rcx");
+            emit("popq %rax");
+        }
+        else if (auto id = ast_dyn_cast<IDNode>(&r)) load(id->type, {id->entry}, RCX);
+        else if (auto num = ast_dyn_cast<NumNode>(&r)) emit("movq", num->val, "%rcx");
+        else if (auto c = ast_dyn_cast<CharNode>(&r)) emit("movl", static_cast<unsigned char>(c->val), "%ecx");
+        else emit("movl", isa<TrueNode>(r) ? 1 : 0, "%ecx");
+    }
+
+    // Multiplies reg by the size of what the pointer type t points to
+    void scale(Reg reg, TypeId t) {
+        const uint32_t size = types.size(types.pointee(t));
+        if (size != 1) emit("imulq", size, REG64[reg]);
+    }
+
+    void visit(BinaryExprNode& a) {
+        if (a.op == Parser::AND || a.op == Parser::OR) {
+            // The first operand's test falls through to the setne with the flags that decide the result
+            const uint32_t done = labels++;
+            dispatch(*a.LHS);
+            emit("testq %rax, %rax");
+            jump(a.op == Parser::AND ? "je" : "jne", done);
+            dispatch(*a.RHS);
+            emit("testq %rax, %rax");
+            emit_label(done);
+            emit("setne %al");
+            emit("movzbl %al, %eax");
+            return;
+        }
+        operands(a);
+        const TypeId l = a.LHS->type, r = a.RHS->type;
+        switch (a.op) {
+            case Parser::PLUS:
+                if (types.is_pointer(l)) scale(RCX, l);
+                else if (types.is_pointer(r)) scale(RAX, r);
+                emit("addq %rcx, %rax");
+                if (a.type == TYPE_INT) wrap(TYPE_INT);
+                break;
+            case Parser::SUB:
+                if (types.is_pointer(l) && !types.is_pointer(r)) scale(RCX, l);
+                emit("subq %rcx, %rax");
+                if (types.is_pointer(l) && types.is_pointer(r) && types.size(types.pointee(l)) != 1) {
+                    emit("movq", types.size(types.pointee(l)), "%rcx");
+                    emit("cqto");
+                    emit("idivq %rcx");
+                }
+                if (a.type == TYPE_INT) wrap(TYPE_INT);
+                break;
+            case Parser::MULT:
+                emit("imulq %rcx, %rax");
+                wrap(TYPE_INT);
+                break;
+            case Parser::DIV:
+                emit("cqto");
+                emit("idivq %rcx");
+                wrap(TYPE_INT);
+                break;
+            case Parser::MOD:
+                emit("cqto");
+                emit("idivq %rcx");
+                emit("movq %rdx, %rax");
+                break;
+            case Parser::EXP:
+                emit("call xer_pow");
+                wrap(TYPE_INT);
+                break;
+            case Parser::LSHIFT:
+                emit("shll %cl, %eax");
+                wrap(TYPE_INT);
+                break;
+            case Parser::RSHIFT:
+                emit("sarl %cl, %eax");
+                wrap(TYPE_INT);
+                break;
+            case Parser::BITOR: emit("orq %rcx, %rax"); break;
+            case Parser::BITXOR: emit("xorq %rcx, %rax"); break;
+            case Parser::BITAND: emit("andq %rcx, %rax"); break;
+            default: // the comparisons
+                emit("cmpq %rcx, %rax");
+                out << "\tset" << condition_code(a.op, is_unsigned(a)) << " %al\n";
+                emit("movzbl %al, %eax");
+        }
+    }
+
+    void visit(UnaryExprNode& a) {
+        switch (a.op) {
+            case Parser::AT:
+                load(a.type, address(a));
+                return;
+            case Parser::ADDR: {
+                const Place p = address(*a.arg);
+                out << "\tleaq ";
+                place(p);
+                out << ", %rax\n";
+                return;
+            }
+            case Parser::INCR:
+            case Parser::DECR: {
+                // The old value is kept in %rdx for a postfix form
+                Place p = address(*a.arg);
+                if (!p.var) {
+                    emit("movq %rax, %rdi");
+                    p.base = "%rdi";
+                }
+                load(a.type, p);
+                emit("movq %rax, %rdx");
+                emit(a.op == Parser::INCR ? "addq" : "subq", types.is_pointer(a.type) ? types.size(types.pointee(a.type)) : 1,
+                     "%rax");
+                wrap(a.type);
+                store(a.type, p);
+                if (a.postfix()) emit("movq %rdx, %rax");
+                return;
+            }
+            default:
+                break;
+        }
+        dispatch(*a.arg);
+        if (a.op == Parser::NOT) {
+            emit("testq %rax, %rax");
+            emit("sete %al");
+            emit("movzbl %al, %eax");
+        }
+        else if (a.op == Parser::BITNOT) emit("notq %rax");
+        else if (a.op == Parser::SUB) {
+            emit("negq %rax");
+            wrap(TYPE_INT);
+        }
+    }
+
+    // Struct definitions and the argument and declaration lists are handled by their owners and never dispatched on
+    void visit(StructDefNode&) {}
+    void visit(DeclarationsNode&) {}
+    void visit(ArgsNode&) {}
+};
+
+void generate_assembly(ProgramNode& program, const TypeTable& types, const Interner& symbols, OutputBuffer& out) {
+    CodeGen gen{types, symbols, out};
+    gen.dispatch(program);
+    out << RUNTIME_ASSEMBLY;
+}
+
+// Runs a tool found on the PATH to completion; false (after reporting to err) unless it ran and exited with status 0
+bool run_tool(std::vector<const char*> argv, std::ostream& err) {
+    argv.push_back(nullptr);
+    pid_t pid;
+    const int error = posix_spawnp(&pid, argv[0], nullptr, nullptr, const_cast<char* const*>(argv.data()), environ);
+    if (error != 0) {
+        err << "Cannot run " << argv[0] << ": " << std::strerror(error) << '\n';
+        return false;
+    }
+    int status = 0;
+    if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        err << argv[0] << " failed\n";
+        return false;
+    }
+    return true;
+}
+
+bool assemble_and_link(const std::string& asm_path, const std::string& exe_path, std::ostream& err) {
+    const std::string object_path = exe_path + ".o";
+    const bool ok = run_tool({"as", "--64", "-o", object_path.c_str(), asm_path.c_str()}, err) &&
+                    run_tool({"ld", "-static", "-o", exe_path.c_str(), object_path.c_str()}, err);
+    std::remove(object_path.c_str());
+    return ok;
+}
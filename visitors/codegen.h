@@ -0,0 +1,26 @@
+#ifndef XERLANG_CODEGEN_H
+#define XERLANG_CODEGEN_H
+
+#include <iosfwd>
+#include <string>
+#include "../parser/ast.h"
+#include "../util/interner.h"
+#include "../util/output.h"
+#include "../util/type_table.h"
+
+// x86-64 code generation, on a tree that resolve_names, check_types and lay_out_structs accepted. Writes the program
+// as GNU assembler source for Linux, followed by the runtime it calls (runtime.h); assemble_and_link turns that into an
+// executable.
+// The program starts by running the globals' initializers in declaration order, then main, whose return value is the
+// exit status. int is 32-bit and wraps around, char is an unsigned byte and bool is 0 or 1; pointers are 64-bit and
+// compared unsigned. Variables without an initializer start at zero, as does memory from new; deleting NULL does
+// nothing, and a ^^ b is 0 for a negative b. print writes its arguments separated by spaces and ends the line: ints in
+// decimal, chars as they are, bools as true or false and pointers in hex. read() yields the next byte of standard
+// input, or 0 at its end. A procedure that ends without a return returns 0.
+void generate_assembly(ProgramNode& program, const TypeTable& types, const Interner& symbols, OutputBuffer& out);
+
+// Assembles asm_path with as and links the object (written next to the executable, then removed) with ld into a static
+// executable at exe_path, without libc. Reports a tool that could not be run or that failed to err; false if one did.
+bool assemble_and_link(const std::string& asm_path, const std::string& exe_path, std::ostream& err);
+
+#endif // XERLANG_CODEGEN_H
@@ -0,0 +1,114 @@
+#include "layout.h"
+#include <algorithm>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+struct StructLayout {
+    enum State : uint8_t { UNVISITED, IN_PROGRESS, DONE };
+
+    TypeTable& types;
+    const Interner& symbols;
+    const FieldOrder order;
+    std::ostream& err;
+    std::vector<StructDefNode*> definitions; // per TypeId
+    std::vector<State> state;                // per TypeId
+    std::vector<DeclarationNode*> fields;    // of the struct being placed, in memory order
+    bool ok = true;
+
+    StructLayout(TypeTable& types, const Interner& symbols, FieldOrder order, std::ostream& err)
+        : types{types}, symbols{symbols}, order{order}, err{err},
+          definitions(types.num_types(), nullptr), state(types.num_types(), UNVISITED) {}
+
+    // Lays out sd once the structs it contains by value, which its size depends on, are laid out
+    void lay_out(StructDefNode& sd) {
+        if (state[sd.type] == DONE) return;
+        if (state[sd.type] == IN_PROGRESS) {
+            err << "Layout Error in global scope: '" << symbols.name(sd.id) << "' contains itself\n";
+            ok = false;
+            return;
+        }
+        state[sd.type] = IN_PROGRESS;
+        for (DeclarationNode* field : sd.fields->declarations) {
+            if (types.is_struct(field->type) && definitions[field->type]) lay_out(*definitions[field->type]);
+        }
+
+        fields.assign(sd.fields->declarations.begin(), sd.fields->declarations.end());
+        if (order == FIELDS_BY_ALIGNMENT) {
+            std::ranges::stable_sort(fields, std::greater{}, [this](DeclarationNode* f) { return types.align(f->type); });
+        }
+        uint32_t offset = 0;
+        uint32_t align = 1;
+        for (DeclarationNode* field : fields) {
+            const uint32_t a = types.align(field->type);
+            offset = round_up(offset, a);
+            field->entry->offset = offset;
+            offset += types.size(field->type);
+            align = std::max(align, a);
+        }
+        types.set_layout(sd.type, round_up(offset, align), align);
+        state[sd.type] = DONE;
+    }
+};
+
+bool lay_out_structs(ProgramNode& program, TypeTable& types, const Interner& symbols, FieldOrder order, std::ostream& err) {
+    StructLayout layout{types, symbols, order, err};
+    for (StructDefNode* sd : program.struct_defs) layout.definitions[sd->type] = sd;
+    for (StructDefNode* sd : program.struct_defs) layout.lay_out(*sd);
+    return layout.ok;
+}
+
+// One line of the report: the bytes [from, to) of a struct and what fills them
+void report_range(OutputBuffer& out, uint32_t from, uint32_t to) {
+    out << "    [";
+    out.number(from);
+    out << ", ";
+    out.number(to);
+    out << ") ";
+}
+
+void print_layout_report(const ProgramNode& program, const TypeTable& types, const Interner& symbols, OutputBuffer& out) {
+    std::vector<const DeclarationNode*> fields;
+    for (const StructDefNode* sd : program.struct_defs) {
+        fields.assign(sd->fields->declarations.begin(), sd->fields->declarations.end());
+        std::ranges::stable_sort(fields, {}, [](const DeclarationNode* f) { return f->entry->offset; });
+        const uint32_t size = types.size(sd->type);
+        uint32_t used = 0;
+        for (const DeclarationNode* field : fields) used += types.size(field->type);
+
+        out << "struct " << symbols.name(sd->id) << ": size ";
+        out.number(size);
+        out << ", align ";
+        out.number(types.align(sd->type));
+        out << ", ";
+        out.number(size - used);
+        out << (size - used == 1 ? " byte of padding" : " bytes of padding");
+        if (size > CACHE_LINE_BYTES) {
+            out << ", ";
+            out.number((size + CACHE_LINE_BYTES - 1) / CACHE_LINE_BYTES);
+            out << " cache lines";
+        }
+        out << '\n';
+
+        uint32_t end = 0;
+        for (const DeclarationNode* field : fields) {
+            const uint32_t offset = field->entry->offset;
+            const uint32_t field_end = offset + types.size(field->type);
+            if (offset > end) {
+                report_range(out, end, offset);
+                out << "hole\n";
+            }
+            report_range(out, offset, field_end);
+            out << symbols.name(field->id) << " : " << symbols.name(types.spelling(field->type));
+            if (field_end > offset && offset / CACHE_LINE_BYTES != (field_end - 1) / CACHE_LINE_BYTES) {
+                out << " (straddles a cache line)";
+            }
+            out << '\n';
+            end = field_end;
+        }
+        if (size > end) {
+            report_range(out, end, size);
+            out << "tail padding\n";
+        }
+    }
+}
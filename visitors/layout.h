@@ -0,0 +1,32 @@
+#ifndef XERLANG_LAYOUT_H
+#define XERLANG_LAYOUT_H
+
+#include <iosfwd>
+#include "../parser/ast.h"
+#include "../util/interner.h"
+#include "../util/output.h"
+#include "../util/type_table.h"
+
+#define CACHE_LINE_BYTES 64
+
+// How lay_out_structs orders each struct's fields in memory
+enum FieldOrder {
+    FIELDS_AS_DECLARED,
+    FIELDS_BY_ALIGNMENT, // most aligned first, ties in declaration order
+};
+
+// Struct layout, on a tree that resolve_names accepted. Gives every struct type its size and alignment in types, and
+// every field's entry its offset, as C does: a field starts at the next multiple of its alignment, and a struct is
+// aligned like its most aligned field, with its size rounded up to that.
+// Every size is a multiple of its alignment and every alignment a power of two, so FIELDS_BY_ALIGNMENT leaves no hole
+// between fields, only tail padding: each struct is as small as any order makes it, and fits a cache line whenever
+// some order would. The declaration order in the tree is kept either way.
+// A struct that contains itself by value, directly or through other structs, has no size; reported to err, false if
+// there were any.
+bool lay_out_structs(ProgramNode& program, TypeTable& types, const Interner& symbols, FieldOrder order, std::ostream& err);
+
+// For each struct: its size, alignment and padding, then its fields and holes in memory order, marking the fields
+// that straddle a cache-line boundary when the struct starts on one (as the first element of a new array does)
+void print_layout_report(const ProgramNode& program, const TypeTable& types, const Interner& symbols, OutputBuffer& out);
+
+#endif // XERLANG_LAYOUT_H
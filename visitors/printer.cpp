@@ -1,260 +1,536 @@
 #include "printer.h"
-#include <iostream>
-#include <sstream>
 
 #define INDENT 4
 
-size_t depth(const struct ASTNode& ast) {
-    size_t depth = 0;
-    const ASTNode* a = &ast;
-    while ((a = a->parent)) depth++;
+// Indent columns are INDENT per level of nesting; a line at column n starts with n - 1 spaces
+void Printer::print_indent(size_t indent, std::string_view message) {
+    out.spaces(indent ? indent - 1 : 0);
+    out << message;
+}
+
+size_t Printer::column() const {
     return INDENT * depth;
 }
 
-void print_indent(size_t indent, const std::string& message) {
-    for (size_t i = 1; i < indent; i++) std::cout << ' ';
-    std::cout << message;
+void Printer::child(ASTNode& node) {
+    depth++;
+    dispatch(node);
+    depth--;
+}
+
+std::string_view Printer::type_name(TypeId type) const {
+    return symbols.name(types.spelling(type));
 }
 
 void Printer::visit(struct ArgsNode& a) {
-    print_indent(depth(a), "↪ Args\n");
-    for (auto& arg : a.args) arg->accept(*this);
+    print_indent(column(), "↪ Args\n");
+    for (auto& arg : a.args) child(*arg);
 }
 void Printer::visit(struct DeclarationsNode& a) {
     if (a.declarations.empty()) return;
-    print_indent(depth(a), "↪ Declarations\n");
-    for (auto& dec : a.declarations) dec->accept(*this);
+    print_indent(column(), "↪ Declarations\n");
+    for (auto& dec : a.declarations) child(*dec);
 }
 void Printer::visit(struct ForPrologueNode& a) {
-    print_indent(depth(a), "↪ For Prologue\n");
-    if (a.init) a.init->accept(*this);
-    if (a.asst) a.asst->accept(*this);
+    print_indent(column(), "↪ For Prologue\n");
+    if (a.init) child(*a.init);
+    if (a.asst) child(*a.asst);
 }
 void Printer::visit(struct ProgramNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ Program\n");
 
     print_indent(indent + (INDENT >> 1), "> Struct Definitions\n");
-    for (auto& sd : a.struct_defs) sd->accept(*this);
+    for (auto& sd : a.struct_defs) child(*sd);
 
     print_indent(indent + (INDENT >> 1), "> Global Vars\n");
-    for (auto& gv : a.global_vars) gv->accept(*this);
+    for (auto& gv : a.global_vars) child(*gv);
 
     print_indent(indent + (INDENT >> 1), "> Procedures\n");
-    for (auto& proc : a.procedures) proc->accept(*this);
+    for (auto& proc : a.procedures) child(*proc);
 
     // print_indent(indent + (INDENT >> 1), "> Main\n");
-    a.main->accept(*this);
+    child(*a.main);
 }
 void Printer::visit(struct StructDefNode& a) {
-    print_indent(depth(a), "↪ Struct Definition\n");
-    a.fields->accept(*this);
+    print_indent(column(), "↪ Struct Definition\n");
+    child(*a.fields);
 }
 void Printer::visit(struct ProcedureNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
 
-    print_indent(indent, "↪ Procedure: " + a.id + " -> " + a.return_type + '\n');
+    print_indent(indent, "↪ Procedure: ");
+    out << symbols.name(a.id) << " -> " << type_name(a.return_type) << '\n';
 
     if (!a.params->declarations.empty()) {
         print_indent(indent + (INDENT >> 1), "> Parameters\n");
-        a.params->accept(*this);
+        child(*a.params);
     }
 
     print_indent(indent + (INDENT >> 1), "> Symbol Table\n");
-    for (auto& [name, STE] : a.symbol_table) {
-        print_indent(indent + INDENT, "> " + name + '\n');
-        // TODO: modify this to show SymbolTableEntry
+    for (const SymbolTableEntry* entry : a.symbol_table) {
+        print_indent(indent + INDENT, entry->kind == SymbolTableEntry::PARAM ? "> param " : "> local ");
+        out << symbols.name(entry->name) << " : " << type_name(entry->type) << '\n';
     }
 
     print_indent(indent + (INDENT >> 1), "> Statements\n");
-    a.block->accept(*this);
+    child(*a.block);
 }
 void Printer::visit(struct MainNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ Main: main\n");
 
     print_indent(indent + (INDENT >> 1), "> Symbol Table\n");
-    for (auto& [name, STE] : a.symbol_table) {
-        print_indent(indent + INDENT, "> " + name + '\n');
-        // TODO: modify this to show SymbolTableEntry
+    for (const SymbolTableEntry* entry : a.symbol_table) {
+        print_indent(indent + INDENT, entry->kind == SymbolTableEntry::PARAM ? "> param " : "> local ");
+        out << symbols.name(entry->name) << " : " << type_name(entry->type) << '\n';
     }
 
     print_indent(indent + (INDENT >> 1), "> Statements\n");
-    a.block->accept(*this);
+    child(*a.block);
 }
 void Printer::visit(struct BlockNode& a) {
-    print_indent(depth(a), "↪ Block\n");
-    for (auto& s : a.statements) s->accept(*this);
+    print_indent(column(), "↪ Block\n");
+    for (auto& s : a.statements) child(*s);
 }
 void Printer::visit(struct DeclarationNode& a) {
-    print_indent(depth(a), "↪ Declaration: " + a.id + " : " + a.type + '\n');
+    print_indent(column(), "↪ Declaration: ");
+    out << symbols.name(a.id) << " : " << type_name(a.type) << '\n';
 }
 void Printer::visit(struct VarInitNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
 
     print_indent(indent, "↪ Variable Initialization\n");
 
     // print_indent(indent + (INDENT >> 1), "> Declaration\n");
-    a.dcl->accept(*this);
+    child(*a.dcl);
 
     if (!a.val) return;
     // print_indent(indent + (INDENT >> 1), "> Initial Value\n");
-    a.val->accept(*this);
+    child(*a.val);
 }
 void Printer::visit(struct IfNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
 
     print_indent(indent, "↪ If Tree\n");
 
     auto it = a.clauses.begin();
     print_indent(indent + (INDENT >> 1), "> IF\n");
     // print_indent(indent + INDENT, "> Condition\n");
-    it->cond->accept(*this);
+    child(*it->cond);
     // print_indent(indent + INDENT, "> Statements\n");
-    it->block->accept(*this);
+    child(*it->block);
 
     it++;
     for (; it != a.clauses.end(); it++) {
          print_indent(indent + (INDENT >> 1), "> ");
         if (it->cond) {
-            std::cout << "ELIF\n";
+            out << "ELIF\n";
             // print_indent(indent + INDENT, "> Condition\n");
-            it->cond->accept(*this);
+            child(*it->cond);
         }
         else {
-            std::cout << "ELSE\n";
+            out << "ELSE\n";
         }
         // print_indent(indent + INDENT, "> Statements\n");
-        it->block->accept(*this);
+        child(*it->block);
     }
 }
 void Printer::visit(struct DeleteNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ Delete\n");
 
     // print_indent(indent + (INDENT >> 1), "> Pointer\n");
-    a.ptr->accept(*this);
+    child(*a.ptr);
 }
 void Printer::visit(struct PrintNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ Print\n");
 
     // print_indent(indent + (INDENT >> 1), "> Arguments\n");
-    a.args->accept(*this);
+    child(*a.args);
 }
 void Printer::visit(struct ReturnNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ Return\n");
 
     if (!a.expr) return;
     // print_indent(indent + (INDENT >> 1), "> Expr\n");
-    a.expr->accept(*this);
+    child(*a.expr);
 }
 void Printer::visit(struct WhileNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ While\n");
 
     // print_indent(indent + (INDENT >> 1), "> Condition\n");
-    a.condition->accept(*this);
+    child(*a.condition);
 
     // print_indent(indent + (INDENT >> 1), "> Statements\n");
-    a.statements->accept(*this);
+    child(*a.statements);
 }
 void Printer::visit(struct AssignmentNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
     print_indent(indent, "↪ Assignment\n");
 
      print_indent(indent + (INDENT >> 1), "> LValue\n");
-    a.LHS->accept(*this);
+    child(*a.LHS);
 
      print_indent(indent + (INDENT >> 1), "> New Value\n");
-    a.RHS->accept(*this);
+    child(*a.RHS);
 }
 void Printer::visit(struct ForNode& a) {
-    const size_t indent = depth(a);
+    const size_t indent = column();
 
     print_indent(indent, "↪ For\n");
 
     // print_indent(indent + (INDENT >> 1), "> For Prologue\n");
-    a.prologue->accept(*this);
+    child(*a.prologue);
 
     print_indent(indent + (INDENT >> 1), "> Condition\n");
-    a.cond->accept(*this);
+    child(*a.cond);
 
     print_indent(indent + (INDENT >> 1), "> For Epilogue\n");
-    a.epilogue->accept(*this);
+    child(*a.epilogue);
 
     print_indent(indent + (INDENT >> 1), "> Statements\n");
-    a.block->accept(*this);
+    child(*a.block);
 }
-void Printer::visit(struct BreakNode& a) {
-    print_indent(depth(a), "↪ Break\n");
+void Printer::visit(struct BreakNode&) {
+    print_indent(column(), "↪ Break\n");
 }
 void Printer::visit(struct NumNode& a) {
-    print_indent(depth(a), "↪ Integer : " + std::to_string(a.val) + '\n');
+    print_indent(column(), "↪ Integer : ");
+    out.number(a.val);
+    out << '\n';
 }
 void Printer::visit(struct CharNode& a) {
-    print_indent(depth(a), "↪ Character : ");
-    std::cout << a.val << '\n';
+    print_indent(column(), "↪ Character : ");
+    out << spell_char(a.val) << '\n';
 }
-void Printer::visit(struct TrueNode& a) {
-    print_indent(depth(a), "↪ Boolean : TRUE\n");
+void Printer::visit(struct TrueNode&) {
+    print_indent(column(), "↪ Boolean : TRUE\n");
 }
-void Printer::visit(struct FalseNode& a) {
-    print_indent(depth(a), "↪ Boolean : FALSE\n");
+void Printer::visit(struct FalseNode&) {
+    print_indent(column(), "↪ Boolean : FALSE\n");
 }
 void Printer::visit(struct IDNode& a) {
-    print_indent(depth(a), "↪ ID : " + a.name);
-    if (!a.type.empty()) std::cout << " : " << a.type;
-    std::cout << '\n';
+    print_indent(column(), "↪ ID : ");
+    out << symbols.name(a.name);
+    if (a.type != NO_TYPE_ID) out << " : " << type_name(a.type);
+    out << '\n';
 }
-void Printer::visit(struct NilNode& a) {
-    print_indent(depth(a), "↪ Pointer : NULL\n");
+void Printer::visit(struct NilNode&) {
+    print_indent(column(), "↪ Pointer : NULL\n");
 }
 void Printer::visit(struct BinaryExprNode& a) {
-    const size_t indent = depth(a);
-    std::ostringstream oss;
-    oss << "↪ Binary Expression: " << a.op << '\n';
-    print_indent(indent, oss.str());
+    const size_t indent = column();
+    print_indent(indent, "↪ Binary Expression: ");
+    out << PARSER_SYMBOL_NAMES[a.op] << '\n';
 
     // print_indent(indent + (INDENT >> 1), "> Left Side\n");
-    a.LHS->accept(*this);
+    child(*a.LHS);
 
     // print_indent(indent + (INDENT >> 1), "> Right Side\n");
-    a.RHS->accept(*this);
+    child(*a.RHS);
 }
 void Printer::visit(struct MemberAccessExprNode& a) {
-    const size_t indent = depth(a);
-    std::ostringstream oss;
-    oss << "↪ Member Access: " << a.op << '\n';
-    print_indent(indent, oss.str());
+    const size_t indent = column();
+    print_indent(indent, "↪ Member Access: ");
+    out << PARSER_SYMBOL_NAMES[a.op] << '\n';
 
     // print_indent(indent + (INDENT >> 1), "> Argument\n");
-    a.arg->accept(*this);
+    child(*a.arg);
 
      print_indent(indent + (INDENT >> 1), "> Field : ");
-     std::cout << a.id + '\n';
+     out << symbols.name(a.id) << '\n';
 }
 void Printer::visit(struct UnaryExprNode& a) {
-    const size_t indent = depth(a);
-    std::ostringstream oss;
-    oss << "↪ Unary Expression: " << a.op << '\n';
-    print_indent(indent, oss.str());
+    const size_t indent = column();
+    print_indent(indent, "↪ Unary Expression: ");
+    out << PARSER_SYMBOL_NAMES[a.op] << '\n';
 
     // print_indent(indent + (INDENT >> 1), "> Argument\n");
-    a.arg->accept(*this);
+    child(*a.arg);
 }
 void Printer::visit(struct AllocNode& a) {
-    print_indent(depth(a), "↪ Allocation: " + a.ptr_type + " [ " + std::to_string(a.size) + " ]\n");
+    print_indent(column(), "↪ Allocation: ");
+    out << type_name(a.ptr_type) << " [ ";
+    out.number(a.size);
+    out << " ]\n";
 }
 void Printer::visit(struct FunctionCallNode& a) {
-    const size_t indent = depth(a);
-    print_indent(indent, "↪ Function Call: " + a.id + '\n');
+    const size_t indent = column();
+    print_indent(indent, "↪ Function Call: ");
+    out << symbols.name(a.id) << '\n';
 
     if (!a.args) return;
     print_indent(indent + (INDENT >> 1), "> Arguments\n");
-    a.args->accept(*this);
+    child(*a.args);
 }
-void Printer::visit(struct ReadCallNode& a) {
-    print_indent(depth(a), "↪ Function Call: read\n");
+void Printer::visit(struct ReadCallNode&) {
+    print_indent(column(), "↪ Function Call: read\n");
+}
+
+//// Structured dumps
+
+// JSON and S-expression dumps share one traversal; the two formats differ only in punctuation
+struct TreeWriter : public StaticVisitor<TreeWriter> {
+    const Interner& symbols;
+    const TypeTable& types;
+    OutputBuffer& out;
+    const bool json;
+
+    TreeWriter(const Interner& symbols, const TypeTable& types, OutputBuffer& out, bool json)
+        : symbols{symbols}, types{types}, out{out}, json{json} {}
+
+    void open(std::string_view kind) {
+        if (json) out << "{\"node\":\"" << kind << '"';
+        else out << '(' << kind;
+    }
+    void close() { out << (json ? '}' : ')'); }
+
+    void key(std::string_view name) {
+        if (json) out << ",\"" << name << "\":";
+        else out << " :" << name << ' ';
+    }
+
+    // Quoted with JSON escapes, which S-expression readers accept as well
+    void quoted(std::string_view text) {
+        static constexpr char HEX[] = "0123456789abcdef";
+        out << '"';
+        for (const char c : text) {
+            switch (c) {
+                case '"': out << "\\\""; break;
+                case '\\': out << "\\\\"; break;
+                case '\n': out << "\\n"; break;
+                case '\t': out << "\\t"; break;
+                case '\r': out << "\\r"; break;
+                default:
+                    if (static_cast<unsigned char>(c) >= 0x20) out << c;
+                    else out << "\\u00" << HEX[c >> 4] << HEX[c & 0xF];
+            }
+        }
+        out << '"';
+    }
+
+    template <class Range, class F>
+    void list(const Range& items, F&& item) {
+        out << (json ? '[' : '(');
+        bool first = true;
+        for (const auto& x : items) {
+            if (!first) out << (json ? ',' : ' ');
+            first = false;
+            item(x);
+        }
+        out << (json ? ']' : ')');
+    }
+    template <class Range>
+    void nodes(std::string_view name, const Range& items) {
+        key(name);
+        list(items, [this](ASTNode* node) { dispatch(*node); });
+    }
+
+    void child(std::string_view name, ASTNode* node) {
+        key(name);
+        if (node) dispatch(*node);
+        else out << (json ? "null" : "nil");
+    }
+    void name(std::string_view name, Symbol symbol) {
+        key(name);
+        quoted(symbols.name(symbol));
+    }
+    void type(std::string_view name, TypeId type) {
+        key(name);
+        quoted(symbols.name(types.spelling(type)));
+    }
+    void text(std::string_view name, std::string_view value) {
+        key(name);
+        quoted(value);
+    }
+    void number(std::string_view name, int value) {
+        key(name);
+        out.number(value);
+    }
+    void flag(std::string_view name, bool value) {
+        key(name);
+        out << (value ? "true" : "false");
+    }
+
+    // Args and Declarations are bare lists in the output, as the value of their parent's field
+    void visit(ArgsNode& a) { list(a.args, [this](ASTNode* node) { dispatch(*node); }); }
+    void visit(DeclarationsNode& a) { list(a.declarations, [this](ASTNode* node) { dispatch(*node); }); }
+
+    void visit(ForPrologueNode& a) {
+        open("for_prologue");
+        child("init", a.init ? static_cast<ASTNode*>(a.init) : a.asst);
+        close();
+    }
+    void visit(ProgramNode& a) {
+        open("program");
+        nodes("struct_defs", a.struct_defs);
+        nodes("globals", a.global_vars);
+        nodes("procedures", a.procedures);
+        child("main", a.main);
+        close();
+    }
+    void visit(StructDefNode& a) {
+        open("struct_def");
+        name("name", a.id);
+        child("fields", a.fields);
+        close();
+    }
+    void visit(ProcedureNode& a) {
+        open("procedure");
+        name("name", a.id);
+        type("return_type", a.return_type);
+        child("params", a.params);
+        child("body", a.block);
+        close();
+    }
+    void visit(MainNode& a) {
+        open("main");
+        child("body", a.block);
+        close();
+    }
+    void visit(BlockNode& a) {
+        open("block");
+        nodes("statements", a.statements);
+        close();
+    }
+    void visit(DeclarationNode& a) {
+        open("declaration");
+        name("name", a.id);
+        type("type", a.type);
+        close();
+    }
+    void visit(VarInitNode& a) {
+        open("var_init");
+        child("declaration", a.dcl);
+        child("value", a.val);
+        close();
+    }
+    void visit(IfNode& a) {
+        open("if");
+        key("clauses");
+        list(a.clauses, [this](const IfNode::IfClause& clause) {
+            open("clause");
+            child("cond", clause.cond);
+            child("body", clause.block);
+            close();
+        });
+        close();
+    }
+    void visit(DeleteNode& a) {
+        open("delete");
+        child("pointer", a.ptr);
+        close();
+    }
+    void visit(PrintNode& a) {
+        open("print");
+        child("args", a.args);
+        close();
+    }
+    void visit(ReturnNode& a) {
+        open("return");
+        child("value", a.expr);
+        close();
+    }
+    void visit(WhileNode& a) {
+        open("while");
+        child("cond", a.condition);
+        child("body", a.statements);
+        close();
+    }
+    void visit(AssignmentNode& a) {
+        open("assignment");
+        child("lhs", a.LHS);
+        child("rhs", a.RHS);
+        close();
+    }
+    void visit(ForNode& a) {
+        open("for");
+        child("prologue", a.prologue);
+        child("cond", a.cond);
+        child("epilogue", a.epilogue);
+        child("body", a.block);
+        close();
+    }
+    void visit(BreakNode&) {
+        open("break");
+        close();
+    }
+    void visit(NumNode& a) {
+        open("num");
+        number("value", a.val);
+        close();
+    }
+    void visit(CharNode& a) {
+        open("char");
+        text("value", {&a.val, 1});
+        close();
+    }
+    void visit(TrueNode&) {
+        open("true");
+        close();
+    }
+    void visit(FalseNode&) {
+        open("false");
+        close();
+    }
+    void visit(IDNode& a) {
+        open("id");
+        name("name", a.name);
+        if (a.type != NO_TYPE_ID) type("type", a.type);
+        close();
+    }
+    void visit(NilNode&) {
+        open("nil");
+        close();
+    }
+    void visit(BinaryExprNode& a) {
+        open("binary");
+        text("op", PARSER_SYMBOL_NAMES[a.op]);
+        child("lhs", a.LHS);
+        child("rhs", a.RHS);
+        close();
+    }
+    void visit(MemberAccessExprNode& a) {
+        open("member");
+        text("op", PARSER_SYMBOL_NAMES[a.op]);
+        child("object", a.arg);
+        name("field", a.id);
+        close();
+    }
+    void visit(UnaryExprNode& a) {
+        open("unary");
+        text("op", PARSER_SYMBOL_NAMES[a.op]);
+        flag("postfix", a.postfix());
+        child("arg", a.arg);
+        close();
+    }
+    void visit(AllocNode& a) {
+        open("alloc");
+        type("type", a.ptr_type);
+        number("count", a.size);
+        close();
+    }
+    void visit(FunctionCallNode& a) {
+        open("call");
+        name("name", a.id);
+        child("args", a.args);
+        close();
+    }
+    void visit(ReadCallNode&) {
+        open("read");
+        close();
+    }
+};
+
+void dump_ast(ASTNode& root, const Interner& symbols, const TypeTable& types, DumpFormat format, OutputBuffer& out) {
+    if (format == DUMP_TEXT) {
+        Printer{symbols, types, out}.dispatch(root);
+        return;
+    }
+    TreeWriter{symbols, types, out, format == DUMP_JSON}.dispatch(root);
+    out << '\n';
 }
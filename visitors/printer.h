@@ -2,41 +2,63 @@
 #define XERLANG_PRINTER_H
 
 #include "../parser/ast.h"
+#include "../util/output.h"
 #include "../util/types.h"
 
-struct Printer : public Visitor {
-    void visit(struct ArgsNode&) override;
-    void visit(struct DeclarationsNode&) override;
-    void visit(struct ForPrologueNode&) override;
-    void visit(struct ProgramNode&) override;
-    void visit(struct StructDefNode&) override;
-    void visit(struct ProcedureNode&) override;
-    void visit(struct MainNode&) override;
-    void visit(struct BlockNode&) override;
-    void visit(struct DeclarationNode&) override;
-    void visit(struct VarInitNode&) override;
-    void visit(struct IfNode&) override;
-    void visit(struct DeleteNode&) override;
-    void visit(struct PrintNode&) override;
-    void visit(struct ReturnNode&) override;
-    void visit(struct WhileNode&) override;
-    void visit(struct AssignmentNode&) override;
-    void visit(struct ForNode&) override;
-    void visit(struct BreakNode&) override;
-    void visit(struct NumNode&) override;
-    void visit(struct CharNode&) override;
-    void visit(struct TrueNode&) override;
-    void visit(struct FalseNode&) override;
-    void visit(struct IDNode&) override;
-    void visit(struct NilNode&) override;
-    void visit(struct BinaryExprNode&) override;
-    void visit(struct MemberAccessExprNode&) override;
-    void visit(struct UnaryExprNode&) override;
-    void visit(struct AllocNode&) override;
-    void visit(struct FunctionCallNode&) override;
-    void visit(struct ReadCallNode&) override;
+enum DumpFormat {
+    DUMP_TEXT,  // indented tree for people, written by the Printer
+    DUMP_JSON,  // one JSON object per node, {"node": kind, fields...}; lists are arrays
+    DUMP_SEXPR, // (kind :field value ...); lists are parenthesised, absent children are nil
 };
 
-struct TypeChecker;
+// Writes the tree rooted at root, whose types are in types, to out in the given format
+void dump_ast(ASTNode& root, const Interner& symbols, const TypeTable& types, DumpFormat format, OutputBuffer& out);
+
+// Indented text dump. Depth is counted as the traversal descends rather than recovered from the parent links.
+struct Printer : public StaticVisitor<Printer> {
+    const Interner& symbols;
+    const TypeTable& types;
+    OutputBuffer& out;
+    size_t depth = 0;
+    Printer(const Interner& symbols, const TypeTable& types, OutputBuffer& out)
+        : symbols{symbols}, types{types}, out{out} {}
+
+    void visit(struct ArgsNode&);
+    void visit(struct DeclarationsNode&);
+    void visit(struct ForPrologueNode&);
+    void visit(struct ProgramNode&);
+    void visit(struct StructDefNode&);
+    void visit(struct ProcedureNode&);
+    void visit(struct MainNode&);
+    void visit(struct BlockNode&);
+    void visit(struct DeclarationNode&);
+    void visit(struct VarInitNode&);
+    void visit(struct IfNode&);
+    void visit(struct DeleteNode&);
+    void visit(struct PrintNode&);
+    void visit(struct ReturnNode&);
+    void visit(struct WhileNode&);
+    void visit(struct AssignmentNode&);
+    void visit(struct ForNode&);
+    void visit(struct BreakNode&);
+    void visit(struct NumNode&);
+    void visit(struct CharNode&);
+    void visit(struct TrueNode&);
+    void visit(struct FalseNode&);
+    void visit(struct IDNode&);
+    void visit(struct NilNode&);
+    void visit(struct BinaryExprNode&);
+    void visit(struct MemberAccessExprNode&);
+    void visit(struct UnaryExprNode&);
+    void visit(struct AllocNode&);
+    void visit(struct FunctionCallNode&);
+    void visit(struct ReadCallNode&);
+
+private:
+    void print_indent(size_t indent, std::string_view message);
+    [[nodiscard]] size_t column() const;
+    void child(ASTNode& node);
+    [[nodiscard]] std::string_view type_name(TypeId type) const;
+};
 
 #endif // XERLANG_PRINTER_H
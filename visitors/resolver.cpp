@@ -0,0 +1,194 @@
+#include "resolver.h"
+#include <ostream>
+#include <vector>
+#include "../util/symbol_table.h"
+
+struct Resolver : public StaticVisitor<Resolver> {
+    Arena& ast;
+    const Interner& symbols;
+    const TypeTable& types;
+    std::ostream& err;
+    ScopedSymbolTable table;
+    std::vector<bool> struct_declared; // per Symbol
+    ProcedureNode* procedure = nullptr; // whose params and locals are being declared
+    uint32_t loop_depth = 0;            // whiles and fors around the statement being resolved
+    bool ok = true;
+
+    Resolver(Arena& ast, const Interner& symbols, const TypeTable& types, std::ostream& err)
+        : ast{ast}, symbols{symbols}, types{types}, err{err} {}
+
+    void error(Symbol name, std::string_view problem) {
+        err << "Name Error in " << (procedure ? "procedure " : "global scope");
+        if (procedure) err << symbols.name(procedure->id);
+        err << ": '" << symbols.name(name) << "' " << problem << '\n';
+        ok = false;
+    }
+
+    // Struct names only ever appear inside types, so they get a namespace of their own
+    void check_type(TypeId type) {
+        const TypeInfo& base = types[types[type].base];
+        if (base.kind == TypeInfo::STRUCT && (base.name >= struct_declared.size() || !struct_declared[base.name])) {
+            error(base.name, "is not declared as a struct");
+        }
+    }
+
+    SymbolTableEntry* declare(SymbolTableEntry::Kind kind, Symbol name, TypeId type, uint32_t index, ASTNode* node) {
+        check_type(type);
+        SymbolTableEntry* entry = ast.make<SymbolTableEntry>(kind, name, type, index, node);
+        if (!table.bind(entry)) error(name, "is already declared in this scope");
+        return entry;
+    }
+
+    void declare_local(SymbolTableEntry::Kind kind, DeclarationNode& d) {
+        d.entry = declare(kind, d.id, d.type, procedure->symbol_table.size(), &d);
+        procedure->symbol_table.push_back(d.entry);
+    }
+
+    void visit(ProgramNode& a) {
+        table.open_scope();
+
+        for (StructDefNode* sd : a.struct_defs) {
+            if (sd->id >= struct_declared.size()) struct_declared.resize(sd->id + 1, false);
+            if (struct_declared[sd->id]) error(sd->id, "is already declared as a struct");
+            struct_declared[sd->id] = true;
+            a.symbol_table.push_back(ast.make<SymbolTableEntry>(SymbolTableEntry::STRUCT, sd->id, sd->type, 0, sd));
+        }
+        for (StructDefNode* sd : a.struct_defs) {
+            table.open_scope();
+            uint32_t index = 0;
+            for (DeclarationNode* field : sd->fields->declarations) {
+                check_type(field->type);
+                field->entry = ast.make<SymbolTableEntry>(SymbolTableEntry::FIELD, field->id, field->type, index++, field);
+                if (!table.bind(field->entry)) error(field->id, "is declared twice in one struct");
+            }
+            table.close_scope();
+        }
+
+        uint32_t index = 0;
+        for (VarInitNode* gv : a.global_vars) {
+            gv->dcl->entry = declare(SymbolTableEntry::GLOBAL, gv->dcl->id, gv->dcl->type, index++, gv->dcl);
+            a.symbol_table.push_back(gv->dcl->entry);
+        }
+        index = 0;
+        for (ProcedureNode* proc : a.procedures) {
+            a.symbol_table.push_back(declare(SymbolTableEntry::PROCEDURE, proc->id, proc->return_type, index++, proc));
+        }
+        a.symbol_table.push_back(declare(SymbolTableEntry::PROCEDURE, a.main->id, a.main->return_type, index, a.main));
+
+        for (VarInitNode* gv : a.global_vars) {
+            if (gv->val) dispatch(*gv->val);
+        }
+        for (ProcedureNode* proc : a.procedures) dispatch(*proc);
+        dispatch(*a.main);
+
+        table.close_scope();
+    }
+
+    // The parameters and the body's top-level statements share one scope
+    void visit(ProcedureNode& a) {
+        procedure = &a;
+        table.open_scope();
+        if (a.params) { // main has none
+            for (DeclarationNode* param : a.params->declarations) declare_local(SymbolTableEntry::PARAM, *param);
+        }
+        for (StatementNode* s : a.block->statements) dispatch(*s);
+        table.close_scope();
+        procedure = nullptr;
+    }
+
+    void visit(BlockNode& a) {
+        table.open_scope();
+        for (StatementNode* s : a.statements) dispatch(*s);
+        table.close_scope();
+    }
+
+    //// Statements
+
+    void visit(DeclarationNode& a) { declare_local(SymbolTableEntry::LOCAL, a); }
+    void visit(VarInitNode& a) {
+        if (a.val) dispatch(*a.val); // the initialiser cannot see the variable it initialises
+        declare_local(SymbolTableEntry::LOCAL, *a.dcl);
+    }
+    void visit(IfNode& a) {
+        for (const IfNode::IfClause& clause : a.clauses) {
+            if (clause.cond) dispatch(*clause.cond);
+            dispatch(*clause.block);
+        }
+    }
+    void visit(DeleteNode& a) { dispatch(*a.ptr); }
+    void visit(PrintNode& a) { dispatch(*a.args); }
+    void visit(ReturnNode& a) {
+        if (a.expr) dispatch(*a.expr);
+    }
+    void visit(WhileNode& a) {
+        dispatch(*a.condition);
+        loop_depth++;
+        dispatch(*a.statements);
+        loop_depth--;
+    }
+    void visit(AssignmentNode& a) {
+        dispatch(*a.LHS);
+        dispatch(*a.RHS);
+    }
+    void visit(ForNode& a) {
+        table.open_scope();
+        dispatch(*a.prologue);
+        dispatch(*a.cond);
+        dispatch(*a.epilogue);
+        loop_depth++;
+        dispatch(*a.block);
+        loop_depth--;
+        table.close_scope();
+    }
+    void visit(ForPrologueNode& a) {
+        if (a.init) dispatch(*a.init);
+        else dispatch(*a.asst);
+    }
+    void visit(BreakNode&) {
+        if (loop_depth > 0) return;
+        err << "Scope Error in procedure " << symbols.name(procedure->id) << ": break outside a loop\n";
+        ok = false;
+    }
+
+    //// Expressions
+
+    void visit(IDNode& a) {
+        SymbolTableEntry* entry = table.lookup(a.name);
+        if (!entry) error(a.name, "is not declared");
+        else if (entry->kind == SymbolTableEntry::PROCEDURE) error(a.name, "is a procedure, not a variable");
+        else a.entry = entry;
+    }
+    void visit(FunctionCallNode& a) {
+        SymbolTableEntry* entry = table.lookup(a.id);
+        if (!entry) error(a.id, "is not declared");
+        else if (entry->kind != SymbolTableEntry::PROCEDURE) error(a.id, "is not a procedure");
+        else a.callee = entry;
+        if (a.args) dispatch(*a.args);
+    }
+    void visit(ReadCallNode&) {}
+    void visit(ArgsNode& a) {
+        for (ExprNode* arg : a.args) dispatch(*arg);
+    }
+    void visit(BinaryExprNode& a) {
+        dispatch(*a.LHS);
+        dispatch(*a.RHS);
+    }
+    void visit(MemberAccessExprNode& a) { dispatch(*a.arg); }
+    void visit(UnaryExprNode& a) { dispatch(*a.arg); }
+    void visit(NumNode&) {}
+    void visit(CharNode&) {}
+    void visit(TrueNode&) {}
+    void visit(FalseNode&) {}
+    void visit(NilNode&) {}
+    void visit(AllocNode& a) { check_type(a.ptr_type); }
+
+    // Struct definitions and declaration lists are handled by their owners and never dispatched on
+    void visit(StructDefNode&) {}
+    void visit(DeclarationsNode&) {}
+};
+
+bool resolve_names(ProgramNode& program, Arena& ast, const Interner& symbols, const TypeTable& types, std::ostream& err) {
+    Resolver resolver{ast, symbols, types, err};
+    resolver.dispatch(program);
+    return resolver.ok;
+}
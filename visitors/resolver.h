@@ -0,0 +1,20 @@
+#ifndef XERLANG_RESOLVER_H
+#define XERLANG_RESOLVER_H
+
+#include <iosfwd>
+#include "../parser/ast.h"
+#include "../util/arena.h"
+#include "../util/interner.h"
+#include "../util/type_table.h"
+
+// Name resolution. Makes a SymbolTableEntry (in ast) for every struct, global, procedure, parameter, local and field,
+// records them in ProgramNode::symbol_table and ProcedureNode::symbol_table, and points each DeclarationNode, IDNode
+// and FunctionCallNode at its entry.
+// Structs, globals and procedures are visible everywhere. A parameter or local is visible from its declaration to the
+// end of the enclosing block (a for's prologue variable to the end of the for), and may shadow outer names.
+// Fields are only checked for duplicates here: which struct a member access refers to is up to type checking.
+// Reports undeclared, redeclared and misused names, including struct types that were never defined, and a break
+// outside any loop to err; false if there were any.
+bool resolve_names(ProgramNode& program, Arena& ast, const Interner& symbols, const TypeTable& types, std::ostream& err);
+
+#endif // XERLANG_RESOLVER_H
@@ -0,0 +1,277 @@
+#include "runtime.h"
+
+const std::string_view RUNTIME_ASSEMBLY = R"(
+# Xerlang runtime
+
+    .bss
+    .balign 16
+xer_out_buf:    .zero 65536     # output waiting for xer_flush
+xer_out_len:    .zero 8
+xer_heap_next:  .zero 8         # the unused part of the current heap chunk
+xer_heap_end:   .zero 8
+xer_free_lists: .zero 17 * 8    # per size class: the last block freed, whose first word links to the one before
+
+    .section .rodata
+xer_true:       .ascii "true"
+xer_false:      .ascii "false"
+xer_hex_digits: .ascii "0123456789abcdef"
+xer_oom:        .ascii "out of memory\n"
+
+    .text
+
+# Output
+
+xer_flush:
+    movq xer_out_len(%rip), %rdx
+    leaq xer_out_buf(%rip), %rsi
+1:  testq %rdx, %rdx
+    jz 2f
+    movl $1, %eax               # write(1, buf, len)
+    movl $1, %edi
+    syscall
+    testq %rax, %rax
+    jle 2f                      # nowhere to write (a closed pipe, say): the rest is dropped
+    addq %rax, %rsi
+    subq %rax, %rdx
+    jmp 1b
+2:  movq $0, xer_out_len(%rip)
+    ret
+
+xer_print_char:
+xer_putc:
+    movq xer_out_len(%rip), %rdx
+    cmpq $65536, %rdx
+    jb 1f
+    pushq %rax
+    call xer_flush
+    popq %rax
+    xorl %edx, %edx
+1:  leaq xer_out_buf(%rip), %rcx
+    movb %al, (%rcx,%rdx)
+    incq %rdx
+    movq %rdx, xer_out_len(%rip)
+    ret
+
+xer_print_space:
+    movl $32, %eax
+    jmp xer_putc
+
+xer_print_newline:
+    movl $10, %eax
+    jmp xer_putc
+
+# Appends the %rcx bytes at %rsi
+xer_write:
+    testq %rcx, %rcx
+    jz 2f
+1:  movzbl (%rsi), %eax
+    pushq %rsi
+    pushq %rcx
+    call xer_putc
+    popq %rcx
+    popq %rsi
+    incq %rsi
+    decq %rcx
+    jnz 1b
+2:  ret
+
+xer_print_bool:
+    leaq xer_true(%rip), %rsi
+    movl $4, %ecx
+    testq %rax, %rax
+    jnz xer_write
+    leaq xer_false(%rip), %rsi
+    movl $5, %ecx
+    jmp xer_write
+
+xer_print_int:
+    testq %rax, %rax
+    jns 1f
+    pushq %rax
+    movl $45, %eax              # '-'
+    call xer_putc
+    popq %rax
+    negq %rax
+1:  subq $24, %rsp              # the digits, written backwards from the top
+    leaq 24(%rsp), %rsi
+    movl $10, %ecx
+2:  xorl %edx, %edx
+    divq %rcx
+    addb $48, %dl               # '0'
+    decq %rsi
+    movb %dl, (%rsi)
+    testq %rax, %rax
+    jnz 2b
+    leaq 24(%rsp), %rcx
+    subq %rsi, %rcx
+    call xer_write
+    addq $24, %rsp
+    ret
+
+xer_print_pointer:
+    pushq %rax
+    movl $48, %eax              # "0x"
+    call xer_putc
+    movl $120, %eax
+    call xer_putc
+    popq %rax
+    subq $24, %rsp
+    leaq 24(%rsp), %rsi
+    leaq xer_hex_digits(%rip), %rcx
+1:  movl %eax, %edx
+    andl $15, %edx
+    movb (%rcx,%rdx), %dl
+    decq %rsi
+    movb %dl, (%rsi)
+    shrq $4, %rax
+    jnz 1b
+    leaq 24(%rsp), %rcx
+    subq %rsi, %rcx
+    call xer_write
+    addq $24, %rsp
+    ret
+
+# Input
+
+xer_read:
+    call xer_flush
+    subq $8, %rsp
+    xorl %eax, %eax             # read(0, buf, 1)
+    xorl %edi, %edi
+    movq %rsp, %rsi
+    movl $1, %edx
+    syscall
+    cmpq $1, %rax
+    movzbl (%rsp), %eax
+    je 1f
+    xorl %eax, %eax
+1:  addq $8, %rsp
+    ret
+
+# Heap. A block is a 16-byte header, then the memory handed out. Blocks of up to 1 MiB come in size classes of
+# 16 << c bytes, c = 0 to 16: they are carved out of 4 MiB chunks, and when freed kept on their class's list for the
+# next allocation of that class. The header's second word holds the class, or -1 for a larger block, which is mapped
+# on its own, its first word then holding the length of the mapping.
+
+xer_alloc:
+    cmpq $1048576, %rax
+    ja 5f
+    xorl %ecx, %ecx             # the class: the bit length of bytes - 1, less 4
+    cmpq $16, %rax
+    jbe 1f
+    decq %rax
+    bsrq %rax, %rcx
+    subl $3, %ecx
+1:  leaq xer_free_lists(%rip), %rdx
+    movq (%rdx,%rcx,8), %rax
+    testq %rax, %rax
+    jz 2f
+    movq (%rax), %rsi           # reuse the last block freed, cleared of what its last user left in it
+    movq %rsi, (%rdx,%rcx,8)
+    movq %rax, %rdx
+    movq %rax, %rdi
+    movl $16, %eax
+    shlq %cl, %rax
+    movq %rax, %rcx
+    xorl %eax, %eax
+    rep stosb
+    movq %rdx, %rax
+    ret
+2:  movl $16, %esi              # or carve out a new one
+    shlq %cl, %rsi
+    addq $16, %rsi
+    movq xer_heap_next(%rip), %rax
+    leaq (%rax,%rsi), %rdi
+    cmpq xer_heap_end(%rip), %rdi
+    jbe 3f
+    pushq %rcx                  # from a new chunk; the rest of the old one is given up
+    pushq %rsi
+    movl $4194304, %esi
+    call xer_map
+    popq %rsi
+    popq %rcx
+    leaq 4194304(%rax), %rdx
+    movq %rdx, xer_heap_end(%rip)
+    leaq (%rax,%rsi), %rdi
+3:  movq %rdi, xer_heap_next(%rip)
+    movq %rcx, 8(%rax)
+    addq $16, %rax
+    ret
+5:  leaq 4111(%rax), %rsi       # header and memory, rounded up to whole pages
+    andq $-4096, %rsi
+    pushq %rsi
+    call xer_map
+    popq %rsi
+    movq %rsi, (%rax)
+    movq $-1, 8(%rax)
+    addq $16, %rax
+    ret
+
+xer_free:
+    testq %rax, %rax
+    jz 1f
+    movq -8(%rax), %rcx
+    testq %rcx, %rcx
+    js 2f
+    leaq xer_free_lists(%rip), %rdx
+    movq (%rdx,%rcx,8), %rsi
+    movq %rsi, (%rax)
+    movq %rax, (%rdx,%rcx,8)
+1:  ret
+2:  leaq -16(%rax), %rdi        # munmap(block, length)
+    movq (%rdi), %rsi
+    movl $11, %eax
+    syscall
+    ret
+
+# %rsi bytes of fresh zeroed pages in %rax
+xer_map:
+    movl $9, %eax               # mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)
+    xorl %edi, %edi
+    movl $3, %edx
+    movl $0x22, %r10d
+    movq $-1, %r8
+    xorl %r9d, %r9d
+    syscall
+    cmpq $-4096, %rax
+    ja 1f
+    ret
+1:  movl $1, %eax               # write(2, "out of memory\n", 14)
+    movl $2, %edi
+    leaq xer_oom(%rip), %rsi
+    movl $14, %edx
+    syscall
+    movl $231, %eax             # exit_group(1)
+    movl $1, %edi
+    syscall
+
+# Arithmetic
+
+xer_pow:
+    movq %rax, %rdx
+    movl $1, %eax
+    testq %rcx, %rcx
+    js 3f
+1:  testq %rcx, %rcx
+    jz 2f
+    testb $1, %cl
+    jz 4f
+    imulq %rdx, %rax
+4:  imulq %rdx, %rdx
+    shrq $1, %rcx
+    jmp 1b
+2:  ret
+3:  xorl %eax, %eax
+    ret
+
+# Exit
+
+xer_exit:
+    pushq %rax
+    call xer_flush
+    popq %rdi
+    movl $231, %eax             # exit_group(status)
+    syscall
+
+    .section .note.GNU-stack, "", @progbits
+)";
@@ -0,0 +1,19 @@
+#ifndef XERLANG_RUNTIME_H
+#define XERLANG_RUNTIME_H
+
+#include <string_view>
+
+// The runtime generated programs link against, as assembler source appended to each program: buffered output, input,
+// the heap, ^^ and process exit, over raw Linux system calls so that executables need no libc.
+// Each routine takes its operands in %rax (the exponent of xer_pow in %rcx), returns its result in %rax, and may
+// clobber every other register except %rbp and %rsp:
+//   xer_print_int, xer_print_char, xer_print_bool, xer_print_pointer  print %rax, an int, char, bool or pointer
+//   xer_print_space, xer_print_newline                                   separate print's arguments and end its line
+//   xer_read          the next byte of standard input, 0 at its end; flushes the output first, so prompts show
+//   xer_alloc         %rax bytes of zeroed memory, 16-byte aligned; exits with status 1 when memory runs out
+//   xer_free          returns memory from xer_alloc; NULL is ignored
+//   xer_pow           %rax ^^ %rcx by squaring, 0 for a negative exponent
+//   xer_exit          flushes the output and exits with status %rax
+extern const std::string_view RUNTIME_ASSEMBLY;
+
+#endif // XERLANG_RUNTIME_H
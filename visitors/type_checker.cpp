@@ -0,0 +1,123 @@
+#include "type_checker.h"
+#include "type_rules.h"
+
+// Post-order walk applying the TypeRules, so that every node's operands are typed before the node itself
+struct TypeChecker : public StaticVisitor<TypeChecker> {
+    TypeRules rules;
+
+    TypeChecker(TypeTable& types, const Interner& symbols, std::ostream& err) : rules{types, symbols, err} {}
+
+    void visit(ProgramNode& a) {
+        for (StructDefNode* sd : a.struct_defs) rules.define(*sd);
+        for (VarInitNode* gv : a.global_vars) dispatch(*gv);
+        for (ProcedureNode* proc : a.procedures) dispatch(*proc);
+        dispatch(*a.main);
+    }
+
+    void visit(ProcedureNode& a) {
+        rules.context = {true, a.id, a.return_type};
+        dispatch(*a.block);
+        rules.context = {};
+    }
+
+    void visit(BlockNode& a) {
+        for (StatementNode* s : a.statements) dispatch(*s);
+    }
+
+    //// Statements
+
+    void visit(DeclarationNode&) {}
+    void visit(VarInitNode& a) {
+        if (!a.val) return;
+        dispatch(*a.val);
+        rules.check(a, *a.val);
+    }
+    void visit(IfNode& a) {
+        for (const IfNode::IfClause& clause : a.clauses) {
+            if (clause.cond) {
+                dispatch(*clause.cond);
+                rules.check(a, *clause.cond);
+            }
+            dispatch(*clause.block);
+        }
+    }
+    void visit(DeleteNode& a) {
+        dispatch(*a.ptr);
+        rules.check(a, *a.ptr);
+    }
+    void visit(PrintNode& a) {
+        for (ExprNode* arg : a.args->args) {
+            dispatch(*arg);
+            rules.check(a, *arg);
+        }
+    }
+    void visit(ReturnNode& a) {
+        if (a.expr) dispatch(*a.expr);
+        rules.check(a);
+    }
+    void visit(WhileNode& a) {
+        dispatch(*a.condition);
+        rules.check(a, *a.condition);
+        dispatch(*a.statements);
+    }
+    void visit(AssignmentNode& a) {
+        dispatch(*a.LHS);
+        dispatch(*a.RHS);
+        rules.check(a, *a.RHS);
+    }
+    void visit(ForNode& a) {
+        dispatch(*a.prologue);
+        dispatch(*a.cond);
+        rules.check(a, *a.cond);
+        dispatch(*a.epilogue);
+        dispatch(*a.block);
+    }
+    void visit(ForPrologueNode& a) {
+        if (a.init) dispatch(*a.init);
+        else dispatch(*a.asst);
+    }
+    void visit(BreakNode&) {}
+
+    //// Expressions
+
+    // Literals and NULL are typed when they are built
+    void visit(NumNode&) {}
+    void visit(CharNode&) {}
+    void visit(TrueNode&) {}
+    void visit(FalseNode&) {}
+    void visit(NilNode&) {}
+
+    void visit(IDNode& a) { rules.type(a); }
+    void visit(AllocNode& a) { rules.type(a); }
+    void visit(ReadCallNode& a) { rules.type(a); }
+    void visit(FunctionCallNode& a) {
+        if (a.args) {
+            for (ExprNode* arg : a.args->args) dispatch(*arg);
+        }
+        rules.type(a);
+    }
+    void visit(BinaryExprNode& a) {
+        dispatch(*a.LHS);
+        dispatch(*a.RHS);
+        rules.type(a);
+    }
+    void visit(UnaryExprNode& a) {
+        dispatch(*a.arg);
+        rules.type(a);
+    }
+    void visit(MemberAccessExprNode& a) {
+        dispatch(*a.arg);
+        rules.type(a);
+    }
+
+    // Struct definitions and the argument and declaration lists are handled by their owners and never dispatched on
+    void visit(StructDefNode&) {}
+    void visit(DeclarationsNode&) {}
+    void visit(ArgsNode&) {}
+};
+
+bool check_types(ProgramNode& program, TypeTable& types, const Interner& symbols, std::ostream& err) {
+    TypeChecker checker{types, symbols, err};
+    checker.dispatch(program);
+    return checker.rules.ok;
+}
@@ -0,0 +1,17 @@
+#ifndef XERLANG_TYPE_CHECKER_H
+#define XERLANG_TYPE_CHECKER_H
+
+#include <iosfwd>
+#include "../parser/ast.h"
+#include "../util/interner.h"
+#include "../util/type_table.h"
+
+// Type checking, on a tree that resolve_names accepted. Gives every ExprNode its type, points each member access at
+// the field it selects, and reports misuses to err; false if there were any.
+// The rules follow C: int, char and bool are integral and convert into one another implicitly; arithmetic and bitwise
+// operators yield int, comparisons and logical operators bool. A pointer may be offset by an integral, and two
+// pointers of one type subtracted or compared; NULL converts to every pointer type. An int may also be dereferenced as
+// the address of an int. read() yields a char.
+bool check_types(ProgramNode& program, TypeTable& types, const Interner& symbols, std::ostream& err);
+
+#endif // XERLANG_TYPE_CHECKER_H
@@ -0,0 +1,236 @@
+#include "type_rules.h"
+#include <algorithm>
+#include <ostream>
+#include <span>
+
+TypeRules::TypeRules(TypeTable& types, const Interner& symbols, std::ostream& err)
+    : types{types}, symbols{symbols}, err{err} {}
+
+// Starts a report; the caller writes the problem and the newline
+std::ostream& TypeRules::error() {
+    err << "Type Error in " << (context.in_procedure ? "procedure " : "global scope");
+    if (context.in_procedure) err << symbols.name(context.procedure);
+    ok = false;
+    return err << ": ";
+}
+
+std::string_view TypeRules::name(TypeId type) const {
+    return symbols.name(types.spelling(type));
+}
+
+bool TypeRules::scalar(TypeId t) const {
+    return TypeTable::is_integral(t) || t == TYPE_NIL || types.is_pointer(t);
+}
+
+// Whether a value of type from may be stored where a to is expected; an erroneous side was already reported
+bool TypeRules::converts(TypeId from, TypeId to) const {
+    return from == to || from == TYPE_ERROR || to == TYPE_ERROR ||
+           (TypeTable::is_integral(from) && TypeTable::is_integral(to)) || (from == TYPE_NIL && types.is_pointer(to));
+}
+
+bool assignable(ExprNode& e) {
+    if (isa<IDNode>(e)) return true;
+    if (auto un = ast_dyn_cast<UnaryExprNode>(&e)) return un->op == Parser::AT;
+    if (auto member = ast_dyn_cast<MemberAccessExprNode>(&e)) {
+        return member->op == Parser::ARROW || assignable(*member->arg);
+    }
+    return false;
+}
+
+void TypeRules::define(const StructDefNode& sd) {
+    if (sd.type >= definitions.size()) definitions.resize(types.num_types());
+    definitions[sd.type] = {static_cast<uint32_t>(fields.size()), static_cast<uint32_t>(sd.fields->declarations.size())};
+    for (const DeclarationNode* field : sd.fields->declarations) fields.push_back({field->id, field->type, field->entry});
+}
+
+//// Expressions
+
+void TypeRules::type(IDNode& a) {
+    a.type = a.entry ? a.entry->type : NO_TYPE_ID;
+}
+
+void TypeRules::type(AllocNode& a) {
+    a.type = a.ptr_type;
+}
+
+void TypeRules::type(ReadCallNode& a) {
+    a.type = TYPE_CHAR;
+}
+
+void TypeRules::type(FunctionCallNode& a) {
+    if (!a.callee) return;
+    const size_t given = a.args ? a.args->args.size() : 0;
+    for (size_t i = 0; i < given; i++) {
+        if (a.args->args[i]->type == NO_TYPE_ID) return;
+    }
+
+    const ProcedureNode* callee = ast_cast<ProcedureNode>(a.callee->node);
+    const size_t wanted = callee->params ? callee->params->declarations.size() : 0;
+    if (given != wanted) {
+        error() << "'" << symbols.name(a.id) << "' takes " << wanted << " arguments, not " << given << '\n';
+    }
+    for (size_t i = 0; i < std::min(given, wanted); i++) {
+        const TypeId t = a.args->args[i]->type;
+        const TypeId param = callee->params->declarations[i]->type;
+        if (!converts(t, param)) {
+            error() << "argument " << i + 1 << " of '" << symbols.name(a.id) << "' is " << name(t) << ", expected "
+                    << name(param) << '\n';
+        }
+    }
+    a.type = callee->return_type;
+}
+
+// Type of l op r, TYPE_ERROR if op does not apply to them
+TypeId TypeRules::binary_type(Parser::ParserSymbol op, TypeId l, TypeId r) const {
+    const bool comparison = op == Parser::EQUALS || op == Parser::NEQ || op == Parser::LT || op == Parser::LEQ ||
+                            op == Parser::GT || op == Parser::GEQ;
+    const bool logical = op == Parser::OR || op == Parser::AND;
+    if (TypeTable::is_integral(l) && TypeTable::is_integral(r)) return (comparison || logical) ? TYPE_BOOL : TYPE_INT;
+    if (logical) return scalar(l) && scalar(r) ? TYPE_BOOL : TYPE_ERROR;
+
+    const bool lp = types.is_pointer(l), rp = types.is_pointer(r);
+    if (comparison) {
+        const bool same = (lp && (r == l || r == TYPE_NIL)) || (rp && l == TYPE_NIL) || (l == TYPE_NIL && r == TYPE_NIL);
+        return same ? TYPE_BOOL : TYPE_ERROR;
+    }
+    if (op == Parser::PLUS) return lp && TypeTable::is_integral(r) ? l : TypeTable::is_integral(l) && rp ? r : TYPE_ERROR;
+    if (op == Parser::SUB) return lp && TypeTable::is_integral(r) ? l : lp && l == r ? TYPE_INT : TYPE_ERROR;
+    return TYPE_ERROR;
+}
+
+void TypeRules::type(BinaryExprNode& a) {
+    const TypeId l = a.LHS->type;
+    const TypeId r = a.RHS->type;
+    if (l == NO_TYPE_ID || r == NO_TYPE_ID) return;
+    if (l == TYPE_ERROR || r == TYPE_ERROR) {
+        a.type = TYPE_ERROR;
+        return;
+    }
+    a.type = binary_type(a.op, l, r);
+    if (a.type == TYPE_ERROR) {
+        error() << PARSER_SYMBOL_NAMES[a.op] << " cannot take " << name(l) << " and " << name(r) << '\n';
+    }
+}
+
+void TypeRules::type(UnaryExprNode& a) {
+    const TypeId t = a.arg->type;
+    if (t == NO_TYPE_ID) return;
+    a.type = TYPE_ERROR;
+    if (t == TYPE_ERROR) return;
+    switch (a.op) {
+        case Parser::AT:
+            if (types.is_pointer(t)) a.type = types.pointee(t);
+            else if (t == TYPE_INT) a.type = TYPE_INT;
+            break;
+        case Parser::ADDR:
+            if (!assignable(*a.arg)) {
+                error() << "cannot take the address of a value that is not assignable\n";
+                return;
+            }
+            a.type = types.pointer_to(t);
+            break;
+        case Parser::NOT:
+            if (scalar(t)) a.type = TYPE_BOOL;
+            break;
+        case Parser::INCR:
+        case Parser::DECR:
+            if (!assignable(*a.arg)) {
+                error() << "the operand of " << PARSER_SYMBOL_NAMES[a.op] << " is not assignable\n";
+                return;
+            }
+            if (TypeTable::is_integral(t) || types.is_pointer(t)) a.type = t;
+            break;
+        default: // BITNOT, SUB, PLUS
+            if (TypeTable::is_integral(t)) a.type = TYPE_INT;
+    }
+    if (a.type == TYPE_ERROR) error() << PARSER_SYMBOL_NAMES[a.op] << " cannot take " << name(t) << '\n';
+}
+
+// Left untyped while the struct has not been defined yet, which only happens in the fused parse
+void TypeRules::type(MemberAccessExprNode& a) {
+    const TypeId t = a.arg->type;
+    if (t == NO_TYPE_ID) return;
+    a.type = TYPE_ERROR;
+    if (t == TYPE_ERROR) return;
+    const TypeId object = a.op == Parser::ARROW ? (types.is_pointer(t) ? types.pointee(t) : TYPE_ERROR) : t;
+    if (object == TYPE_ERROR || !types.is_struct(object)) {
+        error() << PARSER_SYMBOL_NAMES[a.op] << " cannot take " << name(t) << '\n';
+        return;
+    }
+    if (!defined(object)) {
+        a.type = NO_TYPE_ID;
+        return;
+    }
+    const FieldRange range = definitions[object];
+    for (const Field& field : std::span{fields}.subspan(range.first, range.count)) {
+        if (field.name != a.id) continue;
+        a.field = field.entry;
+        a.type = field.type;
+        return;
+    }
+    error() << "struct " << symbols.name(types[object].name) << " has no field '" << symbols.name(a.id) << "'\n";
+}
+
+void TypeRules::type(ExprNode& a) {
+    if (auto e = ast_dyn_cast<IDNode>(&a)) type(*e);
+    else if (auto e = ast_dyn_cast<BinaryExprNode>(&a)) type(*e);
+    else if (auto e = ast_dyn_cast<UnaryExprNode>(&a)) type(*e);
+    else if (auto e = ast_dyn_cast<MemberAccessExprNode>(&a)) type(*e);
+    else if (auto e = ast_dyn_cast<ReadCallNode>(&a)) type(*e);
+    else if (auto e = ast_dyn_cast<FunctionCallNode>(&a)) type(*e);
+    else if (auto e = ast_dyn_cast<AllocNode>(&a)) type(*e);
+}
+
+//// Statements
+
+void TypeRules::condition(ExprNode& e) {
+    if (e.type != TYPE_ERROR && !scalar(e.type)) error() << "a condition cannot be of type " << name(e.type) << '\n';
+}
+
+void TypeRules::check(ASTNode& statement, ExprNode& child) {
+    if (child.type == NO_TYPE_ID) return;
+    if (auto init = ast_dyn_cast<VarInitNode>(&statement)) {
+        if (!converts(child.type, init->dcl->type)) {
+            error() << "cannot initialise '" << symbols.name(init->dcl->id) << "' of type " << name(init->dcl->type)
+                    << " with " << name(child.type) << '\n';
+        }
+    }
+    else if (auto asst = ast_dyn_cast<AssignmentNode>(&statement)) {
+        const TypeId to = asst->LHS->type;
+        const TypeId from = asst->RHS->type;
+        if (to == NO_TYPE_ID || from == NO_TYPE_ID) return;
+        if (!assignable(*asst->LHS)) error() << "the left side of an assignment is not assignable\n";
+        else if (!converts(from, to)) error() << "cannot assign " << name(from) << " to " << name(to) << '\n';
+    }
+    else if (isa<IfNode>(statement) || isa<WhileNode>(statement)) {
+        condition(child);
+    }
+    else if (auto loop = ast_dyn_cast<ForNode>(&statement)) {
+        if (&child == loop->cond) condition(child);
+    }
+    else if (auto ret = ast_dyn_cast<ReturnNode>(&statement)) {
+        check(*ret);
+    }
+    else if (isa<DeleteNode>(statement)) {
+        if (child.type != TYPE_ERROR && !types.is_pointer(child.type)) {
+            error() << "cannot delete a value of type " << name(child.type) << '\n';
+        }
+    }
+    else if (isa<PrintNode>(statement)) {
+        if (child.type != TYPE_ERROR && !scalar(child.type)) {
+            error() << "cannot print a value of type " << name(child.type) << '\n';
+        }
+    }
+}
+
+void TypeRules::check(ReturnNode& a) {
+    const TypeId wanted = context.return_type;
+    if (!a.expr) {
+        if (wanted != TYPE_VOID) error() << "return without a value, expected " << name(wanted) << '\n';
+        return;
+    }
+    const TypeId t = a.expr->type;
+    if (t == NO_TYPE_ID) return;
+    if (wanted == TYPE_VOID) error() << "return with a value in a procedure returning void\n";
+    else if (!converts(t, wanted)) error() << "cannot return " << name(t) << ", expected " << name(wanted) << '\n';
+}
@@ -0,0 +1,79 @@
+#ifndef XERLANG_TYPE_RULES_H
+#define XERLANG_TYPE_RULES_H
+
+#include <iosfwd>
+#include <vector>
+#include "../parser/ast.h"
+#include "../util/interner.h"
+#include "../util/type_table.h"
+
+// Where a rule is applied: names the procedure in diagnostics and gives its returns their expected type
+struct TypeContext {
+    bool in_procedure = false;
+    Symbol procedure = 0;
+    TypeId return_type = TYPE_VOID;
+};
+
+// The typing rule of each node, applied once the node's children are typed: check_types applies them in a post-order
+// walk, the fused parse (ParserContext::parse_checked) as it reduces. In the fused parse an operand may still be
+// untyped (NO_TYPE_ID) because it names something declared further on; the result is then left untyped and nothing is
+// reported, so each rule reports its errors once, when it finally sees all of its operands typed.
+// See type_checker.h for the rules themselves.
+class TypeRules {
+    // A field of a defined struct. Each struct's fields are copied next to one another, so finding the one a member
+    // access names is a scan of a cache line or two rather than a walk through the StructDefNode's declarations.
+    struct Field {
+        Symbol name;
+        TypeId type;
+        SymbolTableEntry* entry;
+    };
+    struct FieldRange {
+        uint32_t first = 0;
+        uint32_t count = 0; // 0 while the struct is undefined; a definition has at least one field
+    };
+
+    TypeTable& types;
+    const Interner& symbols;
+    std::ostream& err;
+    std::vector<Field> fields;
+    std::vector<FieldRange> definitions; // per TypeId: the fields of a struct type
+
+public:
+    TypeContext context;
+    bool ok = true;
+
+    TypeRules(TypeTable& types, const Interner& symbols, std::ostream& err);
+
+    // Makes the fields of sd's struct type available to member accesses
+    void define(const StructDefNode& sd);
+    [[nodiscard]] bool defined(TypeId type) const { return type < definitions.size() && definitions[type].count; }
+
+    // Expressions: set a.type from the types of a's operands. Literals are typed when they are built.
+    void type(IDNode& a);
+    void type(AllocNode& a);
+    void type(ReadCallNode& a);
+    void type(FunctionCallNode& a);
+    void type(BinaryExprNode& a);
+    void type(UnaryExprNode& a);
+    void type(MemberAccessExprNode& a);
+    // Whichever of the above a's class calls for
+    void type(ExprNode& a);
+
+    // Statements: checks what statement does with child, one of its expressions (an assignment waits until both of its
+    // sides are typed)
+    void check(ASTNode& statement, ExprNode& child);
+    void check(ReturnNode& a);
+
+private:
+    std::ostream& error();
+    [[nodiscard]] std::string_view name(TypeId type) const;
+    [[nodiscard]] bool scalar(TypeId t) const;
+    [[nodiscard]] bool converts(TypeId from, TypeId to) const;
+    [[nodiscard]] TypeId binary_type(Parser::ParserSymbol op, TypeId l, TypeId r) const;
+    void condition(ExprNode& e);
+};
+
+// Variables, dereferences and the fields of either
+bool assignable(ExprNode& e);
+
+#endif // XERLANG_TYPE_RULES_H